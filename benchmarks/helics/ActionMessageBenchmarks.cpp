@@ -8,6 +8,35 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/core/ActionMessage.hpp"
 #include "helics_benchmark_main.h"
 
+#include <atomic>
+#include <cstdlib>
+#include <gmlc/containers/BlockingPriorityQueue.hpp>
+#include <new>
+
+/** count every heap allocation made by the benchmark so the serialization paths can report allocations
+per message*/
+static std::atomic<std::size_t> allocationCount{0};
+
+void* operator new(std::size_t size)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    void* ptr = std::malloc((size == 0) ? 1 : size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept
+{
+    std::free(ptr);
+}
+
 using namespace helics;
 
 static void BMtoString(benchmark::State& state)
@@ -134,4 +163,158 @@ static void BMdepacketizeStrings(benchmark::State& state)
 // Register the function as a benchmark
 BENCHMARK(BMdepacketizeStrings);
 
+/* move, copy, and queue cost of the common commands, median of 10 repetitions on a single core Xeon VM with
+gcc -O2, comparing the current layout (144 bytes) with a trial layout that packed the extra strings into a
+single pointer sized block (128 bytes)
+
+                                     vector(144 bytes)    packed(128 bytes)
+BMmoveCommand/timeRequest                17.4 ns              16.1 ns
+BMmoveCommand/pub                        20.8 ns              14.9 ns
+BMmoveCommand/sendMessage                19.7 ns              18.3 ns
+BMcopyCommand/timeRequest                10.9 ns               9.1 ns
+BMcopyCommand/pub                        26.6 ns              26.8 ns
+BMcopyCommand/sendMessage                85.1 ns              96.0 ns
+BMqueueCommand/timeRequest/1000         16.1 M/s             16.0 M/s
+BMqueueCommand/pub/1000                 15.3 M/s             13.3 M/s
+BMqueueCommand/sendMessage/1000          5.1 M/s              4.6 M/s
+
+the packed layout made message copies and queued publications slower so it was not kept,  an inline payload
+buffer was not tried since the payload is used as a std::string throughout the core and a 64 byte buffer
+would grow the object well past 128 bytes
+*/
+
+/** generate one of the commands that make up most of the traffic through the action queues*/
+static ActionMessage generateCommand(action_message_def::action_t action)
+{
+    ActionMessage cmd(action);
+    cmd.source_id = global_federate_id(131072);
+    cmd.dest_id = global_federate_id(131073);
+    cmd.actionTime = 1.5;
+    switch (action) {
+        case CMD_TIME_REQUEST:
+            cmd.Te = 2.0;
+            cmd.Tdemin = 1.5;
+            break;
+        case CMD_PUB:
+            // a small payload like a double or short vector
+            cmd.payload = std::string(48, 'p');
+            break;
+        case CMD_SEND_MESSAGE:
+            cmd.payload = "short message";
+            cmd.setStringData("fed1/endpoint_dest", "fed2/endpoint_src", "fed2/endpoint_src", "");
+            break;
+        default:
+            break;
+    }
+    return cmd;
+}
+
+static void BMmoveCommand(benchmark::State& state, action_message_def::action_t action)
+{
+    ActionMessage cmd = generateCommand(action);
+    for (auto _ : state) {
+        ActionMessage cmd2(std::move(cmd));
+        benchmark::DoNotOptimize(cmd2);
+        cmd = std::move(cmd2);
+    }
+    state.counters["sizeof"] = static_cast<double>(sizeof(ActionMessage));
+}
+BENCHMARK_CAPTURE(BMmoveCommand, timeRequest, CMD_TIME_REQUEST);
+BENCHMARK_CAPTURE(BMmoveCommand, pub, CMD_PUB);
+BENCHMARK_CAPTURE(BMmoveCommand, sendMessage, CMD_SEND_MESSAGE);
+
+static void BMcopyCommand(benchmark::State& state, action_message_def::action_t action)
+{
+    ActionMessage cmd = generateCommand(action);
+    for (auto _ : state) {
+        ActionMessage cmd2(cmd);
+        benchmark::DoNotOptimize(cmd2);
+    }
+}
+BENCHMARK_CAPTURE(BMcopyCommand, timeRequest, CMD_TIME_REQUEST);
+BENCHMARK_CAPTURE(BMcopyCommand, pub, CMD_PUB);
+BENCHMARK_CAPTURE(BMcopyCommand, sendMessage, CMD_SEND_MESSAGE);
+
+/** push a batch of copies of a command through the same queue type as the broker action queue*/
+static void BMqueueCommand(benchmark::State& state, action_message_def::action_t action)
+{
+    ActionMessage cmd = generateCommand(action);
+    gmlc::containers::BlockingPriorityQueue<ActionMessage> queue;
+    const auto batch = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        for (int ii = 0; ii < batch; ++ii) {
+            queue.push(cmd);
+        }
+        for (int ii = 0; ii < batch; ++ii) {
+            auto res = queue.try_pop();
+            benchmark::DoNotOptimize(res);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK_CAPTURE(BMqueueCommand, timeRequest, CMD_TIME_REQUEST)->Arg(1000);
+BENCHMARK_CAPTURE(BMqueueCommand, pub, CMD_PUB)->Arg(1000);
+BENCHMARK_CAPTURE(BMqueueCommand, sendMessage, CMD_SEND_MESSAGE)->Arg(1000);
+
+/* allocations per message for a sendMessage command with a 200 byte payload, single core Xeon VM, gcc -O2
+
+BMserializeAllocations/newString          72.5 ns   allocs_per_msg=1
+BMserializeAllocations/reusedBuffer       41.5 ns   allocs_per_msg=0
+BMserializeAllocations/threadBuffer       42.5 ns   allocs_per_msg=0
+BMserializeAllocations/newMessage          194 ns   allocs_per_msg=5
+BMserializeAllocations/recycledMessage    48.0 ns   allocs_per_msg=0
+*/
+
+/** the ways a message is serialized and deserialized on the way through the comms layer*/
+enum class serializePath {
+    newString, //!< to_string() returning a fresh string
+    reusedBuffer, //!< serializeInto a buffer owned by the caller
+    threadBuffer, //!< serializeInto the thread local serialization buffer
+    newMessage, //!< construct a new message from the bytes
+    recycledMessage, //!< fromByteArray into an existing message
+};
+
+/** report the steady state allocations per message for each serialization path*/
+static void BMserializeAllocations(benchmark::State& state, serializePath path)
+{
+    ActionMessage cmd = generateCommand(CMD_SEND_MESSAGE);
+    // a payload too large for the small string optimization
+    cmd.payload = std::string(200, 'm');
+    std::string buffer;
+    cmd.serializeInto(buffer);
+    ActionMessage rx(buffer.data(), buffer.size());
+    std::size_t allocations{0};
+    for (auto _ : state) {
+        auto start = allocationCount.load(std::memory_order_relaxed);
+        switch (path) {
+            case serializePath::newString: {
+                auto str = cmd.to_string();
+                benchmark::DoNotOptimize(str);
+            } break;
+            case serializePath::reusedBuffer:
+                benchmark::DoNotOptimize(cmd.serializeInto(buffer));
+                break;
+            case serializePath::threadBuffer:
+                benchmark::DoNotOptimize(cmd.serializeInto(threadSerializationBuffer()));
+                break;
+            case serializePath::newMessage: {
+                ActionMessage rx2(buffer.data(), buffer.size());
+                benchmark::DoNotOptimize(rx2);
+            } break;
+            case serializePath::recycledMessage:
+                benchmark::DoNotOptimize(
+                    rx.fromByteArray(buffer.data(), static_cast<int>(buffer.size())));
+                break;
+        }
+        allocations += allocationCount.load(std::memory_order_relaxed) - start;
+    }
+    state.counters["allocs_per_msg"] =
+        static_cast<double>(allocations) / static_cast<double>(state.iterations());
+}
+BENCHMARK_CAPTURE(BMserializeAllocations, newString, serializePath::newString);
+BENCHMARK_CAPTURE(BMserializeAllocations, reusedBuffer, serializePath::reusedBuffer);
+BENCHMARK_CAPTURE(BMserializeAllocations, threadBuffer, serializePath::threadBuffer);
+BENCHMARK_CAPTURE(BMserializeAllocations, newMessage, serializePath::newMessage);
+BENCHMARK_CAPTURE(BMserializeAllocations, recycledMessage, serializePath::recycledMessage);
+
 HELICS_BENCHMARK_MAIN(actionMessageBenchmark);
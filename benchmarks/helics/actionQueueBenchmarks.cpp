@@ -0,0 +1,63 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/core/ActionQueue.hpp"
+#include "helics_benchmark_main.h"
+
+#include <thread>
+#include <vector>
+
+using namespace helics;
+
+/** number of actions each producer sends per iteration*/
+static constexpr int actionsPerProducer{10000};
+
+/** N producer threads push time requests with an occasional priority command into a single queue drained by
+the benchmark thread,  this mirrors federate threads sending actions to the broker processing loop*/
+static void BMactionQueueContention(benchmark::State& state, bool lockFree)
+{
+    const auto producers = static_cast<int>(state.range(0));
+    ActionQueue queue;
+    queue.setLockFree(lockFree);
+    ActionMessage cmd(CMD_TIME_REQUEST);
+    cmd.actionTime = 1.0;
+    for (auto _ : state) {
+        std::vector<std::thread> threads;
+        threads.reserve(producers);
+        for (int ii = 0; ii < producers; ++ii) {
+            threads.emplace_back([&queue, &cmd]() {
+                for (int jj = 0; jj < actionsPerProducer; ++jj) {
+                    if (jj % 64 == 0) {
+                        queue.pushPriority(ActionMessage(CMD_PRIORITY_ACK));
+                    } else {
+                        queue.push(cmd);
+                    }
+                }
+            });
+        }
+        for (int ii = 0; ii < producers * actionsPerProducer; ++ii) {
+            auto res = queue.pop();
+            benchmark::DoNotOptimize(res);
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * producers * actionsPerProducer);
+}
+BENCHMARK_CAPTURE(BMactionQueueContention, blocking, false)
+    ->RangeMultiplier(2)
+    ->Range(1, 64)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BMactionQueueContention, lockFree, true)
+    ->RangeMultiplier(2)
+    ->Range(1, 64)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+HELICS_BENCHMARK_MAIN(actionQueueBenchmark);
@@ -75,4 +75,64 @@ BENCHMARK_CAPTURE(
 
 BENCHMARK_CAPTURE(BMinterpret, vector_interp, std::vector<double>{26.5, 18.6, -48.5, -5.4e-12});
 
+/** interpret a large vector of doubles into a new vector as Input::getValue does*/
+static void BMvector_interpret(benchmark::State& state)
+{
+    std::vector<double> val(static_cast<size_t>(state.range(0)), 3.5);
+    auto store = std::make_shared<data_block>(ValueConverter<std::vector<double>>::convert(val));
+    data_view stv{store};
+    for (auto _ : state) {
+        auto val2 = ValueConverter<std::vector<double>>::interpret(stv);
+        benchmark::DoNotOptimize(val2.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(double));
+}
+BENCHMARK(BMvector_interpret)->RangeMultiplier(100)->Range(100, 1000000);
+
+/** view a large vector of doubles in place*/
+static void BMvector_view(benchmark::State& state)
+{
+    std::vector<double> val(static_cast<size_t>(state.range(0)), 3.5);
+    auto store = std::make_shared<data_block>(ValueConverter<std::vector<double>>::convert(val));
+    data_view stv{store};
+    for (auto _ : state) {
+        auto view = stv.doubleVector();
+        benchmark::DoNotOptimize(view.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(double));
+}
+BENCHMARK(BMvector_view)->RangeMultiplier(100)->Range(100, 1000000);
+
+/** format a vector of doubles as a string as a string typed publication does*/
+static void BMvector_string_format(benchmark::State& state)
+{
+    std::vector<double> val(static_cast<size_t>(state.range(0)));
+    for (size_t ii = 0; ii < val.size(); ++ii) {
+        val[ii] = 1.0 / static_cast<double>(ii + 3);
+    }
+    for (auto _ : state) {
+        auto str = helicsVectorString(val);
+        benchmark::DoNotOptimize(str.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BMvector_string_format)->RangeMultiplier(100)->Range(100, 1000000);
+
+/** parse a string of doubles as a string typed input does*/
+static void BMvector_string_parse(benchmark::State& state)
+{
+    std::vector<double> val(static_cast<size_t>(state.range(0)));
+    for (size_t ii = 0; ii < val.size(); ++ii) {
+        val[ii] = 1.0 / static_cast<double>(ii + 3);
+    }
+    auto str = helicsVectorString(val);
+    std::vector<double> val2;
+    for (auto _ : state) {
+        helicsGetVector(str, val2);
+        benchmark::DoNotOptimize(val2.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BMvector_string_parse)->RangeMultiplier(100)->Range(100, 1000000);
+
 HELICS_BENCHMARK_MAIN(conversionBenchmark);
@@ -150,6 +150,17 @@ BENCHMARK_CAPTURE(BMecho_multiCore, ipcCore, core_type::IPC)
 
 #endif
 
+#ifdef ENABLE_SHM_CORE
+// Register the shared memory benchmarks
+BENCHMARK_CAPTURE(BMecho_multiCore, shmCore, core_type::SHM)
+    ->RangeMultiplier(2)
+    ->Range(1, maxscale * 2)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+#endif
+
 #ifdef ENABLE_TCP_CORE
 // Register the TCP benchmarks
 BENCHMARK_CAPTURE(BMecho_multiCore, tcpCore, core_type::TCP)
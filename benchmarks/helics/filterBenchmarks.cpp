@@ -6,6 +6,7 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 
 #include "EchoMessage.hpp"
+#include "helics/application_api/FilterOperations.hpp"
 #include "helics/application_api/Filters.hpp"
 #include "helics/core/BrokerFactory.hpp"
 #include "helics/core/CoreFactory.hpp"
@@ -17,7 +18,10 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <fstream>
 #include <gmlc/concurrency/Barrier.hpp>
 #include <iostream>
+#include <memory>
+#include <string>
 #include <thread>
+#include <vector>
 
 // static constexpr helics::Time tend = 3600.0_t;  // simulation end time
 using namespace helics;
@@ -199,4 +203,63 @@ BENCHMARK_CAPTURE(BMfilter_multiCore, udpCore, core_type::UDP)
     ->UseRealTime();
 #endif
 
+static void BMfirewall_rules(benchmark::State& state)
+{
+    auto ruleCount = static_cast<int>(state.range(0));
+    FirewallFilterOperation firewall;
+    // a mix of the rule types,  mostly exact and prefix names with a couple of regex rules
+    for (int ii = 0; ii < ruleCount; ++ii) {
+        auto id = std::to_string(ii);
+        switch (ii % 8) {
+            case 0:
+            case 1:
+            case 2:
+                firewall.setString(
+                    "block", "source=fed" + id + "/ep dest=sink" + id + " minsize=100");
+                break;
+            case 3:
+            case 4:
+                firewall.setString("block", "dest=sink" + id + " maxtime=" + id);
+                break;
+            case 5:
+            case 6:
+                firewall.setString("block", "source=area" + id + "/* maxsize=10");
+                break;
+            default:
+                if (ii < 128 && ii % 64 == 7) {
+                    firewall.setString("block", "dest=regex:^restricted" + id + "_");
+                } else {
+                    firewall.setString(
+                        "block", "source=fed" + id + "/* mintime=" + id + " minsize=1000");
+                }
+                break;
+        }
+    }
+    firewall.setString("allow", "dest=sink*");
+
+    std::vector<Message> messages(64);
+    for (int ii = 0; ii < 64; ++ii) {
+        auto& mess = messages[ii];
+        auto id = std::to_string((ii * 37) % ruleCount);
+        mess.source = (ii % 2 == 0) ? "fed" + id + "/ep" : "area" + id + "/ep";
+        mess.dest = "sink" + id;
+        mess.data = data_block(static_cast<std::size_t>(ii * 4), 'a');
+        mess.time = Time(ii);
+    }
+    auto op = firewall.getOperator();
+    std::size_t index{0};
+    int passed{0};
+    for (auto _ : state) {
+        auto res = (*op)(std::make_unique<Message>(messages[index]));
+        if (res) {
+            ++passed;
+        }
+        index = (index + 1) % messages.size();
+    }
+    benchmark::DoNotOptimize(passed);
+    state.SetItemsProcessed(state.iterations());
+}
+// the time per message should stay nearly flat as the number of rules grows
+BENCHMARK(BMfirewall_rules)->RangeMultiplier(4)->Range(128, 8192);
+
 HELICS_BENCHMARK_MAIN(filterBenchmark);
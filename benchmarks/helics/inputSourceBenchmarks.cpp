@@ -0,0 +1,90 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/core/InputAggregation.hpp"
+#include "helics/core/NamedInputInfo.hpp"
+#include "helics/helics_enums.h"
+#include "helics_benchmark_main.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace helics;
+
+/** every source of an input with N sources delivers a value followed by a time grant,  this is the work done in
+a federate for each time step of an input fed by many publications*/
+static void BMinputSourceDelivery(benchmark::State& state, int method)
+{
+    const auto sourceCount = static_cast<int>(state.range(0));
+    NamedInputInfo input(
+        global_handle(global_federate_id(1), interface_handle(0)), "input", "double", "");
+    std::vector<global_handle> sources;
+    sources.reserve(sourceCount);
+    for (int ii = 0; ii < sourceCount; ++ii) {
+        sources.emplace_back(global_federate_id(ii + 2), interface_handle(ii));
+        input.addSource(sources.back(), "pub" + std::to_string(ii), "double", "");
+    }
+    input.setMultiInputMethod(method);
+    auto value = std::make_shared<const data_block>(encodeNumericValue({1.5}, false));
+    Time currentTime = timeZero;
+    for (auto _ : state) {
+        currentTime += 1.0;
+        // deliver in reverse order so the sources at the end of the list are not favored
+        for (auto src = sources.rbegin(); src != sources.rend(); ++src) {
+            input.addData(*src, currentTime, 0, value);
+        }
+        auto updated = input.updateTimeInclusive(currentTime);
+        benchmark::DoNotOptimize(updated);
+        benchmark::DoNotOptimize(input.getData());
+    }
+    state.SetItemsProcessed(state.iterations() * sourceCount);
+}
+BENCHMARK_CAPTURE(BMinputSourceDelivery, no_op, helics_multi_input_no_op)
+    ->Arg(16)
+    ->Arg(256)
+    ->Arg(1024)
+    ->Arg(5000)
+    ->Unit(benchmark::TimeUnit::kMicrosecond);
+BENCHMARK_CAPTURE(BMinputSourceDelivery, sum, helics_multi_input_sum_operation)
+    ->Arg(16)
+    ->Arg(256)
+    ->Arg(1024)
+    ->Arg(5000)
+    ->Unit(benchmark::TimeUnit::kMicrosecond);
+
+/** remove every source of an input with N sources by handle*/
+static void BMinputSourceRemoval(benchmark::State& state)
+{
+    const auto sourceCount = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        NamedInputInfo input(
+            global_handle(global_federate_id(1), interface_handle(0)), "input", "double", "");
+        for (int ii = 0; ii < sourceCount; ++ii) {
+            input.addSource(
+                global_handle(global_federate_id(ii + 2), interface_handle(ii)),
+                "pub" + std::to_string(ii),
+                "double",
+                "");
+        }
+        state.ResumeTiming();
+        for (int ii = 0; ii < sourceCount; ++ii) {
+            input.removeSource(
+                global_handle(global_federate_id(ii + 2), interface_handle(ii)), timeZero);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * sourceCount);
+}
+BENCHMARK(BMinputSourceRemoval)
+    ->Arg(16)
+    ->Arg(256)
+    ->Arg(1024)
+    ->Arg(5000)
+    ->Unit(benchmark::TimeUnit::kMicrosecond);
+
+HELICS_BENCHMARK_MAIN(inputSourceBenchmark);
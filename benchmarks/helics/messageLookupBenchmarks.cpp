@@ -137,6 +137,99 @@ BENCHMARK(BMmgen_singleCore)
     ->Iterations(1)
     ->UseRealTime();
 
+/** flood a single endpoint with messages that arrive out of time order*/
+static void BMmgen_singleEndpointFlood(benchmark::State& state)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto wcore = helics::CoreFactory::create(core_type::INPROC, std::string("--autobroker "));
+        helics::FederateInfo fi;
+        fi.coreName = wcore->getIdentifier();
+        helics::MessageFederate mFed("flood", fi);
+        auto& src = mFed.registerGlobalEndpoint("source");
+        auto& dest = mFed.registerGlobalEndpoint("dest");
+        mFed.enterExecutingMode();
+
+        auto msgCount = static_cast<int>(state.range(0));
+        std::mt19937 eng(msgCount); // fixed seed so each run sees the same ordering
+        std::uniform_int_distribution<> messageTime(1, 1000);
+        const std::string message = "hello";
+        state.ResumeTiming();
+        for (int ii = 0; ii < msgCount; ++ii) {
+            src.send(
+                "dest",
+                message.data(),
+                message.size(),
+                helics::Time(messageTime(eng), time_units::ms));
+        }
+        mFed.requestTime(1.0);
+        auto m = mFed.getMessage(dest);
+        while (m) {
+            m = mFed.getMessage(dest);
+        }
+        state.PauseTiming();
+        mFed.finalize();
+        wcore.reset();
+        cleanupHelicsLibrary();
+        state.ResumeTiming();
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BMmgen_singleEndpointFlood)
+    ->RangeMultiplier(4)
+    ->Range(1 << 6, 1 << 16)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
+/** a single federate with many endpoints and sparse traffic drained through getMessage()*/
+static void BMmgen_manyEndpoints(benchmark::State& state)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto wcore = helics::CoreFactory::create(core_type::INPROC, std::string("--autobroker "));
+        helics::FederateInfo fi;
+        fi.coreName = wcore->getIdentifier();
+        fi.setProperty(helics_property_time_period, 1.0);
+        helics::MessageFederate mFed("gateway", fi);
+        auto eptCount = static_cast<int>(state.range(0));
+        std::vector<helics::Endpoint> epts;
+        epts.reserve(eptCount);
+        for (int ii = 0; ii < eptCount; ++ii) {
+            epts.push_back(mFed.registerGlobalEndpoint("ept_" + std::to_string(ii)));
+        }
+        mFed.enterExecutingMode();
+
+        std::mt19937 eng(eptCount); // fixed seed so each run sees the same traffic
+        std::uniform_int_distribution<> messageEndpoint(0, eptCount - 1);
+        const std::string message = "hello";
+        const std::string destName = "ept_";
+        state.ResumeTiming();
+        for (int jj = 0; jj < 100; ++jj) {
+            for (int ii = 0; ii < 10; ++ii) {
+                auto dest = destName + std::to_string(messageEndpoint(eng));
+                epts[messageEndpoint(eng)].send(dest, message);
+            }
+            mFed.requestNextStep();
+            while (mFed.hasMessage()) {
+                auto m = mFed.getMessage();
+            }
+        }
+        state.PauseTiming();
+        mFed.finalize();
+        wcore.reset();
+        cleanupHelicsLibrary();
+        state.ResumeTiming();
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BMmgen_manyEndpoints)
+    ->RangeMultiplier(4)
+    ->Range(1 << 4, 1 << 14)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
 static void BMmgen_multiCore(benchmark::State& state, core_type cType)
 {
     for (auto _ : state) {
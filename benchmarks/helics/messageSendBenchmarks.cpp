@@ -180,6 +180,76 @@ static void BMsendMessage(benchmark::State& state, core_type cType, bool singleC
     }
 }
 
+/** send messages between two federates whose cores are attached to different branches of a 3 level broker
+hierarchy,  so every message is forwarded by a leaf broker,  a mid level broker and the root broker on its way up
+and by a mid level and leaf broker on the way down*/
+static void BMforwardMessage(benchmark::State& state, core_type cType)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+
+        int fed_count = 2;
+        gmlc::concurrency::Barrier brr(static_cast<size_t>(fed_count + 1));
+
+        auto root = helics::BrokerFactory::create(
+            cType,
+            "forwardroot",
+            std::string("--log_level=no_print --federates=") + std::to_string(fed_count));
+        std::vector<std::shared_ptr<helics::Broker>> brokers;
+        std::vector<std::shared_ptr<helics::Core>> cores(fed_count);
+        std::vector<MessageExchangeFederate> feds(fed_count);
+        int msg_size = state.range(0);
+        int msg_count = state.range(1);
+        for (int ii = 0; ii < fed_count; ++ii) {
+            auto mid = helics::BrokerFactory::create(
+                cType, "--log_level=no_print --broker=" + root->getIdentifier());
+            mid->connect();
+            auto leaf = helics::BrokerFactory::create(
+                cType, "--log_level=no_print --broker=" + mid->getIdentifier());
+            leaf->connect();
+            brokers.push_back(mid);
+            brokers.push_back(leaf);
+            cores[ii] = helics::CoreFactory::create(
+                cType, "-f 1 --log_level=no_print --broker=" + leaf->getIdentifier());
+            cores[ii]->connect();
+            feds[ii].initialize(cores[ii]->getIdentifier(), ii, msg_size, msg_count);
+        }
+
+        std::vector<std::thread> threadlist(static_cast<size_t>(fed_count));
+        for (int ii = 0; ii < fed_count; ++ii) {
+            threadlist[ii] = std::thread(
+                [&](MessageExchangeFederate& f) {
+                    f.run(
+                        [&brr]() {
+                            brr.wait();
+                            brr.wait();
+                        },
+                        [&brr]() { brr.wait(); });
+                },
+                std::ref(feds[ii]));
+        }
+
+        brr.wait();
+        state.ResumeTiming();
+        brr.wait();
+        brr.wait();
+        state.PauseTiming();
+
+        for (auto& thrd : threadlist) {
+            thrd.join();
+        }
+
+        root->disconnect();
+        root.reset();
+        brokers.clear();
+        cores.clear();
+        cleanupHelicsLibrary();
+
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(1) * 2);
+}
+
 // Some math notes:
 // 1 << 6 = 64
 // 1 << 10 = 1024
@@ -210,6 +280,23 @@ BENCHMARK_CAPTURE(BMsendMessage, multiCore/inprocCore, core_type::INPROC)
     ->Unit(benchmark::TimeUnit::kMillisecond)
     ->UseRealTime();
 
+// Register the broker hierarchy forwarding benchmarks
+// clang-format off
+BENCHMARK_CAPTURE(BMforwardMessage, brokerTree/inprocCore, core_type::INPROC)
+    // clang-format on
+    ->Ranges({{1, 1}, {1, 1 << 9}})
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+// clang-format off
+BENCHMARK_CAPTURE(BMforwardMessage, brokerTree/testCore, core_type::TEST)
+    // clang-format on
+    ->Ranges({{1, 1}, {1, 1 << 9}})
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
 #ifdef ENABLE_ZMQ_CORE
 // Register the ZMQ benchmarks
 // clang-format off
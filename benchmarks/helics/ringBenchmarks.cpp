@@ -232,6 +232,16 @@ BENCHMARK_CAPTURE(BMring_multiCore, ipcCore, core_type::IPC)
     ->UseRealTime();
 #endif
 
+#ifdef ENABLE_SHM_CORE
+// Register the shared memory benchmarks
+BENCHMARK_CAPTURE(BMring_multiCore, shmCore, core_type::SHM)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Arg(2)
+    ->Arg(3)
+    ->Arg(4)
+    ->UseRealTime();
+#endif
+
 #ifdef ENABLE_TCP_CORE
 // Register the TCP benchmarks
 BENCHMARK_CAPTURE(BMring_multiCore, tcpCore, core_type::TCP)
@@ -12,6 +12,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/core/ActionMessage.hpp"
 #include "helics/core/BrokerFactory.hpp"
 #include "helics/core/CoreFactory.hpp"
+#include "helics/core/ForwardingTimeCoordinator.hpp"
 #include "helics/helics-config.h"
 #include "helics_benchmark_main.h"
 
@@ -271,6 +272,17 @@ BENCHMARK_CAPTURE(BMtiming_multiCore, ipcCore, core_type::IPC)
 
 #endif
 
+#ifdef ENABLE_SHM_CORE
+// Register the shared memory benchmarks
+BENCHMARK_CAPTURE(BMtiming_multiCore, shmCore, core_type::SHM)
+    ->RangeMultiplier(2)
+    ->Range(1, maxscale)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+#endif
+
 #ifdef ENABLE_TCP_CORE
 // Register the TCP benchmarks
 BENCHMARK_CAPTURE(BMtiming_multiCore, tcpCore, core_type::TCP)
@@ -300,4 +312,45 @@ BENCHMARK_CAPTURE(BMtiming_multiCore, udpCore, core_type::UDP)
     ->UseRealTime();
 #endif
 
+/** a broker coordinator with N federate dependencies processes a time request from each of them followed by
+a grant of the next step,  this is the timing work done in a broker for a step of a high fan in federation*/
+static void BMtiming_dependencyScaling(benchmark::State& state)
+{
+    const auto feds = static_cast<int>(state.range(0));
+    ForwardingTimeCoordinator coord;
+    coord.source_id = global_federate_id(1);
+    int messageCount{0};
+    coord.setMessageSender([&messageCount](const ActionMessage&) { ++messageCount; });
+    for (int ii = 0; ii < feds; ++ii) {
+        coord.addDependency(global_federate_id(0x0002'0000 + ii));
+        coord.addDependent(global_federate_id(0x0002'0000 + ii));
+    }
+    ActionMessage treq(CMD_TIME_REQUEST);
+    ActionMessage tgrant(CMD_TIME_GRANT);
+    Time currentTime = timeZero;
+    for (auto _ : state) {
+        currentTime += 1.0;
+        treq.actionTime = currentTime;
+        treq.Te = currentTime;
+        treq.Tdemin = currentTime;
+        tgrant.actionTime = currentTime;
+        for (int ii = 0; ii < feds; ++ii) {
+            treq.source_id = global_federate_id(0x0002'0000 + ii);
+            coord.processTimeMessage(treq);
+            coord.updateTimeFactors();
+        }
+        for (int ii = 0; ii < feds; ++ii) {
+            tgrant.source_id = global_federate_id(0x0002'0000 + ii);
+            coord.processTimeMessage(tgrant);
+            coord.updateTimeFactors();
+        }
+    }
+    benchmark::DoNotOptimize(messageCount);
+    state.SetItemsProcessed(state.iterations() * feds * 2);
+}
+BENCHMARK(BMtiming_dependencyScaling)
+    ->RangeMultiplier(4)
+    ->Range(16, 4096)
+    ->Unit(benchmark::TimeUnit::kMicrosecond);
+
 HELICS_BENCHMARK_MAIN(timingBenchmark);
@@ -0,0 +1,307 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/application_api/Inputs.hpp"
+#include "helics/application_api/Publications.hpp"
+#include "helics/application_api/ValueFederate.hpp"
+#include "helics/core/BrokerBase.hpp"
+#include "helics/core/BrokerFactory.hpp"
+#include "helics/core/CoreFactory.hpp"
+#include "helics_benchmark_main.h"
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstdint>
+#include <gmlc/concurrency/Barrier.hpp>
+#include <thread>
+
+using namespace helics;
+
+/** the layout of brokers and cores the federates are distributed over*/
+enum class scaling_topology {
+    flat, //!< all federates on a single core under one broker
+    multi_core, //!< federates spread over many cores under one broker
+    broker_tree, //!< cores spread over the leaves of a two level tree of sub-brokers
+};
+
+/** the largest number of leaf federates,  the 10k federate cases take a long time so they only run when the
+benchmarks are built with HELICS_BENCHMARK_LONG_RUNS*/
+#ifdef HELICS_BENCHMARK_LONG_RUNS
+static constexpr int64_t maxscale{10000};
+#else
+static constexpr int64_t maxscale{1000};
+#endif
+/** the number of time steps each federate requests*/
+static constexpr int scalingSteps{20};
+/** the number of federates placed on each core in the multi-core and broker tree topologies*/
+static constexpr int fedsPerCore{10};
+/** the number of child brokers under each broker in the broker tree topology*/
+static constexpr int treeBranching{4};
+
+/** a federate stepping through time while exchanging a value with a hub federate
+
+the hub publishes a single value all the leaves subscribe to, and subscribes to a value from every leaf,  so the
+hub has a dependency on every leaf and every leaf depends on the hub*/
+class ScalingFederate {
+  public:
+    std::vector<std::int64_t> grantLatency; //!< the latency of each time request in ns
+  private:
+    std::unique_ptr<helics::ValueFederate> vFed;
+    helics::Publication* pub = nullptr;
+    int index_ = 0;
+    bool initialized{false};
+    bool readyToRun{false};
+
+  public:
+    ScalingFederate() = default;
+
+    void run(std::function<void()> callOnReady = {})
+    {
+        if (!readyToRun) {
+            makeReady();
+        }
+        if (callOnReady) {
+            callOnReady();
+        }
+        mainLoop();
+    };
+    /** initialize the federate,  an index of -1 generates the hub with leafCount subscriptions*/
+    void initialize(const std::string& coreName, int index, int leafCount)
+    {
+        index_ = index;
+        helics::FederateInfo fi;
+        fi.coreName = coreName;
+        if (index_ < 0) {
+            vFed = std::make_unique<helics::ValueFederate>("scalehub", fi);
+            pub = &vFed->registerGlobalPublication<double>("scalehub_send");
+            for (int ii = 0; ii < leafCount; ++ii) {
+                vFed->registerIndexedSubscription("scaleleaf_send", ii);
+            }
+        } else {
+            vFed = std::make_unique<helics::ValueFederate>(
+                "scaleleaf_" + std::to_string(index_), fi);
+            pub = &vFed->registerIndexedPublication<double>("scaleleaf_send", index_);
+            vFed->registerSubscription("scalehub_send");
+        }
+        grantLatency.reserve(scalingSteps);
+        initialized = true;
+    }
+
+    void makeReady()
+    {
+        if (!initialized) {
+            throw("must initialize first");
+        }
+        vFed->enterExecutingMode();
+        readyToRun = true;
+    }
+
+    void mainLoop()
+    {
+        for (int step = 1; step <= scalingSteps; ++step) {
+            pub->publish(static_cast<double>(step));
+            auto start = std::chrono::steady_clock::now();
+            vFed->requestTime(helics::Time(step, time_units::ms));
+            auto stop = std::chrono::steady_clock::now();
+            grantLatency.push_back(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+        }
+        vFed->finalize();
+    }
+};
+
+/** get the number of messages processed by a broker or core*/
+template<class X>
+static std::size_t processedMessages(const std::shared_ptr<X>& obj)
+{
+    auto* bbase = dynamic_cast<BrokerBase*>(obj.get());
+    return (bbase != nullptr) ? bbase->currentMessageCounter() : 0;
+}
+
+/** run a hub and feds leaf federates over the given topology and report the grant rate,  the number of messages
+processed per grant and the latency distribution of the grants*/
+static void BMtiming_scaling(benchmark::State& state, scaling_topology topo, core_type cType)
+{
+    for (auto _ : state) {
+        const int feds = static_cast<int>(state.range(0));
+        const std::string logArgs{" --log_level=no_print"};
+        std::vector<std::shared_ptr<Broker>> brokers;
+        std::vector<std::shared_ptr<Core>> cores;
+
+        brokers.push_back(BrokerFactory::create(
+            cType, std::string("--federates=") + std::to_string(feds + 1) + logArgs));
+        // the brokers cores attach to,  the root unless this is a tree
+        std::vector<std::shared_ptr<Broker>> attachBrokers{brokers.front()};
+        if (topo == scaling_topology::broker_tree) {
+            attachBrokers.clear();
+            for (int ii = 0; ii < treeBranching; ++ii) {
+                auto mid = BrokerFactory::create(
+                    cType, "--broker=" + brokers.front()->getIdentifier() + logArgs);
+                mid->connect();
+                brokers.push_back(mid);
+                for (int jj = 0; jj < treeBranching; ++jj) {
+                    auto leaf =
+                        BrokerFactory::create(cType, "--broker=" + mid->getIdentifier() + logArgs);
+                    leaf->connect();
+                    brokers.push_back(leaf);
+                    attachBrokers.push_back(leaf);
+                }
+            }
+        }
+        auto makeCore = [&](int fedCount) {
+            const auto& parent = attachBrokers[cores.size() % attachBrokers.size()];
+            auto core = CoreFactory::create(
+                cType,
+                "--federates=" + std::to_string(fedCount) +
+                    " --broker=" + parent->getIdentifier() + logArgs);
+            core->connect();
+            cores.push_back(core);
+            return core;
+        };
+
+        ScalingFederate hub;
+        std::vector<ScalingFederate> leafs(feds);
+        if (topo == scaling_topology::flat) {
+            auto core = makeCore(feds + 1);
+            hub.initialize(core->getIdentifier(), -1, feds);
+            for (int ii = 0; ii < feds; ++ii) {
+                leafs[ii].initialize(core->getIdentifier(), ii, feds);
+            }
+        } else {
+            hub.initialize(makeCore(1)->getIdentifier(), -1, feds);
+            std::shared_ptr<Core> core;
+            for (int ii = 0; ii < feds; ++ii) {
+                if (ii % fedsPerCore == 0) {
+                    core = makeCore(std::min(fedsPerCore, feds - ii));
+                }
+                leafs[ii].initialize(core->getIdentifier(), ii, feds);
+            }
+        }
+
+        gmlc::concurrency::Barrier brr(static_cast<size_t>(feds) + 1);
+        std::vector<std::thread> threadlist(static_cast<size_t>(feds));
+        for (int ii = 0; ii < feds; ++ii) {
+            threadlist[ii] = std::thread(
+                [&](ScalingFederate& lf) { lf.run([&brr]() { brr.wait(); }); },
+                std::ref(leafs[ii]));
+        }
+        hub.makeReady();
+        brr.wait();
+
+        std::size_t startMessages{0};
+        for (auto& brk : brokers) {
+            startMessages += processedMessages(brk);
+        }
+        for (auto& core : cores) {
+            startMessages += processedMessages(core);
+        }
+        auto start = std::chrono::steady_clock::now();
+        hub.run();
+        for (auto& thrd : threadlist) {
+            thrd.join();
+        }
+        auto stop = std::chrono::steady_clock::now();
+        const double elapsed = std::chrono::duration<double>(stop - start).count();
+        state.SetIterationTime(elapsed);
+
+        std::size_t stopMessages{0};
+        for (auto& brk : brokers) {
+            stopMessages += processedMessages(brk);
+        }
+        for (auto& core : cores) {
+            stopMessages += processedMessages(core);
+        }
+
+        std::vector<std::int64_t> latency = std::move(hub.grantLatency);
+        for (auto& lf : leafs) {
+            latency.insert(latency.end(), lf.grantLatency.begin(), lf.grantLatency.end());
+        }
+        const auto grants = static_cast<double>(latency.size());
+        auto percentile = [&latency](double pct) {
+            auto loc = latency.begin() +
+                static_cast<std::ptrdiff_t>(pct * static_cast<double>(latency.size() - 1));
+            std::nth_element(latency.begin(), loc, latency.end());
+            return static_cast<double>(*loc) / 1000.0;
+        };
+        // kIsRate would divide by the CPU time of this thread, which includes the setup
+        state.counters["grants_per_sec"] = grants / elapsed;
+        state.counters["msgs_per_grant"] =
+            static_cast<double>(stopMessages - startMessages) / grants;
+        state.counters["p50_grant_us"] = percentile(0.5);
+        state.counters["p99_grant_us"] = percentile(0.99);
+        state.counters["cores"] = static_cast<double>(cores.size());
+        state.counters["brokers"] = static_cast<double>(brokers.size());
+
+        brokers.front()->disconnect();
+        brokers.clear();
+        cores.clear();
+        cleanupHelicsLibrary();
+    }
+}
+
+// Register the inproc core benchmarks
+BENCHMARK_CAPTURE(BMtiming_scaling, flat_inprocCore, scaling_topology::flat, core_type::INPROC)
+    ->RangeMultiplier(10)
+    ->Range(10, maxscale)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseManualTime();
+
+BENCHMARK_CAPTURE(
+    BMtiming_scaling,
+    multiCore_inprocCore,
+    scaling_topology::multi_core,
+    core_type::INPROC)
+    ->RangeMultiplier(10)
+    ->Range(10, maxscale)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseManualTime();
+
+BENCHMARK_CAPTURE(
+    BMtiming_scaling,
+    brokerTree_inprocCore,
+    scaling_topology::broker_tree,
+    core_type::INPROC)
+    ->RangeMultiplier(10)
+    ->Range(10, maxscale)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseManualTime();
+
+// Register the test core benchmarks
+BENCHMARK_CAPTURE(BMtiming_scaling, flat_testCore, scaling_topology::flat, core_type::TEST)
+    ->RangeMultiplier(10)
+    ->Range(10, maxscale)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseManualTime();
+
+BENCHMARK_CAPTURE(
+    BMtiming_scaling,
+    multiCore_testCore,
+    scaling_topology::multi_core,
+    core_type::TEST)
+    ->RangeMultiplier(10)
+    ->Range(10, maxscale)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseManualTime();
+
+BENCHMARK_CAPTURE(
+    BMtiming_scaling,
+    brokerTree_testCore,
+    scaling_topology::broker_tree,
+    core_type::TEST)
+    ->RangeMultiplier(10)
+    ->Range(10, maxscale)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseManualTime();
+
+HELICS_BENCHMARK_MAIN(timingScalingBenchmark);
@@ -203,6 +203,97 @@ PyModule_AddObject(m, "HelicsException", pHelicsException);
 
 
 
+// typemap for updated input index output
+%typemap(arginit) (int indices[], int maxIndices, int *actualCount) {
+  $1=(int *)(NULL);
+}
+
+%typemap(in, numinputs=0) (int indices[], int maxIndices, int *actualCount) {
+  $3=&($2);
+}
+
+%typemap(freearg) (int indices[], int maxIndices, int *actualCount) {
+   if ($1) free($1);
+}
+
+%typemap(check)(int indices[], int maxIndices, int *actualCount) {
+    $2=helicsFederateGetInputCount(arg1);
+    $1 = (int *) malloc($2*sizeof(int));
+}
+
+%typemap(argout) (int indices[], int maxIndices, int *actualCount) {
+  int i;
+  PyObject *o2=PyList_New(*$3);
+  for (i = 0; i < *$3; i++) {
+    PyList_SetItem(o2, i, PyInt_FromLong($1[i]));
+  }
+  $result = SWIG_Python_AppendOutput($result, o2);
+}
+
+// typemap for updated input value output,  returns a list of indices and a list of values
+%typemap(arginit) (int indices[], double values[], int maxValues, int *actualCount) {
+  $1=(int *)(NULL);
+  $2=(double *)(NULL);
+}
+
+%typemap(in, numinputs=0) (int indices[], double values[], int maxValues, int *actualCount) {
+  $4=&($3);
+}
+
+%typemap(freearg) (int indices[], double values[], int maxValues, int *actualCount) {
+   if ($1) free($1);
+   if ($2) free($2);
+}
+
+%typemap(check)(int indices[], double values[], int maxValues, int *actualCount) {
+    $3=helicsFederateGetInputCount(arg1);
+    $1 = (int *) malloc($3*sizeof(int));
+    $2 = (double *) malloc($3*sizeof(double));
+}
+
+%typemap(argout) (int indices[], double values[], int maxValues, int *actualCount) {
+  int i;
+  PyObject *o2=PyList_New(*$4);
+  PyObject *o3=PyList_New(*$4);
+  for (i = 0; i < *$4; i++) {
+    PyList_SetItem(o2, i, PyInt_FromLong($1[i]));
+    PyList_SetItem(o3, i, PyFloat_FromDouble($2[i]));
+  }
+  $result = SWIG_Python_AppendOutput($result, o2);
+  $result = SWIG_Python_AppendOutput($result, o3);
+}
+
+// typemap for publication index input
+%typemap(in) (const int *publicationIndices, int indexCount) {
+  int i;
+  if (!PyList_Check($input)) {
+    PyErr_SetString(PyExc_ValueError,"Expected a list");
+    return NULL;
+  }
+  $2=(int)(PyList_Size($input));
+  $1 = (int *) malloc($2*sizeof(int));
+
+  for (i = 0; i < $2; i++) {
+    PyObject *o = PyList_GetItem($input,i);
+    if (PyInt_Check(o)) {
+      $1[i] = (int)(PyInt_AsLong(o));
+    } else {
+      PyErr_SetString(PyExc_ValueError,"List elements must be integers");
+      free($1);
+      return NULL;
+    }
+  }
+}
+
+%typemap(argout) (const int *publicationIndices, int indexCount)
+{
+}
+
+%typemap(freearg) (const int *publicationIndices, int indexCount) {
+   if ($1) free($1);
+}
+
+
 // typemap for raw data output function
 %typemap(in, numinputs=0) (void *data, int maxDatalen, int *actualSize) {
   $3=&($2);
@@ -1175,6 +1175,24 @@ bool Federate::getInterfaceOption(interface_handle handle, int32_t option)
     return (coreObject) ? coreObject->getHandleOption(handle, option) : false;
 }
 
+void Federate::setInterfaceOptionValue(
+    interface_handle handle,
+    int32_t option,
+    int32_t option_value)
+{
+    if (coreObject) {
+        coreObject->setHandleOptionValue(handle, option, option_value);
+    } else {
+        throw(InvalidFunctionCall(
+            "interface options cannot be set on uninitialized federate or after finalize call"));
+    }
+}
+
+int32_t Federate::getInterfaceOptionValue(interface_handle handle, int32_t option)
+{
+    return (coreObject) ? coreObject->getHandleOptionValue(handle, option) : 0;
+}
+
 void Federate::closeInterface(interface_handle handle)
 {
     if (coreObject) {
@@ -486,6 +486,10 @@ class HELICS_CXX_EXPORT Federate {
     void setInterfaceOption(interface_handle handle, int32_t option, bool option_value = true);
     /** get the current value for an interface option*/
     bool getInterfaceOption(interface_handle handle, int32_t option);
+    /** set an interface option that takes an integer value*/
+    void setInterfaceOptionValue(interface_handle handle, int32_t option, int32_t option_value);
+    /** get the integer value of an interface option*/
+    int32_t getInterfaceOptionValue(interface_handle handle, int32_t option);
 
     /** get the injection type for an interface,  this is the type for data coming into an interface
     @details for filters this is the input type, for publications this is type used to transmit data, for endpoints
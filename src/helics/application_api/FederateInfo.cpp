@@ -130,6 +130,12 @@ static const std::set<std::string> validFlagOptions{"interruptible",
 
 static const std::map<std::string, int> optionStringsTranslations{
     {"buffer", helics_handle_option_buffer_data},
+    {"delta", helics_handle_option_delta_transmission},
+    {"delta_transmission", helics_handle_option_delta_transmission},
+    {"deltatransmission", helics_handle_option_delta_transmission},
+    {"multi_input_handling_method", helics_handle_option_multi_input_handling_method},
+    {"multiinputhandlingmethod", helics_handle_option_multi_input_handling_method},
+    {"multi_input", helics_handle_option_multi_input_handling_method},
     {"buffer_data", helics_handle_option_buffer_data},
     {"bufferdata", helics_handle_option_buffer_data},
     {"optional", helics_handle_option_connection_optional},
@@ -18,6 +18,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <memory>
 #include <random>
 #include <regex>
+#include <sstream>
 #include <thread>
 
 namespace helics {
@@ -294,10 +295,10 @@ void RerouteFilterOperation::setString(const std::string& property, const std::s
         newDest = val;
     } else if (property == "condition") {
         try {
-            // this line is to verify that it is a valid regex
-            auto test = std::regex(val);
+            // compile the expression once here so it is not rebuilt for every message
+            std::regex reg(val);
             auto cond = conditions.lock();
-            cond->insert(val);
+            cond->emplace(val, std::move(reg));
         }
         catch (const std::regex_error& re) {
             std::cerr << "filter expression is not a valid Regular expression " << re.what()
@@ -313,6 +314,16 @@ std::shared_ptr<FilterOperator> RerouteFilterOperation::getOperator()
     return std::static_pointer_cast<FilterOperator>(op);
 }
 
+static void
+    replaceAllTokens(std::string& str, const std::string& token, const std::string& replacement)
+{
+    auto loc = str.find(token);
+    while (loc != std::string::npos) {
+        str.replace(loc, token.size(), replacement);
+        loc = str.find(token, loc + replacement.size());
+    }
+}
+
 std::string
     newDestGeneration(const std::string& src, const std::string& dest, const std::string& formula)
 {
@@ -320,10 +331,8 @@ std::string
         return formula;
     }
     std::string newDest = formula;
-    std::regex srcreg(R"(\$\{source\})");
-    newDest = std::regex_replace(newDest, srcreg, src);
-    std::regex destreg(R"(\$\{dest\})");
-    newDest = std::regex_replace(newDest, destreg, dest);
+    replaceAllTokens(newDest, "${source}", src);
+    replaceAllTokens(newDest, "${dest}", dest);
     return newDest;
 }
 
@@ -336,26 +345,216 @@ std::string
     }
 
     for (auto& sr : *cond) {
-        std::regex reg(sr);
-        if (std::regex_search(dest, reg, std::regex_constants::match_any)) {
+        if (std::regex_search(dest, sr.second, std::regex_constants::match_any)) {
             return newDestGeneration(src, dest, newDest.load());
         }
     }
     return dest;
 }
 
+bool FirewallRuleTable::NamePattern::matches(const std::string& name) const
+{
+    switch (type) {
+        case pattern_type::any:
+        default:
+            return true;
+        case pattern_type::exact:
+            return (name == text);
+        case pattern_type::prefix:
+            return (name.compare(0, text.size(), text) == 0);
+        case pattern_type::regex:
+            return std::regex_search(name, expression, std::regex_constants::match_any);
+    }
+}
+
+bool FirewallRuleTable::FirewallRule::matches(const Message& message) const
+{
+    if ((message.data.size() < minSize) || (message.data.size() > maxSize)) {
+        return false;
+    }
+    if ((message.time < minTime) || (message.time > maxTime)) {
+        return false;
+    }
+    return source.matches(message.source) && dest.matches(message.dest);
+}
+
+FirewallRuleTable::NamePattern FirewallRuleTable::compilePattern(const std::string& pattern)
+{
+    NamePattern np;
+    if (pattern.empty() || pattern == "*") {
+        return np;
+    }
+    if (pattern.compare(0, 6, "regex:") == 0) {
+        np.type = pattern_type::regex;
+        np.text = pattern.substr(6);
+        try {
+            np.expression = std::regex(np.text);
+        }
+        catch (const std::regex_error& re) {
+            throw(helics::InvalidParameter(
+                std::string("firewall pattern is not a valid Regular expression ") + re.what()));
+        }
+    } else if (pattern.back() == '*') {
+        np.type = pattern_type::prefix;
+        np.text = pattern.substr(0, pattern.size() - 1);
+    } else {
+        np.type = pattern_type::exact;
+        np.text = pattern;
+    }
+    return np;
+}
+
+static std::size_t loadRuleSize(const std::string& val)
+{
+    try {
+        std::size_t used{0};
+        auto res = std::stoull(val, &used);
+        if (used == val.size()) {
+            return static_cast<std::size_t>(res);
+        }
+    }
+    catch (const std::exception&) {
+    }
+    throw(helics::InvalidParameter(std::string("firewall size ") + val + " is not valid"));
+}
+
+static void addIndexLength(std::vector<std::size_t>& lengths, std::size_t length)
+{
+    auto loc = std::lower_bound(lengths.begin(), lengths.end(), length);
+    if ((loc == lengths.end()) || (*loc != length)) {
+        lengths.insert(loc, length);
+    }
+}
+
+void FirewallRuleTable::addRule(const std::string& ruleString)
+{
+    FirewallRule rule;
+    std::istringstream terms(ruleString);
+    std::string term;
+    while (terms >> term) {
+        auto eq = term.find('=');
+        if (eq == std::string::npos) {
+            throw(helics::InvalidParameter(
+                std::string("firewall rule term ") + term + " is not valid"));
+        }
+        auto key = term.substr(0, eq);
+        auto val = term.substr(eq + 1);
+        if (key == "source") {
+            rule.source = compilePattern(val);
+        } else if ((key == "dest") || (key == "destination")) {
+            rule.dest = compilePattern(val);
+        } else if (key == "minsize") {
+            rule.minSize = loadRuleSize(val);
+        } else if (key == "maxsize") {
+            rule.maxSize = loadRuleSize(val);
+        } else if (key == "mintime") {
+            rule.minTime = gmlc::utilities::loadTimeFromString<Time>(val);
+        } else if (key == "maxtime") {
+            rule.maxTime = gmlc::utilities::loadTimeFromString<Time>(val);
+        } else {
+            throw(helics::InvalidParameter(
+                std::string("firewall rule key ") + key + " is not known"));
+        }
+    }
+    auto index = rules.size();
+    // index the rule by its most selective name pattern
+    if (rule.source.type == pattern_type::exact) {
+        exactSource[rule.source.text].push_back(index);
+    } else if (rule.dest.type == pattern_type::exact) {
+        exactDest[rule.dest.text].push_back(index);
+    } else if (rule.source.type == pattern_type::prefix) {
+        prefixSource[rule.source.text].push_back(index);
+        addIndexLength(sourcePrefixLengths, rule.source.text.size());
+    } else if (rule.dest.type == pattern_type::prefix) {
+        prefixDest[rule.dest.text].push_back(index);
+        addIndexLength(destPrefixLengths, rule.dest.text.size());
+    } else {
+        generalRules.push_back(index);
+    }
+    rules.push_back(std::move(rule));
+}
+
+bool FirewallRuleTable::anyMatch(
+    const ruleIndex& index,
+    const std::string& key,
+    const Message& message) const
+{
+    auto fnd = index.find(key);
+    if (fnd == index.end()) {
+        return false;
+    }
+    for (auto idx : fnd->second) {
+        if (rules[idx].matches(message)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FirewallRuleTable::prefixMatch(
+    const ruleIndex& index,
+    const std::vector<std::size_t>& lengths,
+    const std::string& name,
+    const Message& message) const
+{
+    for (auto length : lengths) {
+        if (length > name.size()) {
+            break;
+        }
+        if (anyMatch(index, name.substr(0, length), message)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FirewallRuleTable::matches(const Message& message) const
+{
+    if (rules.empty()) {
+        return false;
+    }
+    if (anyMatch(exactSource, message.source, message) ||
+        anyMatch(exactDest, message.dest, message)) {
+        return true;
+    }
+    if (prefixMatch(prefixSource, sourcePrefixLengths, message.source, message) ||
+        prefixMatch(prefixDest, destPrefixLengths, message.dest, message)) {
+        return true;
+    }
+    for (auto idx : generalRules) {
+        if (rules[idx].matches(message)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 FirewallFilterOperation::FirewallFilterOperation():
     op(std::make_shared<FirewallOperator>(
         [this](const Message* mess) { return allowPassed(mess); }))
 {
+    // the check function returns true for messages that are allowed through
+    op->setOperation(FirewallOperator::operations::pass);
 }
 
 FirewallFilterOperation::~FirewallFilterOperation() = default;
 
 void FirewallFilterOperation::set(const std::string& /*property*/, double /*val*/) {}
 
-void FirewallFilterOperation::setString(const std::string& /*property*/, const std::string& /*val*/)
+void FirewallFilterOperation::setString(const std::string& property, const std::string& val)
 {
+    if (property == "allow") {
+        // the rule is only added to the table once it has compiled successfully
+        allowed.lock()->addRule(val);
+    } else if ((property == "block") || (property == "deny")) {
+        blocked.lock()->addRule(val);
+    } else if (property == "clear") {
+        *allowed.lock() = FirewallRuleTable();
+        *blocked.lock() = FirewallRuleTable();
+    } else {
+        throw(helics::InvalidParameter(
+            std::string("property " + property + " is not a known property")));
+    }
 }
 
 std::shared_ptr<FilterOperator> FirewallFilterOperation::getOperator()
@@ -363,9 +562,13 @@ std::shared_ptr<FilterOperator> FirewallFilterOperation::getOperator()
     return std::static_pointer_cast<FilterOperator>(op);
 }
 
-bool FirewallFilterOperation::allowPassed(const Message* /*mess*/) const
+bool FirewallFilterOperation::allowPassed(const Message* mess) const
 {
-    return true;
+    if (blocked.lock_shared()->matches(*mess)) {
+        return false;
+    }
+    auto allow = allowed.lock_shared();
+    return (allow->empty() || allow->matches(*mess));
 }
 
 CloneFilterOperation::CloneFilterOperation():
@@ -15,8 +15,11 @@ file defines some common filter operations
 #include "gmlc/libguarded/cow_guarded.hpp"
 
 #include <atomic>
-#include <set>
+#include <limits>
+#include <map>
+#include <regex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace helics {
@@ -103,8 +106,8 @@ class RerouteFilterOperation: public FilterOperations {
   private:
     std::shared_ptr<MessageDestOperator> op; //!< the actual operator
     atomic_guarded<std::string> newDest; //!< the target destination
-    shared_guarded<std::set<std::string>>
-        conditions; //!< the conditions on which the rerouting will occur
+    shared_guarded<std::map<std::string, std::regex>>
+        conditions; //!< the compiled conditions on which the rerouting will occur
 
   public:
     RerouteFilterOperation();
@@ -118,14 +121,75 @@ class RerouteFilterOperation: public FilterOperations {
     std::string rerouteOperation(const std::string& src, const std::string& dest) const;
 };
 
-/** filter for rerouting a packet to a particular endpoint*/
+/** a compiled table of firewall rules
+@details a rule is a whitespace separated list of key=value terms, the keys are source, dest, minsize, maxsize,
+mintime, and maxtime, any term not given matches everything.  The source and dest patterns are an exact name, a
+name ending in '*' to match a prefix, '*' to match anything, or "regex:" followed by a regular expression to
+search for.  Rules with an exact or prefix name are indexed by that name so the number of rules examined for a
+message does not grow with the size of the table,  only rules without a name pattern or with a regular
+expression are checked in sequence*/
+class FirewallRuleTable {
+  public:
+    FirewallRuleTable() = default;
+    /** compile a rule string and add it to the table
+    @throw InvalidParameter if the rule is not valid*/
+    void addRule(const std::string& ruleString);
+    /** check if a message matches any rule in the table*/
+    bool matches(const Message& message) const;
+    /** get the number of rules in the table*/
+    std::size_t size() const { return rules.size(); }
+    /** check if the table has no rules*/
+    bool empty() const { return rules.empty(); }
+
+  private:
+    /** enumeration of the kinds of name patterns*/
+    enum class pattern_type { any, exact, prefix, regex };
+    /** a compiled name pattern*/
+    struct NamePattern {
+        pattern_type type{pattern_type::any};
+        std::string text; //!< the exact name or prefix
+        std::regex expression; //!< the compiled expression for regex patterns
+        bool matches(const std::string& name) const;
+    };
+    /** a single compiled rule*/
+    struct FirewallRule {
+        NamePattern source;
+        NamePattern dest;
+        std::size_t minSize{0};
+        std::size_t maxSize{(std::numeric_limits<std::size_t>::max)()};
+        Time minTime{Time::minVal()};
+        Time maxTime{Time::maxVal()};
+        bool matches(const Message& message) const;
+    };
+    /** an index from a name or prefix to the rules using it*/
+    using ruleIndex = std::unordered_map<std::string, std::vector<std::size_t>>;
+    bool anyMatch(const ruleIndex& index, const std::string& key, const Message& message) const;
+    bool prefixMatch(
+        const ruleIndex& index,
+        const std::vector<std::size_t>& lengths,
+        const std::string& name,
+        const Message& message) const;
+    static NamePattern compilePattern(const std::string& pattern);
+
+    std::vector<FirewallRule> rules; //!< all the compiled rules
+    ruleIndex exactSource; //!< rules indexed by an exact source name
+    ruleIndex exactDest; //!< rules indexed by an exact destination name
+    ruleIndex prefixSource; //!< rules indexed by a source prefix
+    ruleIndex prefixDest; //!< rules indexed by a destination prefix
+    std::vector<std::size_t> sourcePrefixLengths; //!< the distinct lengths of the source prefixes
+    std::vector<std::size_t> destPrefixLengths; //!< the distinct lengths of the destination prefixes
+    std::vector<std::size_t> generalRules; //!< rules that must be checked for every message
+};
+
+/** filter for allowing or blocking messages based on a set of rules
+@details a message is blocked if it matches any block rule, otherwise it is passed if there are no allow rules
+or it matches an allow rule*/
 class FirewallFilterOperation: public FilterOperations {
   private:
     std::shared_ptr<FirewallOperator> op; //!< the actual operator
-    gmlc::libguarded::cow_guarded<std::vector<std::string>>
-        allowed; //!< the conditions on which the rerouting will occur
-    gmlc::libguarded::cow_guarded<std::vector<std::string>>
-        blocked; //!< the conditions that block a message
+    gmlc::libguarded::cow_guarded<FirewallRuleTable>
+        allowed; //!< the rules for messages that are allowed through
+    gmlc::libguarded::cow_guarded<FirewallRuleTable> blocked; //!< the rules that block a message
   public:
     FirewallFilterOperation();
     ~FirewallFilterOperation();
@@ -134,7 +198,7 @@ class FirewallFilterOperation: public FilterOperations {
     virtual std::shared_ptr<FilterOperator> getOperator() override;
 
   private:
-    /** function to execute the rerouting operation*/
+    /** function to check whether a message is allowed through the firewall*/
     bool allowPassed(const Message* mess) const;
 };
 
@@ -190,10 +190,47 @@ data_view Input::getRawValue()
     return fed->getValueRaw(*this);
 }
 
+vector_view<double> Input::getVectorView()
+{
+    if (!changeDetectionEnabled && (fed->isUpdated(*this) || hasUpdate || viewedUpdate)) {
+        if (type == data_type::helics_unknown) {
+            loadSourceInformation();
+        }
+        if (type == data_type::helics_vector) {
+            auto dv = fed->getValueRaw(*this);
+            if (!dv.empty()) {
+                // lastValue is not updated so the next getValue call extracts from the raw data
+                hasUpdate = false;
+                viewedUpdate = true;
+                return dv.doubleVector();
+            }
+        }
+    }
+    return vector_view<double>(getValue<std::vector<double>>());
+}
+
+vector_view<std::complex<double>> Input::getComplexVectorView()
+{
+    if (!changeDetectionEnabled && (fed->isUpdated(*this) || hasUpdate || viewedUpdate)) {
+        if (type == data_type::helics_unknown) {
+            loadSourceInformation();
+        }
+        if (type == data_type::helics_complex_vector) {
+            auto dv = fed->getValueRaw(*this);
+            if (!dv.empty()) {
+                hasUpdate = false;
+                viewedUpdate = true;
+                return dv.complexVector();
+            }
+        }
+    }
+    return vector_view<std::complex<double>>(getValue<std::vector<std::complex<double>>>());
+}
+
 size_t Input::getStringSize()
 {
     isUpdated();
-    if (hasUpdate && !changeDetectionEnabled) {
+    if ((hasUpdate || viewedUpdate) && !changeDetectionEnabled) {
         if (lastValue.index() == named_point_loc) {
             auto& np = getValueRef<NamedPoint>();
             if (np.name.empty()) {
@@ -227,7 +264,7 @@ size_t Input::getStringSize()
 size_t Input::getVectorSize()
 {
     isUpdated();
-    if (hasUpdate && !changeDetectionEnabled) {
+    if ((hasUpdate || viewedUpdate) && !changeDetectionEnabled) {
         auto& out = getValueRef<std::vector<double>>();
         return out.size();
     }
@@ -288,7 +325,8 @@ void integerExtractAndConvert(
 
 char Input::getValueChar()
 {
-    if (fed->isUpdated(*this) || (hasUpdate && !changeDetectionEnabled)) {
+    if (fed->isUpdated(*this) || (hasUpdate && !changeDetectionEnabled) || viewedUpdate) {
+        viewedUpdate = false;
         auto dv = fed->getValueRaw(*this);
         if (type == data_type::helics_unknown) {
             type = getTypeFromString(fed->getInjectionType(*this));
@@ -329,7 +367,7 @@ char Input::getValueChar()
 
 int Input::getValue(double* data, int maxsize)
 {
-    auto V = getValueRef<std::vector<double>>();
+    auto V = getVectorView();
     int length = 0;
     if (data != nullptr && maxsize > 0) {
         length = std::min(static_cast<int>(V.size()), maxsize);
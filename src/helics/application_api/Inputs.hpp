@@ -9,6 +9,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "HelicsPrimaryTypes.hpp"
 #include "ValueFederate.hpp"
 #include "helicsTypes.hpp"
+#include "vector_view.hpp"
 
 #include <memory>
 
@@ -29,6 +30,7 @@ class HELICS_CXX_EXPORT Input {
     data_type type = data_type::helics_unknown; //!< the underlying type the publication is using
     bool changeDetectionEnabled = false; //!< the change detection is enabled
     bool hasUpdate = false; //!< the value has been updated
+    bool viewedUpdate = false; //!< the latest value was read through a view and lastValue is out of date
     bool disableAssign = false; //!< disable assignment for the object
     size_t customTypeHash = 0; //!< a hash code for the custom type
     defV lastValue; //!< the last value updated
@@ -232,6 +234,16 @@ class HELICS_CXX_EXPORT Input {
 
     /** get the current value of a flag for the handle*/
     bool getOption(int32_t option) const { return fed->getInterfaceOption(handle, option); }
+    /** set a handle option that takes an integer value such as the multi input handling method*/
+    void setOptionValue(int32_t option, int32_t value)
+    {
+        fed->setInterfaceOptionValue(handle, option, value);
+    }
+    /** get the integer value of an option for the handle*/
+    int32_t getOptionValue(int32_t option) const
+    {
+        return fed->getInterfaceOptionValue(handle, option);
+    }
     /** check if the value has been updated
     @details if changeDetection is Enabled this function also loads the value into the buffer
     @param assumeUpdate if set to true will assume there was a publication and not check it first, if set to
@@ -409,6 +421,14 @@ class HELICS_CXX_EXPORT Input {
 
     /** get the raw binary data*/
     data_view getRawValue();
+    /** get a read only view of the most recent value as a vector of doubles
+    @details if the source publishes vectors of doubles the view references the received data without copying
+    it,  other values are converted and held by the view*/
+    vector_view<double> getVectorView();
+    /** get a read only view of the most recent value as a vector of complex values
+    @details if the source publishes vectors of complex values the view references the received data without
+    copying it,  other values are converted and held by the view*/
+    vector_view<std::complex<double>> getComplexVectorView();
     /** get the size of the raw data*/
     size_t getRawSize();
     /** get the size of the data if it were a string*/
@@ -518,7 +538,8 @@ class InputT: public Input {
 template<class X>
 void Input::getValue_impl(std::integral_constant<int, primaryType> /*V*/, X& out)
 {
-    if (fed->isUpdated(*this) || (hasUpdate && !changeDetectionEnabled)) {
+    if (fed->isUpdated(*this) || (hasUpdate && !changeDetectionEnabled) || viewedUpdate) {
+        viewedUpdate = false;
         auto dv = fed->getValueRaw(*this);
         if (type == data_type::helics_unknown) {
             loadSourceInformation();
@@ -573,7 +594,8 @@ const X& Input::getValueRef()
     static_assert(
         std::is_same<typeCategory<X>, std::integral_constant<int, primaryType>>::value,
         "calling getValue By ref must be with a primary type");
-    if (fed->isUpdated(*this) || (hasUpdate && !changeDetectionEnabled)) {
+    if (fed->isUpdated(*this) || (hasUpdate && !changeDetectionEnabled) || viewedUpdate) {
+        viewedUpdate = false;
         auto dv = fed->getValueRaw(*this);
         if (type == data_type::helics_unknown) {
             loadSourceInformation();
@@ -9,10 +9,121 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "ValueConverter_impl.hpp"
 
+#include "../core/NativeVectorLayout.hpp"
+
 #include <complex>
+#include <cstdint>
 #include <vector>
 
 namespace helics {
+/** store a sequence of values in the native vector layout*/
+template<class X>
+static void nativeVectorConvert(const X* vals, size_t size, data_block& store)
+{
+    store.resize(native_vector::headerSize + size * sizeof(X));
+    native_vector::writeHeader(store.data(), size, sizeof(X));
+    if (size > 0) {
+        std::memcpy(store.data() + native_vector::headerSize, vals, size * sizeof(X));
+    }
+}
+
+/** extract a vector stored in the native vector layout or written by the portable binary archive*/
+template<class X>
+static void nativeVectorInterpret(const data_view& block, std::vector<X>& val)
+{
+    std::size_t count{0};
+    bool swap{false};
+    if (!native_vector::readHeader(block.data(), block.size(), sizeof(X), count, swap)) {
+        if (block.size() < getMinSize<std::vector<X>>()) {
+            throw std::invalid_argument("invalid data size");
+        }
+        detail::archiveInterpret(block, val);
+        return;
+    }
+    val.resize(count);
+    if (count == 0) {
+        return;
+    }
+    const char* loc = block.data() + native_vector::headerSize;
+    if (swap) {
+        native_vector::copySwapped(val.data(), loc, count * sizeof(X));
+    } else {
+        std::memcpy(val.data(), loc, count * sizeof(X));
+    }
+}
+
+/** generate a view of a vector,  referencing the data in place if it is in the native layout and aligned*/
+template<class X>
+static vector_view<X> nativeVectorView(const data_view& block)
+{
+    std::size_t count{0};
+    bool swap{false};
+    if (native_vector::readHeader(block.data(), block.size(), sizeof(X), count, swap) && !swap) {
+        const char* loc = block.data() + native_vector::headerSize;
+        if (reinterpret_cast<std::uintptr_t>(loc) % alignof(X) == 0) {
+            return vector_view<X>(reinterpret_cast<const X*>(loc), count, block.reference());
+        }
+    }
+    std::vector<X> vals;
+    nativeVectorInterpret(block, vals);
+    return vector_view<X>(std::move(vals));
+}
+
+template<>
+void ValueConverter<double>::convert(const double* vals, size_t size, data_block& store)
+{
+    nativeVectorConvert(vals, size, store);
+}
+
+template<>
+void ValueConverter<std::complex<double>>::convert(
+    const std::complex<double>* vals,
+    size_t size,
+    data_block& store)
+{
+    nativeVectorConvert(vals, size, store);
+}
+
+template<>
+void ValueConverter<std::vector<double>>::convert(const std::vector<double>& val, data_block& store)
+{
+    nativeVectorConvert(val.data(), val.size(), store);
+}
+
+template<>
+void ValueConverter<std::vector<std::complex<double>>>::convert(
+    const std::vector<std::complex<double>>& val,
+    data_block& store)
+{
+    nativeVectorConvert(val.data(), val.size(), store);
+}
+
+template<>
+void ValueConverter<std::vector<double>>::interpret(
+    const data_view& block,
+    std::vector<double>& val)
+{
+    nativeVectorInterpret(block, val);
+}
+
+template<>
+void ValueConverter<std::vector<std::complex<double>>>::interpret(
+    const data_view& block,
+    std::vector<std::complex<double>>& val)
+{
+    nativeVectorInterpret(block, val);
+}
+
+vector_view<double> doubleVectorView(const data_view& dv)
+{
+    return nativeVectorView<double>(dv);
+}
+
+vector_view<std::complex<double>> complexVectorView(const data_view& dv)
+{
+    return nativeVectorView<std::complex<double>>(dv);
+}
+
 template class ValueConverter<int64_t>;
 template class ValueConverter<uint64_t>;
 template class ValueConverter<char>;
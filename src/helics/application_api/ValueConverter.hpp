@@ -15,7 +15,9 @@ the purpose of these objects are to convert a specific type into a data block fo
 #include "data_view.hpp"
 #include "helicsTypes.hpp"
 
+#include <complex>
 #include <string>
+#include <vector>
 namespace helics {
 /** converter for a basic value*/
 template<class X>
@@ -44,6 +46,32 @@ class ValueConverter {
     static std::string type() { return typeNameString<X>(); }
 };
 
+/* vectors of doubles and complex values are stored in the native vector layout so they can be viewed in place,
+the specializations are defined in ValueConverter.cpp*/
+template<>
+HELICS_CXX_EXPORT void
+    ValueConverter<double>::convert(const double* vals, size_t size, data_block& store);
+template<>
+HELICS_CXX_EXPORT void ValueConverter<std::complex<double>>::convert(
+    const std::complex<double>* vals,
+    size_t size,
+    data_block& store);
+template<>
+HELICS_CXX_EXPORT void
+    ValueConverter<std::vector<double>>::convert(const std::vector<double>& val, data_block& store);
+template<>
+HELICS_CXX_EXPORT void ValueConverter<std::vector<std::complex<double>>>::convert(
+    const std::vector<std::complex<double>>& val,
+    data_block& store);
+template<>
+HELICS_CXX_EXPORT void ValueConverter<std::vector<double>>::interpret(
+    const data_view& block,
+    std::vector<double>& val);
+template<>
+HELICS_CXX_EXPORT void ValueConverter<std::vector<std::complex<double>>>::interpret(
+    const data_view& block,
+    std::vector<std::complex<double>>& val);
+
 /** converter for a single string value*/
 template<>
 class ValueConverter<std::string> {
@@ -183,6 +183,20 @@ namespace detail {
     struct ostreambuf: public std::streambuf {
         ostreambuf(char* buf, size_t size) { this->setg(buf, buf, buf + size); }
     };
+
+    /** read a value from a portable binary archive*/
+    template<class X>
+    void archiveInterpret(const data_view& block, X& val)
+    {
+        detail::imemstream s(block.data(), block.size());
+        retriever ia(s);
+        try {
+            ia(val);
+        }
+        catch (const cereal::Exception& ce) {
+            throw std::invalid_argument(ce.what());
+        }
+    }
 } // namespace detail
 
 template<class X>
@@ -300,14 +314,7 @@ void ValueConverter<X>::interpret(const data_view& block, X& val)
     if (block.size() < getMinSize<X>()) {
         throw std::invalid_argument("invalid data size");
     }
-    detail::imemstream s(block.data(), block.size());
-    retriever ia(s);
-    try {
-        ia(val);
-    }
-    catch (const cereal::Exception& ce) {
-        throw std::invalid_argument(ce.what());
-    }
+    detail::archiveInterpret(block, val);
 }
 
 template<class X>
@@ -15,9 +15,11 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "Inputs.hpp"
 #include "Publications.hpp"
 #include "ValueFederateManager.hpp"
+#include "gmlc/utilities/stringOps.h"
 #include "helicsTypes.hpp"
 
 #include <deque>
+#include <map>
 #include <utility>
 
 namespace helics {
@@ -207,6 +209,30 @@ static void loadOptions(ValueFederate* fed, const Inp& data, Obj& objUpdate)
     });
 }
 
+static const std::map<std::string, int32_t> multiInputModes{
+    {"none", helics_multi_input_no_op},
+    {"no_op", helics_multi_input_no_op},
+    {"vectorize", helics_multi_input_vectorize_operation},
+    {"sum", helics_multi_input_sum_operation},
+    {"max", helics_multi_input_max_operation},
+    {"min", helics_multi_input_min_operation},
+    {"average", helics_multi_input_average_operation},
+    {"mean", helics_multi_input_average_operation}};
+
+template<class Inp>
+static void loadInputOptions(const Inp& data, Input& inp)
+{
+    auto method = getOrDefault(data, "multi_input_handling_method", emptyStr);
+    if (!method.empty()) {
+        gmlc::utilities::makeLowerCase(method);
+        auto fnd = multiInputModes.find(method);
+        if (fnd == multiInputModes.end()) {
+            throw(InvalidParameter(method + " is not a recognized multi input handling method"));
+        }
+        inp.setOptionValue(defs::options::multi_input_handling_method, fnd->second);
+    }
+}
+
 void ValueFederate::registerValueInterfacesJson(const std::string& jsonString)
 {
     auto doc = loadJson(jsonString);
@@ -266,6 +292,7 @@ void ValueFederate::registerValueInterfacesJson(const std::string& jsonString)
                 inp = &registerInput(key, type, units);
             }
             loadOptions(this, ipt, *inp);
+            loadInputOptions(ipt, *inp);
         }
     }
 }
@@ -350,6 +377,7 @@ void ValueFederate::registerValueInterfacesToml(const std::string& tomlString)
                 id = &registerInput(key, type, units);
             }
             loadOptions(this, ipt, *id);
+            loadInputOptions(ipt, *id);
         }
     }
 }
@@ -11,6 +11,9 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../core/queryHelpers.hpp"
 #include "Inputs.hpp"
 #include "Publications.hpp"
+
+#include <algorithm>
+
 namespace helics {
 ValueFederateManager::ValueFederateManager(Core* coreOb, ValueFederate* vfed, local_federate_id id):
     coreObject(coreOb), fed(vfed), fedID(id)
@@ -237,6 +240,10 @@ void ValueFederateManager::updateTime(Time newTime, Time /*oldTime*/)
             iData->lastData = std::move(data);
             iData->lastUpdate = CurrentTime;
             iData->hasUpdate = true;
+            if (!iData->listed) {
+                iData->listed = true;
+                updatedInputs.push_back(fid->referenceIndex);
+            }
             bool updated = fid->checkUpdate(true);
             if (updated) {
                 if (iData->callback) {
@@ -341,14 +348,23 @@ std::string ValueFederateManager::localQuery(const std::string& queryStr) const
 std::vector<int> ValueFederateManager::queryUpdates()
 {
     std::vector<int> updates;
-    auto inpHandle = inputs.lock_shared();
-    int ii = 0;
-    for (auto& inp : *inpHandle) {
+    auto inpHandle = inputs.lock();
+    // only the inputs updated since the last query need to be checked
+    auto keep = updatedInputs.begin();
+    for (auto index : updatedInputs) {
+        auto& inp = (*inpHandle)[index];
+        auto iData = reinterpret_cast<input_info*>(inp.dataReference);
         if (inp.hasUpdate) {
-            updates.push_back(ii);
+            updates.push_back(index);
+        }
+        if (inp.hasUpdate || iData->hasUpdate) {
+            *keep++ = index;
+        } else {
+            iData->listed = false;
         }
-        ++ii;
     }
+    updatedInputs.erase(keep, updatedInputs.end());
+    std::sort(updates.begin(), updates.end());
     return updates;
 }
 
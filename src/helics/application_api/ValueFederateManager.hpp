@@ -53,6 +53,7 @@ struct input_info {
 
     std::function<void(Input&, Time)> callback; //!< callback to trigger on update
     bool hasUpdate = false; //!< indicator that there was an update
+    bool listed = false; //!< indicator that the input is in the updated input list
     input_info(const std::string& n_name, const std::string& n_type, const std::string& n_units):
         name(n_name), type(n_type), units(n_units){};
 };
@@ -203,6 +204,8 @@ class ValueFederateManager {
         gmlc::containers::
             DualMappedVector<Input, std::string, interface_handle, reference_stability::stable>>
         inputs;
+    std::vector<int>
+        updatedInputs; //!< indices of inputs updated since the last query (guarded by inputs)
     shared_guarded_m<gmlc::containers::DualMappedVector<
         Publication,
         std::string,
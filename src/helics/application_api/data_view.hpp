@@ -11,10 +11,26 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/external/string_view.hpp"
 #include "helics/helics-config.h"
 #include "helicsTypes.hpp"
+#include "vector_view.hpp"
 
+#include <complex>
 #include <memory>
 
 namespace helics {
+class data_view;
+/** get a view of the data as a vector of doubles
+@details data in the native vector layout with the byte order of this machine is referenced directly,  other
+layouts are converted into storage held by the view
+@throw std::invalid_argument if the data is not a valid vector
+*/
+HELICS_CXX_EXPORT vector_view<double> doubleVectorView(const data_view& dv);
+/** get a view of the data as a vector of complex values
+@details data in the native vector layout with the byte order of this machine is referenced directly,  other
+layouts are converted into storage held by the view
+@throw std::invalid_argument if the data is not a valid vector
+*/
+HELICS_CXX_EXPORT vector_view<std::complex<double>> complexVectorView(const data_view& dv);
+
 /** class containing a constant view of data block*/
 class data_view {
   private:
@@ -107,6 +123,12 @@ class data_view {
     @details this actually does a copy to a new string
     */
     std::string string() const { return dblock.to_string(); }
+    /** get the shared reference to the data being viewed,  null if the view does not hold one*/
+    const std::shared_ptr<const data_block>& reference() const noexcept { return ref; }
+    /** get a view of the data as a vector of doubles without copying it if possible*/
+    vector_view<double> doubleVector() const { return doubleVectorView(*this); }
+    /** get a view of the data as a vector of complex values without copying it if possible*/
+    vector_view<std::complex<double>> complexVector() const { return complexVectorView(*this); }
     /** random access operator*/
     char operator[](int index) const { return dblock[index]; }
     /** begin iterator*/
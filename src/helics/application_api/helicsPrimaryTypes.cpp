@@ -9,6 +9,7 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "../utilities/timeStringOps.hpp"
 #include "ValueConverter.hpp"
+#include "textCodec.hpp"
 
 #include <set>
 namespace helics {
@@ -175,10 +176,10 @@ void valueExtract(const defV& dv, std::string& val)
 {
     switch (dv.index()) {
         case double_loc: // double
-            val = std::to_string(mpark::get<double>(dv));
+            val = text_codec::doubleString(mpark::get<double>(dv));
             break;
         case int_loc: // int64_t
-            val = std::to_string(mpark::get<int64_t>(dv));
+            val = text_codec::integerString(mpark::get<int64_t>(dv));
             break;
         case string_loc: // string
         default:
@@ -516,13 +517,13 @@ void valueExtract(const data_view& dv, data_type baseType, std::string& val)
     switch (baseType) {
         case data_type::helics_double: {
             auto V = ValueConverter<double>::interpret(dv);
-            val = std::to_string(V);
+            val = text_codec::doubleString(V);
             break;
         }
         case data_type::helics_int:
         case data_type::helics_time: {
             auto V = ValueConverter<int64_t>::interpret(dv);
-            val = std::to_string(V);
+            val = text_codec::integerString(V);
             break;
         }
         case data_type::helics_string:
@@ -10,10 +10,11 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "ValueConverter.hpp"
 #include "gmlc/utilities/demangle.hpp"
 #include "gmlc/utilities/stringConversion.h"
+#include "textCodec.hpp"
 
 #include <algorithm>
 #include <numeric>
-#include <regex>
+#include <stdexcept>
 #include <unordered_map>
 
 using namespace gmlc::utilities;
@@ -71,12 +72,9 @@ double vectorNorm(const std::vector<std::complex<double>>& vec)
 
 std::string helicsComplexString(double real, double imag)
 {
-    std::stringstream ss;
-    ss << real;
-    if (imag != 0.0) {
-        ss << ((imag >= 0.0) ? '+' : ' ') << imag << 'j';
-    }
-    return ss.str();
+    std::string str;
+    text_codec::appendComplex(str, real, imag);
+    return str;
 }
 
 std::string helicsComplexString(std::complex<double> val)
@@ -187,80 +185,43 @@ data_type getTypeFromString(const std::string& typeName)
     return res->second;
 }
 
-// regular expression to handle complex numbers of various formats
-const std::regex creg(
-    R"(([+-]?(\d+(\.\d+)?|\.\d+)([eE][+-]?\d+)?)\s*([+-]\s*(\d+(\.\d+)?|\.\d+)([eE][+-]?\d+)?)[ji]*)");
+/** the real part returned for strings that do not contain a number*/
+static constexpr double invalidReal{-1e49};
 
-std::complex<double> helicsGetComplex(const std::string& val)
+/** parse a complex number from a section of a string,  returning the invalid value if there isn't one*/
+static std::complex<double> readComplex(const char* start, const char* end)
 {
-    if (val.empty()) {
-        return {-1e49, -1e49};
+    std::complex<double> V;
+    if (!text_codec::parseComplex(start, end, V)) {
+        return {invalidReal, 0.0};
     }
-    std::smatch m;
-    double re = -1e49;
-    double im = 0.0;
-    std::regex_search(val, m, creg);
-    try {
-        if (m.size() == 9) {
-            re = numConv<double>(m[1]);
-
-            im = numConv<double>(m[6]);
+    return V;
+}
 
-            if (*m[5].first == '-') {
-                im = -im;
-            }
-        } else {
-            if ((val.back() == 'j') || (val.back() == 'i')) {
-                auto strval = val.substr(0, val.size() - 1);
-                stringOps::trimString(strval);
-                im = numConv<double>(strval);
-                re = 0.0;
-            } else {
-                auto strval = val;
-                stringOps::trimString(strval);
-                re = numConv<double>(strval);
-            }
-        }
-    }
-    catch (const std::invalid_argument&) {
-        re = -1e49;
+std::complex<double> helicsGetComplex(const std::string& val)
+{
+    if (val.empty()) {
+        return {invalidReal, invalidReal};
     }
-    return {re, im};
+    return readComplex(val.data(), val.data() + val.size());
 }
 
 std::string helicsVectorString(const std::vector<double>& val)
 {
-    std::string vString("v");
-    vString.append(std::to_string(val.size()));
-    vString.push_back('[');
-    for (const auto& v : val) {
-        vString.append(std::to_string(v));
-        vString.push_back(';');
-        vString.push_back(' ');
-    }
-    if (vString.size() > 3) // 3 for v0[ which would be for an empty vector
-    {
-        vString.pop_back();
-        vString.pop_back();
-    }
-    vString.push_back(']');
-    return vString;
+    return helicsVectorString(val.data(), val.size());
 }
 
 std::string helicsVectorString(const double* vals, size_t size)
 {
     std::string vString("v");
-    vString.append(std::to_string(size));
+    text_codec::appendInteger(vString, static_cast<std::int64_t>(size));
     vString.push_back('[');
     for (size_t ii = 0; ii < size; ++ii) {
-        vString.append(std::to_string(vals[ii]));
-        vString.push_back(';');
-        vString.push_back(' ');
-    }
-    if (vString.size() > 3) // 3 for c0[ which would be for an empty vector
-    {
-        vString.pop_back();
-        vString.pop_back();
+        if (ii > 0) {
+            vString.push_back(';');
+            vString.push_back(' ');
+        }
+        text_codec::appendDouble(vString, vals[ii]);
     }
     vString.push_back(']');
     return vString;
@@ -269,16 +230,14 @@ std::string helicsVectorString(const double* vals, size_t size)
 std::string helicsComplexVectorString(const std::vector<std::complex<double>>& val)
 {
     std::string vString("c");
-    vString.append(std::to_string(val.size()));
+    text_codec::appendInteger(vString, static_cast<std::int64_t>(val.size()));
     vString.push_back('[');
-    for (const auto& v : val) {
-        vString.append(helicsComplexString(v.real(), v.imag()));
-        vString.push_back(';');
-        vString.push_back(' ');
-    }
-    if (vString.size() > 3) {
-        vString.pop_back();
-        vString.pop_back();
+    for (size_t ii = 0; ii < val.size(); ++ii) {
+        if (ii > 0) {
+            vString.push_back(';');
+            vString.push_back(' ');
+        }
+        text_codec::appendComplex(vString, val[ii].real(), val[ii].imag());
     }
     vString.push_back(']');
     return vString;
@@ -298,7 +257,7 @@ std::string helicsNamedPointString(const std::string& pointName, double val)
     }
     retStr.push_back('"');
     retStr.push_back(':');
-    retStr.append(std::to_string(val));
+    text_codec::appendDouble(retStr, val);
     retStr.push_back('}');
     return retStr;
 }
@@ -313,7 +272,7 @@ std::string helicsNamedPointString(const char* pointName, double val)
     }
     retStr.push_back('"');
     retStr.push_back(':');
-    retStr.append(std::to_string(val));
+    text_codec::appendDouble(retStr, val);
     retStr.push_back('}');
     return retStr;
 }
@@ -351,34 +310,71 @@ NamedPoint helicsGetNamedPoint(const std::string& val)
     }
     auto locsep = val.find_last_of(':');
     auto locend = val.find_last_of('}');
+    if (locsep == std::string::npos) {
+        throw std::invalid_argument("unable to read the value of the named point");
+    }
     auto str1 = val.substr(loc + 1, locsep - loc);
     stringOps::trimString(str1);
     str1.pop_back();
 
     NamedPoint point;
     point.name = stringOps::removeQuotes(str1);
-    auto vstr = val.substr(locsep + 1, locend - locsep - 1);
-    stringOps::trimString(vstr);
-    point.value = numConv<double>(vstr);
+    const char* vstart = val.data() + locsep + 1;
+    const char* vend = (locend == std::string::npos || locend < locsep) ? val.data() + val.size() :
+                                                                          val.data() + locend;
+    if (text_codec::parseDouble(vstart, vend, point.value) == vstart) {
+        throw std::invalid_argument("unable to read the value of the named point");
+    }
     return point;
 }
 
-static int readSize(const std::string& val)
+/** read the number of elements in a vector string,  either from the stated size or by counting the elements*/
+static size_t readSize(const std::string& val)
 {
     auto fb = val.find_first_of('[');
+    if (fb == std::string::npos) {
+        return 0;
+    }
     if (fb > 1) {
-        try {
-            auto size = std::stoi(val.substr(1, fb - 1));
+        size_t size{0};
+        const char* sizeStart = val.data() + 1;
+        if (text_codec::parseSize(sizeStart, val.data() + fb, size) != sizeStart) {
             return size;
         }
-        catch (const std::invalid_argument&) {
-            // go to the alternative path if this fails
-        }
     }
     auto res = std::count_if(
                    val.begin() + fb, val.end(), [](auto c) { return (c == ',') || (c == ';'); }) +
         1;
-    return static_cast<int>(res);
+    return static_cast<size_t>(res);
+}
+
+/** get a pointer to the first element of a vector string*/
+static const char* firstElement(const std::string& val)
+{
+    auto fb = val.find_first_of('[');
+    return (fb == std::string::npos) ? val.data() + val.size() : val.data() + fb + 1;
+}
+
+/** find the separator after an element of a vector string*/
+static const char* nextSeparator(const char* pos, const char* end)
+{
+    return std::find_if(pos, end, [](char c) { return (c == ',') || (c == ';') || (c == ']'); });
+}
+
+/** move past a separator to the next element,  the closing bracket ends the sequence*/
+static const char* nextElement(const char* sep, const char* end)
+{
+    return (sep == end || *sep == ']') ? end : sep + 1;
+}
+
+/** read a double element of a vector string*/
+static double readElement(const char* start, const char* end)
+{
+    double V{invalidReal};
+    if (text_codec::parseDouble(start, end, V) == start) {
+        return invalidReal;
+    }
+    return V;
 }
 
 std::complex<double> getComplexFromString(const std::string& val)
@@ -426,35 +422,30 @@ void helicsGetVector(const std::string& val, std::vector<double>& data)
 {
     if (val.empty()) {
         data.resize(0);
+        return;
     }
+    const char* end = val.data() + val.size();
     if (val.front() == 'v') {
         auto sz = readSize(val);
-        if (sz > 0) {
-            data.reserve(sz);
-        }
         data.resize(0);
-        auto fb = val.find_first_of('[');
-        for (decltype(sz) ii = 0; ii < sz; ++ii) {
-            auto nc = val.find_first_of(";,]", fb + 1);
-
-            std::string vstr = val.substr(fb + 1, nc - fb - 1);
-            stringOps::trimString(vstr);
-            auto V = numeric_conversion<double>(vstr, -1e49);
-            data.push_back(V);
-
-            fb = nc;
+        data.reserve(std::min(sz, val.size()));
+        const char* cur = firstElement(val);
+        for (decltype(sz) ii = 0; ii < sz && cur != end; ++ii) {
+            const char* sep = nextSeparator(cur, end);
+            data.push_back(readElement(cur, sep));
+            cur = nextElement(sep, end);
         }
     } else if (val.front() == 'c') {
         auto sz = readSize(val);
-        data.reserve(sz * 2);
         data.resize(0);
-        auto fb = val.find_first_of('[');
-        for (decltype(sz) ii = 0; ii < sz; ++ii) {
-            auto nc = val.find_first_of(",;]", fb + 1);
-            auto V = helicsGetComplex(val.substr(fb + 1, nc - fb - 1));
+        data.reserve(std::min(sz, val.size()) * 2);
+        const char* cur = firstElement(val);
+        for (decltype(sz) ii = 0; ii < sz && cur != end; ++ii) {
+            const char* sep = nextSeparator(cur, end);
+            auto V = readComplex(cur, sep);
             data.push_back(V.real());
             data.push_back(V.imag());
-            fb = nc;
+            cur = nextElement(sep, end);
         }
     } else {
         auto V = helicsGetComplex(val);
@@ -473,39 +464,37 @@ void helicsGetComplexVector(const std::string& val, std::vector<std::complex<dou
 {
     if (val.empty()) {
         data.resize(0);
+        return;
     }
+    const char* end = val.data() + val.size();
     if (val.front() == 'v') {
         auto sz = readSize(val);
-        data.reserve(sz / 2);
         data.resize(0);
-        auto fb = val.find_first_of('[');
-        for (decltype(sz) ii = 0; ii < sz - 1; ii += 2) {
-            auto nc = val.find_first_of(",;]", fb + 1);
-            auto nc2 = val.find_first_of(",;]", nc + 1);
-            try {
-                std::string vstr1 = val.substr(fb + 1, nc - fb - 1);
-                stringOps::trimString(vstr1);
-                std::string vstr2 = val.substr(nc + 1, nc2 - nc - 1);
-                stringOps::trimString(vstr2);
-                auto V1 = numConv<double>(vstr1);
-                auto V2 = numConv<double>(vstr2);
+        data.reserve(std::min(sz, val.size()) / 2);
+        const char* cur = firstElement(val);
+        for (decltype(sz) ii = 0; ii + 1 < sz && cur != end; ii += 2) {
+            const char* sep = nextSeparator(cur, end);
+            const char* cur2 = nextElement(sep, end);
+            const char* sep2 = nextSeparator(cur2, end);
+            double V1{0.0};
+            double V2{0.0};
+            if (text_codec::parseDouble(cur, sep, V1) != cur &&
+                text_codec::parseDouble(cur2, sep2, V2) != cur2) {
                 data.emplace_back(V1, V2);
+            } else {
+                data.emplace_back(invalidReal);
             }
-            catch (const std::invalid_argument&) {
-                data.emplace_back(-1e49);
-            }
-            fb = nc;
+            cur = nextElement(sep2, end);
         }
     } else if (val.front() == 'c') {
         auto sz = readSize(val);
-        data.reserve(sz);
         data.resize(0);
-        auto fb = val.find_first_of('[');
-        for (decltype(sz) ii = 0; ii < sz; ++ii) {
-            auto nc = val.find_first_of(",;]", fb + 1);
-            auto V = helicsGetComplex(val.substr(fb + 1, nc - fb - 1));
-            data.push_back(V);
-            fb = nc;
+        data.reserve(std::min(sz, val.size()));
+        const char* cur = firstElement(val);
+        for (decltype(sz) ii = 0; ii < sz && cur != end; ++ii) {
+            const char* sep = nextSeparator(cur, end);
+            data.push_back(readComplex(cur, sep));
+            cur = nextElement(sep, end);
         }
     } else {
         auto V = helicsGetComplex(val);
@@ -608,7 +597,7 @@ data_block typeConvert(data_type type, double val)
         case data_type::helics_bool:
             return (val != 0.0) ? "1" : "0";
         case data_type::helics_string:
-            return std::to_string(val);
+            return text_codec::doubleString(val);
         case data_type::helics_named_point:
             return ValueConverter<NamedPoint>::convert(NamedPoint{"value", val});
         case data_type::helics_complex_vector: {
@@ -633,13 +622,13 @@ data_block typeConvert(data_type type, int64_t val)
         case data_type::helics_bool:
             return (val != 0) ? "1" : "0";
         case data_type::helics_string:
-            return std::to_string(val);
+            return text_codec::integerString(val);
         case data_type::helics_named_point:
             if (static_cast<uint64_t>(std::abs(val)) >
                 (2ull << 51u)) // this checks whether the actual value will fit in a double
             {
                 return ValueConverter<NamedPoint>::convert(
-                    NamedPoint{std::to_string(val), std::nan("0")});
+                    NamedPoint{text_codec::integerString(val), std::nan("0")});
             } else {
                 return ValueConverter<NamedPoint>::convert(
                     NamedPoint{"value", static_cast<double>(val)});
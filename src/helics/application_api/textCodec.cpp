@@ -0,0 +1,243 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "textCodec.hpp"
+
+#include "../common/fmt_format.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <limits>
+
+namespace helics {
+namespace text_codec {
+    void appendDouble(std::string& out, double val)
+    {
+        auto start = out.size();
+        fmt::format_to(std::back_inserter(out), "{}", val);
+        // integral values are written without the trailing ".0"
+        auto size = out.size();
+        if (size - start > 2 && out[size - 2] == '.' && out[size - 1] == '0') {
+            out.resize(size - 2);
+        }
+    }
+
+    void appendInteger(std::string& out, std::int64_t val)
+    {
+        fmt::format_int str(val);
+        out.append(str.data(), str.size());
+    }
+
+    void appendComplex(std::string& out, double real, double imag)
+    {
+        appendDouble(out, real);
+        if (imag != 0.0) {
+            out.push_back((imag >= 0.0) ? '+' : ' ');
+            appendDouble(out, imag);
+            out.push_back('j');
+        }
+    }
+
+    std::string doubleString(double val)
+    {
+        std::string str;
+        appendDouble(str, val);
+        return str;
+    }
+
+    std::string integerString(std::int64_t val)
+    {
+        fmt::format_int str(val);
+        return str.str();
+    }
+
+    static inline bool isDigit(char c) { return (c >= '0' && c <= '9'); }
+
+    static inline bool isSpace(char c)
+    {
+        return (c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v');
+    }
+
+    const char* skipSpace(const char* pos, const char* end)
+    {
+        while (pos != end && isSpace(*pos)) {
+            ++pos;
+        }
+        return pos;
+    }
+
+    /** check for a lower case word at a position ignoring case
+    @return a pointer to the character after the word or pos if the word is not there*/
+    static const char* matchWord(const char* pos, const char* end, const char* word)
+    {
+        const char* cur = pos;
+        while (*word != '\0') {
+            if (cur == end || (*cur != *word && *cur != *word - ('a' - 'A'))) {
+                return pos;
+            }
+            ++cur;
+            ++word;
+        }
+        return cur;
+    }
+
+    /** powers of 10 that are exactly representable as a double*/
+    static constexpr double exactPowersOf10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                                 1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                                 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    /** the maximum number of mantissa digits that fit in a uint64*/
+    static constexpr int maxMantissaDigits{19};
+    /** the largest mantissa that is exactly representable as a double*/
+    static constexpr std::uint64_t maxExactMantissa{std::uint64_t(1) << 53U};
+
+    const char* parseDouble(const char* pos, const char* end, double& val)
+    {
+        const char* start = skipSpace(pos, end);
+        const char* cur = start;
+        bool negative{false};
+        if (cur != end && (*cur == '-' || *cur == '+')) {
+            negative = (*cur == '-');
+            ++cur;
+        }
+        std::uint64_t mantissa{0};
+        int digits{0};
+        int exponent{0};
+        bool anyDigits{false};
+        bool truncated{false};
+        while (cur != end && isDigit(*cur)) {
+            anyDigits = true;
+            auto digit = static_cast<std::uint64_t>(*cur - '0');
+            if (digits < maxMantissaDigits) {
+                if (mantissa != 0 || digit != 0) {
+                    mantissa = mantissa * 10 + digit;
+                    ++digits;
+                }
+            } else {
+                ++exponent;
+                truncated = truncated || (digit != 0);
+            }
+            ++cur;
+        }
+        if (cur != end && *cur == '.') {
+            ++cur;
+            while (cur != end && isDigit(*cur)) {
+                anyDigits = true;
+                auto digit = static_cast<std::uint64_t>(*cur - '0');
+                if (digits < maxMantissaDigits) {
+                    if (mantissa != 0 || digit != 0) {
+                        mantissa = mantissa * 10 + digit;
+                        ++digits;
+                    }
+                    --exponent;
+                } else {
+                    truncated = truncated || (digit != 0);
+                }
+                ++cur;
+            }
+        }
+        if (!anyDigits) {
+            auto* wordEnd = matchWord(cur, end, "inf");
+            if (wordEnd != cur) {
+                auto* longEnd = matchWord(wordEnd, end, "inity");
+                val = negative ? -std::numeric_limits<double>::infinity() :
+                                 std::numeric_limits<double>::infinity();
+                return longEnd;
+            }
+            wordEnd = matchWord(cur, end, "nan");
+            if (wordEnd != cur) {
+                val = std::numeric_limits<double>::quiet_NaN();
+                return wordEnd;
+            }
+            return pos;
+        }
+        if (cur != end && (*cur == 'e' || *cur == 'E')) {
+            const char* expPos = cur + 1;
+            bool expNegative{false};
+            if (expPos != end && (*expPos == '-' || *expPos == '+')) {
+                expNegative = (*expPos == '-');
+                ++expPos;
+            }
+            // an 'e' without any digits is not part of the number
+            if (expPos != end && isDigit(*expPos)) {
+                int expValue{0};
+                while (expPos != end && isDigit(*expPos)) {
+                    if (expValue < 100000) {
+                        expValue = expValue * 10 + (*expPos - '0');
+                    }
+                    ++expPos;
+                }
+                exponent += expNegative ? -expValue : expValue;
+                cur = expPos;
+            }
+        }
+
+        if (mantissa == 0 && !truncated) {
+            val = negative ? -0.0 : 0.0;
+        } else if (!truncated && mantissa <= maxExactMantissa && exponent >= -22 && exponent <= 22) {
+            // both the mantissa and the power of 10 are exact so a single operation rounds correctly
+            auto result = static_cast<double>(mantissa);
+            result = (exponent < 0) ? result / exactPowersOf10[-exponent] :
+                                      result * exactPowersOf10[exponent];
+            val = negative ? -result : result;
+        } else {
+            // the rare cases that need more than double precision to round correctly
+            auto length = static_cast<std::size_t>(cur - start);
+            char numberBuffer[64];
+            if (length < sizeof(numberBuffer)) {
+                std::memcpy(numberBuffer, start, length);
+                numberBuffer[length] = '\0';
+                val = std::strtod(numberBuffer, nullptr);
+            } else {
+                std::string numberString(start, cur);
+                val = std::strtod(numberString.c_str(), nullptr);
+            }
+        }
+        return cur;
+    }
+
+    const char* parseSize(const char* pos, const char* end, std::size_t& val)
+    {
+        const char* cur = skipSpace(pos, end);
+        if (cur == end || !isDigit(*cur)) {
+            return pos;
+        }
+        val = 0;
+        while (cur != end && isDigit(*cur)) {
+            val = val * 10 + static_cast<std::size_t>(*cur - '0');
+            ++cur;
+        }
+        return cur;
+    }
+
+    bool parseComplex(const char* pos, const char* end, std::complex<double>& val)
+    {
+        double first{0.0};
+        const char* cur = parseDouble(pos, end, first);
+        if (cur == pos) {
+            return false;
+        }
+        cur = skipSpace(cur, end);
+        if (cur != end && (*cur == 'j' || *cur == 'i')) {
+            val = {0.0, first};
+            return true;
+        }
+        if (cur != end && (*cur == '+' || *cur == '-')) {
+            bool negative = (*cur == '-');
+            const char* imagStart = skipSpace(cur + 1, end);
+            double second{0.0};
+            if (parseDouble(imagStart, end, second) != imagStart) {
+                val = {first, negative ? -second : second};
+                return true;
+            }
+        }
+        val = {first, 0.0};
+        return true;
+    }
+} // namespace text_codec
+} // namespace helics
@@ -0,0 +1,50 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace helics {
+/** functions for converting the primary types to and from text
+
+doubles are written in the shortest form that converts back to exactly the same value and the parsers work
+directly on the character buffer without creating intermediate strings*/
+namespace text_codec {
+    /** append the shortest representation of a double that reads back as the same value*/
+    void appendDouble(std::string& out, double val);
+    /** append an integer*/
+    void appendInteger(std::string& out, std::int64_t val);
+    /** append a complex number in the form real+imagj,  the imaginary part is left off if it is 0*/
+    void appendComplex(std::string& out, double real, double imag);
+
+    /** get the shortest string representation of a double that reads back as the same value*/
+    std::string doubleString(double val);
+    /** get the string representation of an integer*/
+    std::string integerString(std::int64_t val);
+
+    /** skip over any whitespace
+    @return a pointer to the first non-space character or end*/
+    const char* skipSpace(const char* pos, const char* end);
+    /** read a double from the start of a character sequence,  leading whitespace is skipped
+    @param pos the first character
+    @param end one past the last character
+    @param[out] val the value that was read
+    @return a pointer to the character after the number,  or pos if there was no number*/
+    const char* parseDouble(const char* pos, const char* end, double& val);
+    /** read a size from the start of a character sequence,  leading whitespace is skipped
+    @return a pointer to the character after the number,  or pos if there was no number*/
+    const char* parseSize(const char* pos, const char* end, std::size_t& val);
+    /** read a complex number from a character sequence
+    @details handles real values,  imaginary values like "2j" or "-1.5i",  and complex values like "1+2j" or
+    "1 -2j",  trailing characters after the number are ignored
+    @return false if no number could be read*/
+    bool parseComplex(const char* pos, const char* end, std::complex<double>& val);
+} // namespace text_codec
+} // namespace helics
@@ -0,0 +1,81 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace helics {
+/** class containing a read only view of a contiguous sequence of values
+@details the view either references data owned by something else, such as the data_block of a received value,
+and holds a reference to keep it alive,  or holds its own copy of the values if they had to be converted
+*/
+template<class X>
+class vector_view {
+  private:
+    const X* dataPtr{nullptr}; //!< pointer to the first element
+    std::size_t count{0}; //!< the number of elements
+    std::shared_ptr<const void> owner; //!< reference keeping the viewed data alive
+  public:
+    using value_type = X;
+    using const_iterator = const X*;
+    /** default constructor*/
+    vector_view() = default;
+    /** construct a view of existing data
+    @param data pointer to the first element
+    @param size the number of elements
+    @param dataOwner an object keeping the data alive for the life of the view,  if null the data must
+    outlive the view
+    */
+    vector_view(const X* data, std::size_t size, std::shared_ptr<const void> dataOwner = nullptr) noexcept:
+        dataPtr(data), count(size), owner(std::move(dataOwner))
+    {
+    }
+    /** construct a view holding its own copy of some values*/
+    explicit vector_view(std::vector<X> vals)
+    {
+        auto store = std::make_shared<const std::vector<X>>(std::move(vals));
+        dataPtr = store->data();
+        count = store->size();
+        owner = std::move(store);
+    }
+    /** get a pointer to the first element*/
+    const X* data() const noexcept { return dataPtr; }
+    /** get the number of elements*/
+    std::size_t size() const noexcept { return count; }
+    /** check if the view is empty*/
+    bool empty() const noexcept { return count == 0; }
+    /** random access operator*/
+    const X& operator[](std::size_t index) const noexcept { return dataPtr[index]; }
+    /** random access with bounds checking*/
+    const X& at(std::size_t index) const
+    {
+        if (index >= count) {
+            throw std::out_of_range("vector_view index out of range");
+        }
+        return dataPtr[index];
+    }
+    /** get the first element*/
+    const X& front() const noexcept { return dataPtr[0]; }
+    /** get the last element*/
+    const X& back() const noexcept { return dataPtr[count - 1]; }
+    /** begin iterator*/
+    const_iterator begin() const noexcept { return dataPtr; }
+    /** end iterator*/
+    const_iterator end() const noexcept { return dataPtr + count; }
+    /** begin const iterator*/
+    const_iterator cbegin() const noexcept { return dataPtr; }
+    /** end const iterator*/
+    const_iterator cend() const noexcept { return dataPtr + count; }
+    /** copy the elements into a vector*/
+    std::vector<X> to_vector() const { return std::vector<X>(begin(), end()); }
+};
+
+} // namespace helics
@@ -107,11 +107,16 @@ namespace apps {
             }
         }
         if (!points.empty()) {
+            std::vector<data_type> types;
+            types.reserve(subscriptions.size());
+            for (auto& sub : subscriptions) {
+                types.push_back(getTypeFromString(sub.getPublicationType()));
+            }
             doc["points"] = Json::Value(Json::arrayValue);
             for (auto& v : points) {
                 Json::Value point;
                 point["key"] = subscriptions[v.index].getTarget();
-                point["value"] = v.value;
+                point["value"] = valueString(v.value, types[v.index]);
                 point["time"] = static_cast<double>(v.time);
                 if (v.iteration > 0) {
                     point["iteration"] = v.iteration;
@@ -159,6 +164,7 @@ namespace apps {
         generateInterfaces();
 
         pubPointCount.resize(subids.size(), 0);
+        trackSubscriptionUpdates(subids, updatedSubscriptions);
 
         fed->enterInitializingMode();
         captureForCurrentTime(-1.0);
@@ -200,45 +206,45 @@ namespace apps {
     void Clone::captureForCurrentTime(Time currentTime, int iteration)
     {
         static auto logger = LoggerManager::getLoggerCore();
-        for (auto& sub : subscriptions) {
-            if (sub.isUpdated()) {
-                auto val = sub.getValue<std::string>();
-                int ii = subids[sub.getHandle()];
-                points.emplace_back(currentTime, ii, val);
-                if (iteration > 0) {
-                    points.back().iteration = iteration;
-                }
-                if (verbose) {
-                    std::string valstr;
-                    if (val.size() < 150) {
-                        if (iteration > 0) {
-                            valstr = fmt::format(
-                                "[{}:{}]value {}={}", currentTime, iteration, sub.getTarget(), val);
-                        } else {
-                            valstr =
-                                fmt::format("[{}]value {}={}", currentTime, sub.getTarget(), val);
-                        }
+        for (auto ii : updatedSubscriptions) {
+            auto& sub = subscriptions[ii];
+            auto val = sub.getRawValue();
+            if (verbose) {
+                auto valstr = valueString(val, getTypeFromString(sub.getPublicationType()));
+                std::string message;
+                if (valstr.size() < 150) {
+                    if (iteration > 0) {
+                        message = fmt::format(
+                            "[{}:{}]value {}={}", currentTime, iteration, sub.getTarget(), valstr);
                     } else {
-                        if (iteration > 0) {
-                            valstr = fmt::format(
-                                "[{}:{}]value {}=block[{}]",
-                                currentTime,
-                                iteration,
-                                sub.getTarget(),
-                                val.size());
-                        } else {
-                            valstr = fmt::format(
-                                "[{}]value {}=block[{}]", currentTime, sub.getTarget(), val.size());
-                        }
+                        message =
+                            fmt::format("[{}]value {}={}", currentTime, sub.getTarget(), valstr);
+                    }
+                } else {
+                    if (iteration > 0) {
+                        message = fmt::format(
+                            "[{}:{}]value {}=block[{}]",
+                            currentTime,
+                            iteration,
+                            sub.getTarget(),
+                            valstr.size());
+                    } else {
+                        message = fmt::format(
+                            "[{}]value {}=block[{}]", currentTime, sub.getTarget(), valstr.size());
                     }
-                    logger->addMessage(std::move(valstr));
-                }
-                if (pubPointCount[ii] == 0) {
-                    points.back().first = true;
                 }
-                ++pubPointCount[ii];
+                logger->addMessage(std::move(message));
+            }
+            points.emplace_back(currentTime, ii, std::move(val));
+            if (iteration > 0) {
+                points.back().iteration = iteration;
+            }
+            if (pubPointCount[ii] == 0) {
+                points.back().first = true;
             }
+            ++pubPointCount[ii];
         }
+        updatedSubscriptions.clear();
 
         // get the clone endpoints
         if (cloneEndpoint) {
@@ -324,7 +330,9 @@ namespace apps {
     std::pair<std::string, std::string> Clone::getValue(int index) const
     {
         if (isValidIndex(index, points)) {
-            return {subscriptions[points[index].index].getTarget(), points[index].value};
+            const auto& sub = subscriptions[points[index].index];
+            return {sub.getTarget(),
+                    valueString(points[index].value, getTypeFromString(sub.getPublicationType()))};
         }
         return {std::string(), std::string()};
     }
@@ -14,6 +14,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <map>
 #include <memory>
 #include <set>
+#include <utility>
 
 namespace helics {
 class CloningFilter;
@@ -111,10 +112,10 @@ namespace apps {
             int index = -1;
             int16_t iteration = 0;
             bool first = false;
-            std::string value;
+            data_view value; //!< the value in the binary form it was published in
             ValueCapture() = default;
-            ValueCapture(helics::Time t1, int id1, const std::string& val):
-                time(t1), index(id1), value(val){};
+            ValueCapture(helics::Time t1, int id1, data_view val):
+                time(t1), index(id1), value(std::move(val)){};
         };
 
         bool allow_iteration = false; //!< trigger to allow Iteration
@@ -130,6 +131,7 @@ namespace apps {
         std::unique_ptr<Endpoint> cloneEndpoint; //!< the endpoint for cloned message delivery
         std::vector<std::unique_ptr<Message>> messages; //!< list of messages
         std::map<helics::interface_handle, int> subids; //!< map of the subscription ids
+        std::vector<int> updatedSubscriptions; //!< subscriptions updated since the last capture
         std::map<std::string, int> subkeys; //!< translate subscription names to an index
         std::map<helics::interface_handle, int> eptids; // translate subscription id to index
         std::map<std::string, int> eptNames; //!< translate endpoint name to index
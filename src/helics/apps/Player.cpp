@@ -43,6 +43,65 @@ std::map<std::string, int> eptids;
 
 namespace helics {
 namespace apps {
+    /** the size of the read buffer for a streamed file*/
+    static constexpr size_t streamBufferSize{1024 * 1024};
+
+    /** a text file played directly from the file*/
+    class PlayerInputStream {
+      public:
+        std::string fileName; //!< the name of the file
+        std::vector<char> buffer; //!< the read buffer for the file
+        std::ifstream file; //!< the open file
+        int lineNumber{0}; //!< the number of lines read
+        bool mlineComment{false}; //!< indicator that the reader is in a multiline comment
+        bool finished{false}; //!< indicator that the whole file has been read
+        std::string lastKey; //!< the publication name of the last point read
+
+        /** read the next line
+        @return false at the end of the file*/
+        bool getLine(std::string& line)
+        {
+            if (!std::getline(file, line)) {
+                finished = true;
+                return false;
+            }
+            ++lineNumber;
+            return true;
+        }
+    };
+
+    /** get the position of the first character of a line containing a point or message
+    @param str the line
+    @param mlineComment the multiline comment state which is updated by the line
+    @return the position of the first character or std::string::npos for blank and comment lines*/
+    static size_t recordStart(const std::string& str, bool& mlineComment)
+    {
+        if (str.empty()) {
+            return std::string::npos;
+        }
+        auto fc = str.find_first_not_of(" \t\n\r\0");
+        if (fc == std::string::npos) {
+            return fc;
+        }
+        if (mlineComment) {
+            if (fc + 2 < str.size()) {
+                if ((str[fc] == '#') && (str[fc + 1] == '#') && (str[fc + 2] == ']')) {
+                    mlineComment = false;
+                }
+            }
+            return std::string::npos;
+        }
+        if (str[fc] == '#') {
+            if (fc + 2 < str.size()) {
+                if ((str[fc + 1] == '#') && (str[fc + 2] == '[')) {
+                    mlineComment = true;
+                }
+            }
+            return std::string::npos;
+        }
+        return fc;
+    }
+
     static inline bool vComp(const ValueSetter& v1, const ValueSetter& v2)
     {
         return (v1.time == v2.time) ? (v1.iteration < v2.iteration) : (v1.time < v2.time);
@@ -106,6 +165,10 @@ namespace apps {
                false)
             ->take_last()
             ->ignore_underscore();
+        app->add_flag(
+            "--stream",
+            streamInput,
+            "play text files directly from the file instead of loading them into memory, the points and messages in the file must be sorted by time");
 
         return app;
     }
@@ -166,7 +229,15 @@ namespace apps {
         messages.back().mess.time = actionTime;
     }
 
-    helics::Time Player::extractTime(const std::string& str, int lineNumber) const
+    Player::Player() = default;
+
+    Player::Player(Player&& other_player) = default;
+
+    Player& Player::operator=(Player&& fed) = default;
+
+    Player::~Player() = default;
+
+    helics::Time Player::extractTime(const std::string& str, int lineNumber, bool reportErrors) const
     {
         try {
             if (units == time_units::ns) // ns
@@ -176,15 +247,21 @@ namespace apps {
             return loadTimeFromString(str, units);
         }
         catch (const std::invalid_argument&) {
-            std::cerr << "ill formed time on line " << lineNumber << '\n';
+            if (reportErrors) {
+                std::cerr << "ill formed time on line " << lineNumber << '\n';
+            }
             return helics::Time::minVal();
         }
     }
 
     void Player::loadTextFile(const std::string& filename)
     {
+        if (streamInput && !stream && points.empty() && messages.empty()) {
+            if (openInputStream(filename)) {
+                return;
+            }
+        }
         App::loadTextFile(filename);
-        using namespace gmlc::utilities::stringOps;
         std::ifstream infile(filename);
         std::string str;
 
@@ -193,29 +270,10 @@ namespace apps {
         bool mlineComment = false;
         // count the lines
         while (std::getline(infile, str)) {
-            if (str.empty()) {
-                continue;
-            }
-            auto fc = str.find_first_not_of(" \t\n\r\0");
+            auto fc = recordStart(str, mlineComment);
             if (fc == std::string::npos) {
                 continue;
             }
-            if (mlineComment) {
-                if (fc + 2 < str.size()) {
-                    if ((str[fc] == '#') && (str[fc + 1] == '#') && (str[fc + 2] == ']')) {
-                        mlineComment = false;
-                    }
-                }
-                continue;
-            }
-            if (str[fc] == '#') {
-                if (fc + 2 < str.size()) {
-                    if ((str[fc + 1] == '#') && (str[fc + 2] == '[')) {
-                        mlineComment = true;
-                    }
-                }
-                continue;
-            }
             if ((str[fc] == 'm') || (str[fc] == 'M')) {
                 ++mcnt;
             } else {
@@ -230,161 +288,235 @@ namespace apps {
         infile.close();
         infile.open(filename);
 
+        ValueSetter point;
+        MessageHolder message;
         int lcount = 0;
         while (std::getline(infile, str)) {
-            if (str.empty()) {
-                continue;
-            }
-            auto fc = str.find_first_not_of(" \t\n\r\0");
-            if (fc == std::string::npos) {
+            ++lcount;
+            if (recordStart(str, mlineComment) == std::string::npos) {
                 continue;
             }
-            if (mlineComment) {
-                if (fc + 2 < str.size()) {
-                    if ((str[fc] == '#') && (str[fc + 1] == '#') && (str[fc + 2] == ']')) {
-                        mlineComment = false;
-                    }
-                }
-                continue;
+            const std::string* previousKey =
+                (pIndex > 0) ? &(points[static_cast<size_t>(pIndex) - 1].pubName) : nullptr;
+            switch (parseTextLine(str, lcount, previousKey, point, message, true)) {
+                case line_type::point:
+                    points[pIndex] = std::move(point);
+                    ++pIndex;
+                    break;
+                case line_type::message:
+                    messages[mIndex] = std::move(message);
+                    ++mIndex;
+                    break;
+                default:
+                    break;
             }
-            if (str[fc] == '#') {
-                if (fc + 2 < str.size()) {
-                    if ((str[fc + 1] == '#') && (str[fc + 2] == '[')) {
-                        mlineComment = true;
-                    } else if (str[fc + 1] == '!') {
-                        /*  //allow configuration inside the regular text file
-
-
-
-
-
+        }
+        // drop the slots counted for lines that could not be read
+        points.resize(pIndex);
+        messages.resize(mIndex);
+    }
 
-                    if (playerConfig.find("time_units") != playerConfig.end())
-                    {
-                        if (playerConfig["time_units"] == "ns")
-                        {
-                            timeMultiplier = 1e-9;
-                        }
+    Player::line_type Player::parseTextLine(
+        const std::string& line,
+        int lineNumber,
+        const std::string* previousKey,
+        ValueSetter& point,
+        MessageHolder& message,
+        bool reportErrors) const
+    {
+        using namespace gmlc::utilities::stringOps;
+        /* time key type value units*/
+        auto blk = splitlineBracket(line, ",\t ", default_bracket_chars, delimiter_compression::on);
+
+        trimString(blk[0]);
+        if ((blk[0].front() == 'm') || (blk[0].front() == 'M')) {
+            // deal with messages
+            switch (blk.size()) {
+                case 5:
+                    if ((message.sendTime = extractTime(blk[1], lineNumber, reportErrors)) ==
+                        Time::minVal()) {
+                        return line_type::invalid;
                     }
-                    */
+                    message.mess.source = blk[2];
+                    message.mess.dest = blk[3];
+                    message.mess.time = message.sendTime;
+                    message.mess.data = decode(std::move(blk[4]));
+                    return line_type::message;
+                case 6:
+                    if ((message.sendTime = extractTime(blk[1], lineNumber, reportErrors)) ==
+                        Time::minVal()) {
+                        return line_type::invalid;
                     }
+                    message.mess.source = blk[3];
+                    message.mess.dest = blk[4];
+                    if ((message.mess.time = extractTime(blk[2], lineNumber, reportErrors)) ==
+                        Time::minVal()) {
+                        return line_type::invalid;
+                    }
+                    message.mess.data = decode(std::move(blk[5]));
+                    return line_type::message;
+                default:
+                    if (reportErrors) {
+                        std::cerr << "unknown message format line " << lineNumber << '\n';
+                    }
+                    return line_type::invalid;
+            }
+        }
+        if ((blk.size() < 2) || (blk.size() > 4)) {
+            if (reportErrors) {
+                std::cerr << "unknown publish format line " << lineNumber << '\n';
+            }
+            return line_type::invalid;
+        }
+        point.iteration = 0;
+        auto cloc = blk[0].find_last_of(':');
+        if (cloc == std::string::npos) {
+            if ((point.time = extractTime(trim(blk[0]), lineNumber, reportErrors)) ==
+                Time::minVal()) {
+                return line_type::invalid;
+            }
+        } else {
+            if ((point.time = extractTime(trim(blk[0]).substr(0, cloc), lineNumber, reportErrors)) ==
+                Time::minVal()) {
+                return line_type::invalid;
+            }
+            point.iteration = std::stoi(blk[0].substr(cloc + 1));
+        }
+        if ((blk.size() == 2) || (blk[1].empty())) {
+            if (previousKey != nullptr) {
+                point.pubName = *previousKey;
+            } else if (blk.size() == 2) {
+                if (reportErrors) {
+                    std::cerr
+                        << "lines without publication name but follow one with a publication line "
+                        << lineNumber << '\n';
                 }
-                continue;
+                point.pubName.clear();
+            } else {
+                point.pubName.clear();
             }
-            /* time key type value units*/
-            auto blk =
-                splitlineBracket(str, ",\t ", default_bracket_chars, delimiter_compression::on);
-
-            trimString(blk[0]);
-            if ((blk[0].front() == 'm') || (blk[0].front() == 'M')) {
-                // deal with messages
-                switch (blk.size()) {
-                    case 5:
-                        if ((messages[mIndex].sendTime = extractTime(blk[1], lcount)) ==
-                            Time::minVal()) {
-                            continue;
-                        }
-
-                        messages[mIndex].mess.source = blk[2];
-                        messages[mIndex].mess.dest = blk[3];
-                        messages[mIndex].mess.time = messages[mIndex].sendTime;
-                        messages[mIndex].mess.data = decode(std::move(blk[4]));
-                        break;
-                    case 6:
-                        if ((messages[mIndex].sendTime = extractTime(blk[1], lcount)) ==
-                            Time::minVal()) {
-                            continue;
-                        }
+        } else {
+            point.pubName = blk[1];
+        }
+        if (blk.size() == 4) {
+            point.type = blk[2];
+        } else {
+            point.type.clear();
+        }
+        point.value = blk.back();
+        return line_type::point;
+    }
 
-                        messages[mIndex].mess.source = blk[3];
-                        messages[mIndex].mess.dest = blk[4];
-                        if ((messages[mIndex].mess.time = extractTime(blk[2], lcount)) ==
-                            Time::minVal()) {
-                            continue;
-                        }
-                        messages[mIndex].mess.data = decode(std::move(blk[5]));
-                        break;
-                    default:
-                        std::cerr << "unknown message format line " << lcount << '\n';
-                        break;
+    bool Player::openInputStream(const std::string& filename)
+    {
+        auto input = std::make_unique<PlayerInputStream>();
+        input->fileName = filename;
+        input->buffer.resize(streamBufferSize);
+        input->file.rdbuf()->pubsetbuf(input->buffer.data(), streamBufferSize);
+        input->file.open(filename, std::ios::in | std::ios::binary);
+        if (!input->file) {
+            return false;
+        }
+        std::map<std::string, std::string> fileTags;
+        std::set<std::string> fileEpts;
+        size_t pcnt = 0;
+        size_t mcnt = 0;
+        Time lastTime = Time::minVal();
+        int lastIteration = 0;
+        ValueSetter point;
+        MessageHolder message;
+        std::string str;
+        // scan the file for the interfaces and check that it is sorted, the records are not kept
+        while (input->getLine(str)) {
+            if (recordStart(str, input->mlineComment) == std::string::npos) {
+                continue;
+            }
+            const std::string* previousKey = input->lastKey.empty() ? nullptr : &input->lastKey;
+            auto res = parseTextLine(str, input->lineNumber, previousKey, point, message, false);
+            if (res == line_type::invalid) {
+                continue;
+            }
+            Time recordTime = (res == line_type::point) ? point.time : message.sendTime;
+            int recordIteration = (res == line_type::point) ? point.iteration : 0;
+            if ((recordTime < lastTime) ||
+                ((recordTime == lastTime) && (recordIteration < lastIteration))) {
+                std::cerr << filename << " is not sorted by time and will be loaded into memory\n";
+                return false;
+            }
+            lastTime = recordTime;
+            lastIteration = recordIteration;
+            if (res == line_type::point) {
+                auto fnd = fileTags.find(point.pubName);
+                if (fnd == fileTags.end()) {
+                    fileTags.emplace(point.pubName, point.type);
+                } else if (fnd->second.empty()) {
+                    fnd->second = point.type;
                 }
-                ++mIndex;
+                input->lastKey = point.pubName;
+                ++pcnt;
             } else {
-                if (blk.size() == 2) {
-                    auto cloc = blk[0].find_last_of(':');
-                    if (cloc == std::string::npos) {
-                        if ((points[pIndex].time = extractTime(trim(blk[0]), lcount)) ==
-                            Time::minVal()) {
-                            continue;
-                        }
-                    } else {
-                        if ((points[pIndex].time =
-                                 extractTime(trim(blk[0]).substr(0, cloc), lcount)) ==
-                            Time::minVal()) {
-                            continue;
-                        }
-                        points[pIndex].iteration = std::stoi(blk[0].substr(cloc + 1));
-                    }
-                    if (pIndex > 0) {
-                        points[pIndex].pubName = points[static_cast<size_t>(pIndex) - 1].pubName;
-                    } else {
-                        std::cerr
-                            << "lines without publication name but follow one with a publication line "
-                            << lcount << '\n';
-                    }
-                    points[pIndex].value = blk[1];
-                    ++pIndex;
-                } else if (blk.size() == 3) {
-                    auto cloc = blk[0].find_last_of(':');
-                    if (cloc == std::string::npos) {
-                        if ((points[pIndex].time = extractTime(trim(blk[0]), lcount)) ==
-                            Time::minVal()) {
-                            continue;
-                        }
-                    } else {
-                        if ((points[pIndex].time =
-                                 extractTime(trim(blk[0]).substr(0, cloc), lcount)) ==
-                            Time::minVal()) {
-                            continue;
-                        }
-                        points[pIndex].iteration = std::stoi(blk[0].substr(cloc + 1));
-                    }
-                    if ((blk[1].empty()) && (pIndex > 0)) {
-                        points[pIndex].pubName = points[static_cast<size_t>(pIndex) - 1].pubName;
-                    } else {
-                        points[pIndex].pubName = blk[1];
-                    }
+                fileEpts.insert(message.mess.source);
+                ++mcnt;
+            }
+        }
+        for (auto& tag : fileTags) {
+            auto fnd = tags.find(tag.first);
+            if (fnd == tags.end()) {
+                tags.insert(tag);
+            } else if (fnd->second.empty()) {
+                fnd->second = tag.second;
+            }
+        }
+        epts.insert(fileEpts.begin(), fileEpts.end());
+        streamPointCount = pcnt;
+        streamMessageCount = mcnt;
+
+        input->file.clear();
+        input->file.seekg(0);
+        input->lineNumber = 0;
+        input->mlineComment = false;
+        input->finished = false;
+        input->lastKey.clear();
+        stream = std::move(input);
+        return true;
+    }
 
-                    points[pIndex].value = blk[2];
-                    ++pIndex;
-                } else if (blk.size() == 4) {
-                    auto cloc = blk[0].find_last_of(':');
-                    if (cloc == std::string::npos) {
-                        if ((points[pIndex].time = extractTime(trim(blk[0]), lcount)) ==
-                            Time::minVal()) {
-                            continue;
-                        }
-                    } else {
-                        if ((points[pIndex].time =
-                                 extractTime(trim(blk[0]).substr(0, cloc), lcount)) ==
-                            Time::minVal()) {
-                            continue;
-                        }
-                        points[pIndex].iteration = std::stoi(blk[0].substr(cloc + 1));
-                    }
-                    if ((blk[1].empty()) && (pIndex > 0)) {
-                        points[pIndex].pubName = points[static_cast<size_t>(pIndex) - 1].pubName;
-                    } else {
-                        points[pIndex].pubName = blk[1];
-                    }
-                    points[pIndex].type = blk[2];
-                    points[pIndex].value = blk[3];
-                    ++pIndex;
-                } else {
-                    std::cerr << "unknown publish format line " << lcount << '\n';
-                }
+    bool Player::loadNextWindow()
+    {
+        if (!stream || stream->finished) {
+            return false;
+        }
+        points.erase(points.begin(), points.begin() + pointIndex);
+        pointIndex = 0;
+        messages.erase(messages.begin(), messages.begin() + messageIndex);
+        messageIndex = 0;
+
+        ValueSetter point;
+        MessageHolder message;
+        std::string str;
+        size_t count = 0;
+        while (count < streamBlockSize && stream->getLine(str)) {
+            if (recordStart(str, stream->mlineComment) == std::string::npos) {
+                continue;
+            }
+            const std::string* previousKey = stream->lastKey.empty() ? nullptr : &stream->lastKey;
+            switch (parseTextLine(str, stream->lineNumber, previousKey, point, message, true)) {
+                case line_type::point:
+                    point.index = pubids[point.pubName];
+                    stream->lastKey = point.pubName;
+                    points.push_back(std::move(point));
+                    ++count;
+                    break;
+                case line_type::message:
+                    message.index = eptids[message.mess.source];
+                    messages.push_back(std::move(message));
+                    ++count;
+                    break;
+                default:
+                    break;
             }
         }
+        return (count > 0);
     }
 
     void Player::loadJsonFile(const std::string& jsonString)
@@ -612,6 +744,12 @@ namespace apps {
     {
         auto md = fed->getCurrentMode();
         if (md == Federate::modes::startup) {
+            if (stream && (!points.empty() || !messages.empty())) {
+                // the points must all come from the same source to be played in order
+                auto fileName = stream->fileName;
+                stream.reset();
+                loadTextFile(fileName);
+            }
             sortTags();
             generatePublications();
             generateEndpoints();
@@ -621,6 +759,14 @@ namespace apps {
     }
 
     void Player::sendInformation(Time sendTime, int iteration)
+    {
+        do {
+            sendWindowInformation(sendTime, iteration);
+            // a streamed file may have more to send after the loaded block
+        } while (stream && windowConsumed() && loadNextWindow());
+    }
+
+    void Player::sendWindowInformation(Time sendTime, int iteration)
     {
         if (isValidIndex(pointIndex, points)) {
             while (points[pointIndex].time < sendTime) {
@@ -666,22 +812,24 @@ namespace apps {
             sendInformation(timeZero);
         } else {
             auto ctime = fed->getCurrentTime();
-            if (isValidIndex(pointIndex, points)) {
-                while (points[pointIndex].time <= ctime) {
-                    ++pointIndex;
-                    if (pointIndex >= points.size()) {
-                        break;
+            do {
+                if (isValidIndex(pointIndex, points)) {
+                    while (points[pointIndex].time <= ctime) {
+                        ++pointIndex;
+                        if (pointIndex >= points.size()) {
+                            break;
+                        }
                     }
                 }
-            }
-            if (isValidIndex(messageIndex, messages)) {
-                while (messages[messageIndex].sendTime <= ctime) {
-                    ++messageIndex;
-                    if (messageIndex >= messages.size()) {
-                        break;
+                if (isValidIndex(messageIndex, messages)) {
+                    while (messages[messageIndex].sendTime <= ctime) {
+                        ++messageIndex;
+                        if (messageIndex >= messages.size()) {
+                            break;
+                        }
                     }
                 }
-            }
+            } while (stream && windowConsumed() && loadNextWindow());
         }
 
         Time nextPrintTime = (nextPrintTimeStep > timeZero) ? nextPrintTimeStep : Time::maxVal();
@@ -690,6 +838,9 @@ namespace apps {
         int nextIteration = 0;
         int currentIteration = 0;
         while (moreToSend) {
+            if (stream && windowConsumed()) {
+                loadNextWindow();
+            }
             nextSendTime = Time::maxVal();
             if (isValidIndex(pointIndex, points)) {
                 nextSendTime = std::min(nextSendTime, points[pointIndex].time);
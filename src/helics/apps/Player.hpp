@@ -12,10 +12,13 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helicsApp.hpp"
 
 #include <map>
+#include <memory>
 #include <set>
 
 namespace helics {
 namespace apps {
+    class PlayerInputStream;
+
     struct ValueSetter {
         Time time;
         int iteration = 0;
@@ -39,7 +42,7 @@ protection, that will result in undefined behavior
     class HELICS_CXX_EXPORT Player: public App {
       public:
         /** default constructor*/
-        Player() = default;
+        Player();
         /** construct from command line arguments in a vector
    @param args the command line arguments to pass in a reverse vector
    */
@@ -74,9 +77,11 @@ protection, that will result in undefined behavior
         Player(const std::string& appName, const std::string& configString);
 
         /** move construction*/
-        Player(Player&& other_player) = default;
+        Player(Player&& other_player);
         /** move assignment*/
-        Player& operator=(Player&& fed) = default;
+        Player& operator=(Player&& fed);
+        /** destructor*/
+        ~Player();
 
         /** initialize the Player federate
     @details generate all the publications and organize the points, the final publication count will be available
@@ -181,20 +186,36 @@ protection, that will result in undefined behavior
             const std::string& dest,
             const std::string& payload);
 
+        /** play text files directly from the file instead of loading them into memory
+        @details a text file loaded while streaming is enabled is scanned once to find the publications and
+        endpoints,  then it is read in small blocks ahead of the current time while the player runs.  The points
+        and messages in the file must be sorted by time,  if they are not or other points or messages are also
+        loaded,  the file is loaded into memory as usual
+        */
+        void enableStreamingInput(bool enable = true) { streamInput = enable; }
+        /** set the number of points and messages read from a streamed file at a time, the default is 4096*/
+        void setStreamingBlockSize(size_t blockSize)
+        {
+            streamBlockSize = (blockSize > 0) ? blockSize : 1;
+        }
         /** get the number of points loaded*/
-        auto pointCount() const { return points.size(); }
+        auto pointCount() const { return (stream) ? streamPointCount : points.size(); }
         /** get the number of messages loaded*/
-        auto messageCount() const { return messages.size(); }
+        auto messageCount() const { return (stream) ? streamMessageCount : messages.size(); }
         /** get the number of publications */
         auto publicationCount() const { return publications.size(); }
         /** get the number of endpoints*/
         auto endpointCount() const { return endpoints.size(); }
-        /** get the point from an index*/
+        /** get the point from an index
+        @details if the input is streamed only the points in the block currently loaded are available*/
         const auto& getPoint(int index) const { return points[index]; }
-        /** get the messages from an index*/
+        /** get the messages from an index
+        @details if the input is streamed only the messages in the block currently loaded are available*/
         const auto& getMessage(int index) const { return messages[index]; }
 
       private:
+        /** the result of parsing a line from a text file*/
+        enum class line_type : int { invalid = 0, point = 1, message = 2 };
         std::unique_ptr<helicsCLI11App> generateParser();
         /** process remaining command line arguments*/
         void processArgs();
@@ -204,6 +225,32 @@ protection, that will result in undefined behavior
         virtual void loadJsonFile(const std::string& jsonString) override;
         /** load a text file*/
         virtual void loadTextFile(const std::string& filename) override;
+        /** parse a line of a text file containing a point or a message
+    @param line the line to parse
+    @param lineNumber the line number used in error messages
+    @param previousKey the publication name of the previous point or nullptr if there is none
+    @param[out] point the point that was read
+    @param[out] message the message that was read
+    @param reportErrors set to false to skip printing errors for invalid lines
+    */
+        line_type parseTextLine(
+            const std::string& line,
+            int lineNumber,
+            const std::string* previousKey,
+            ValueSetter& point,
+            MessageHolder& message,
+            bool reportErrors) const;
+        /** scan a text file and set it up for streaming
+    @return false if the file could not be streamed*/
+        bool openInputStream(const std::string& filename);
+        /** replace the points and messages that were sent with the next block from the streamed file
+    @return true if anything was read*/
+        bool loadNextWindow();
+        /** check if all the points and messages that were loaded have been sent*/
+        bool windowConsumed() const
+        {
+            return (pointIndex >= points.size()) && (messageIndex >= messages.size());
+        }
         /** helper function to sort through the tags*/
         void sortTags();
         /** helper function to generate the publications*/
@@ -215,12 +262,16 @@ protection, that will result in undefined behavior
 
         /** send all points and messages up to the specified time*/
         void sendInformation(Time sendTime, int iteration = 0);
+        /** send the points and messages up to the specified time from those currently loaded*/
+        void sendWindowInformation(Time sendTime, int iteration);
 
         /** extract a time from the string based on Player parameters
     @param str the string containing the time
     @param lineNumber the lineNumber of the file which is used in case of invalid specification
+    @param reportErrors set to false to skip printing an error for an invalid time
     */
-        helics::Time extractTime(const std::string& str, int lineNumber = 0) const;
+        helics::Time
+            extractTime(const std::string& str, int lineNumber = 0, bool reportErrors = true) const;
 
       private:
         std::vector<ValueSetter> points; //!< the points to generate into the federation
@@ -240,6 +291,11 @@ protection, that will result in undefined behavior
             1.0; //!< specify the time multiplier for different time specifications
         Time nextPrintTimeStep =
             helics::timeZero; //!< the time advancement period for printing markers
+        bool streamInput{false}; //!< play text files directly from the file
+        size_t streamPointCount{0}; //!< the number of points in the streamed file
+        size_t streamMessageCount{0}; //!< the number of messages in the streamed file
+        size_t streamBlockSize{4096}; //!< the number of points and messages read at a time
+        std::unique_ptr<PlayerInputStream> stream; //!< the text file being streamed
     };
 } // namespace apps
 } // namespace helics
@@ -7,6 +7,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "PrecHelper.hpp"
 
 #include "../application_api/Federate.hpp"
+#include "../application_api/HelicsPrimaryTypes.hpp"
 #include "gmlc/utilities/stringOps.h"
 
 #include <algorithm>
@@ -73,9 +74,16 @@ char typeCharacter(data_type type)
     }
 }
 
-bool isBinaryData(helics::data_block& data)
+bool isBinaryData(const helics::data_block& data)
 {
-    return std::any_of(data.begin(), data.end(), [](const auto& c) {
+    return std::any_of(data.cbegin(), data.cend(), [](const auto& c) {
         return ((c < 32) || (c == 34) || (c > 126));
     });
 }
+
+std::string valueString(const helics::data_view& data, helics::data_type type)
+{
+    std::string val;
+    valueExtract(data, type, val);
+    return val;
+}
@@ -9,10 +9,14 @@ SPDX-License-Identifier: BSD-3-Clause
 
 namespace helics {
 class FederateInfo;
+class data_view;
 } // namespace helics
 
 helics::data_type getType(const std::string& typeString);
 
 char typeCharacter(helics::data_type type);
 
-bool isBinaryData(helics::data_block& data);
+bool isBinaryData(const helics::data_block& data);
+
+/** convert a value in the binary form it was published in to its string representation*/
+std::string valueString(const helics::data_view& data, helics::data_type type);
@@ -0,0 +1,657 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "RecordLog.hpp"
+
+#include "../common/JsonProcessingFunctions.hpp"
+#include "PrecHelper.hpp"
+#include "gmlc/utilities/base64.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace helics {
+namespace apps {
+    /** the header at the start of every record log file*/
+    static const char logFileHeader[] = {'H', 'L', 'G', '1'};
+    /** the size of the encoded blocks handed to the writer thread*/
+    static constexpr std::size_t writeBlockSize{256 * 1024};
+    /** the number of bytes that can wait for the writer thread before new records block*/
+    static constexpr std::size_t maxPendingBytes{16 * 1024 * 1024};
+
+    static constexpr char keyRecord{'K'};
+    static constexpr char valueRecord{'V'};
+    static constexpr char messageRecord{'M'};
+
+    static void appendVarint(std::string& buffer, std::uint64_t val)
+    {
+        while (val >= 0x80U) {
+            buffer.push_back(static_cast<char>((val & 0x7FU) | 0x80U));
+            val >>= 7U;
+        }
+        buffer.push_back(static_cast<char>(val));
+    }
+
+    static void appendSigned(std::string& buffer, std::int64_t val)
+    {
+        appendVarint(
+            buffer,
+            (static_cast<std::uint64_t>(val) << 1U) ^ static_cast<std::uint64_t>(val >> 63));
+    }
+
+    static void appendString(std::string& buffer, const data_view& str)
+    {
+        appendVarint(buffer, str.size());
+        buffer.append(str.data(), str.size());
+    }
+
+    static bool readVarint(std::istream& in, std::uint64_t& val)
+    {
+        val = 0;
+        for (unsigned int shift = 0; shift < 64; shift += 7) {
+            auto c = in.get();
+            if (c == std::char_traits<char>::eof()) {
+                return false;
+            }
+            val |= static_cast<std::uint64_t>(c & 0x7F) << shift;
+            if ((c & 0x80) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static bool readSigned(std::istream& in, std::int64_t& val)
+    {
+        std::uint64_t code{0};
+        if (!readVarint(in, code)) {
+            return false;
+        }
+        val = static_cast<std::int64_t>(code >> 1U) ^ -static_cast<std::int64_t>(code & 1U);
+        return true;
+    }
+
+    static bool readTime(std::istream& in, Time& time)
+    {
+        std::int64_t code{0};
+        if (!readSigned(in, code)) {
+            return false;
+        }
+        time.setBaseTimeCode(code);
+        return true;
+    }
+
+    std::string rotatedLogFileName(const std::string& baseName, int sequence)
+    {
+        if (sequence <= 0) {
+            return baseName;
+        }
+        auto sep = baseName.find_last_of("/\\");
+        auto dot = baseName.find_last_of('.');
+        if (dot == std::string::npos || (sep != std::string::npos && dot < sep)) {
+            return baseName + '.' + std::to_string(sequence);
+        }
+        return baseName.substr(0, dot) + '.' + std::to_string(sequence) + baseName.substr(dot);
+    }
+
+    RecordLogWriter::RecordLogWriter(
+        const std::string& fileName,
+        std::uint64_t maxFileSize,
+        Time maxFileSpan):
+        baseName(fileName),
+        maxSize(maxFileSize), maxSpan(maxFileSpan)
+    {
+        out.open(baseName, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            throw(std::runtime_error("unable to open record log " + baseName));
+        }
+        buffer.reserve(writeBlockSize);
+        buffer.append(logFileHeader, sizeof(logFileHeader));
+        writer = std::thread([this]() { writerLoop(); });
+    }
+
+    RecordLogWriter::~RecordLogWriter()
+    {
+        try {
+            close();
+        }
+        catch (...) {
+        }
+    }
+
+    void RecordLogWriter::startRecord(Time time)
+    {
+        bool rotate{false};
+        auto currentSize = fileBytes + buffer.size();
+        if (maxSize > 0 && currentSize > sizeof(logFileHeader) && currentSize >= maxSize) {
+            rotate = true;
+        }
+        if (maxSpan > timeZero && fileStart != Time::minVal() && time - fileStart >= maxSpan) {
+            rotate = true;
+        }
+        if (rotate) {
+            commit(true);
+            ++currentFile;
+            fileBytes = 0;
+            keyWritten.assign(keyWritten.size(), false);
+            buffer.append(logFileHeader, sizeof(logFileHeader));
+            fileStart = time;
+        } else if (fileStart == Time::minVal()) {
+            fileStart = time;
+        }
+    }
+
+    void RecordLogWriter::addValue(
+        Time time,
+        int iteration,
+        int index,
+        const std::string& key,
+        const std::string& type,
+        const data_view& value,
+        bool first)
+    {
+        if (closed || index < 0) {
+            return;
+        }
+        startRecord(time);
+        auto uindex = static_cast<std::size_t>(index);
+        if (uindex >= keyWritten.size()) {
+            keyWritten.resize(uindex + 1, false);
+        }
+        if (!keyWritten[uindex]) {
+            buffer.push_back(keyRecord);
+            appendVarint(buffer, uindex);
+            appendString(buffer, key);
+            appendString(buffer, type);
+            keyWritten[uindex] = true;
+        }
+        buffer.push_back(valueRecord);
+        appendVarint(buffer, uindex);
+        appendSigned(buffer, time.getBaseTimeCode());
+        appendVarint(buffer, static_cast<std::uint64_t>((iteration > 0) ? iteration : 0));
+        buffer.push_back(first ? '\x01' : '\x00');
+        appendString(buffer, value);
+        if (buffer.size() >= writeBlockSize) {
+            commit(false);
+        }
+    }
+
+    void RecordLogWriter::addMessage(const Message& message)
+    {
+        if (closed) {
+            return;
+        }
+        startRecord(message.time);
+        buffer.push_back(messageRecord);
+        appendSigned(buffer, message.time.getBaseTimeCode());
+        appendVarint(buffer, message.flags);
+        appendSigned(buffer, message.messageID);
+        appendString(buffer, message.source);
+        appendString(buffer, message.original_source);
+        appendString(buffer, message.dest);
+        appendString(buffer, message.original_dest);
+        appendString(buffer, message.data);
+        if (buffer.size() >= writeBlockSize) {
+            commit(false);
+        }
+    }
+
+    void RecordLogWriter::commit(bool rotate)
+    {
+        if (buffer.empty() && !rotate) {
+            return;
+        }
+        std::string block;
+        block.reserve(writeBlockSize);
+        block.swap(buffer);
+        auto blockSize = block.size();
+        std::unique_lock<std::mutex> lock(queueLock);
+        queueCondition.wait(
+            lock, [this]() { return pendingBytes <= maxPendingBytes || writeFailed; });
+        if (writeFailed) {
+            lock.unlock();
+            reportWriteError();
+        }
+        pending.emplace_back(std::move(block), rotate);
+        pendingBytes += blockSize;
+        ++committedBlocks;
+        lock.unlock();
+        queueCondition.notify_all();
+        fileBytes += blockSize;
+    }
+
+    void RecordLogWriter::flush()
+    {
+        if (closed) {
+            return;
+        }
+        commit(false);
+        std::unique_lock<std::mutex> lock(queueLock);
+        queueCondition.wait(lock, [this]() { return writtenBlocks == committedBlocks; });
+        if (writeFailed) {
+            lock.unlock();
+            reportWriteError();
+        }
+    }
+
+    void RecordLogWriter::close()
+    {
+        if (closed) {
+            return;
+        }
+        commit(false);
+        stopWriterThread();
+        closed = true;
+        if (writeFailed) {
+            throw(std::runtime_error(writeError));
+        }
+    }
+
+    void RecordLogWriter::stopWriterThread()
+    {
+        {
+            std::lock_guard<std::mutex> lock(queueLock);
+            stopWriter = true;
+        }
+        queueCondition.notify_all();
+        if (writer.joinable()) {
+            writer.join();
+        }
+    }
+
+    void RecordLogWriter::reportWriteError()
+    {
+        // nothing more is accepted, the writer thread discards the blocks still queued
+        buffer.clear();
+        stopWriterThread();
+        closed = true;
+        throw(std::runtime_error(writeError));
+    }
+
+    void RecordLogWriter::writerLoop()
+    {
+        int sequence{0};
+        bool failed{false};
+        std::string error;
+        std::unique_lock<std::mutex> lock(queueLock);
+        while (true) {
+            queueCondition.wait(lock, [this]() { return !pending.empty() || stopWriter; });
+            if (pending.empty()) {
+                break;
+            }
+            auto block = std::move(pending.front());
+            pending.pop_front();
+            lock.unlock();
+
+            // after a failure the remaining blocks are discarded
+            if (!failed) {
+                auto fileName = rotatedLogFileName(baseName, sequence);
+                out.write(block.first.data(), static_cast<std::streamsize>(block.first.size()));
+                if (block.second) {
+                    out.close();
+                    if (!out) {
+                        error = "unable to write record log " + fileName;
+                    } else {
+                        ++sequence;
+                        fileName = rotatedLogFileName(baseName, sequence);
+                        out.open(fileName, std::ios::binary | std::ios::trunc);
+                        if (!out) {
+                            error = "unable to open record log " + fileName;
+                        }
+                    }
+                } else {
+                    out.flush();
+                    if (!out) {
+                        error = "unable to write record log " + fileName;
+                    }
+                }
+                failed = !error.empty();
+            }
+
+            lock.lock();
+            if (failed && !writeFailed) {
+                writeFailed = true;
+                writeError = error;
+            }
+            pendingBytes -= block.first.size();
+            ++writtenBlocks;
+            queueCondition.notify_all();
+        }
+        lock.unlock();
+        out.close();
+    }
+
+    RecordLogReader::RecordLogReader(const std::string& fileName)
+    {
+        files.push_back(fileName);
+        for (int sequence = 1;; ++sequence) {
+            auto name = rotatedLogFileName(fileName, sequence);
+            std::ifstream test(name, std::ios::binary);
+            if (!test) {
+                break;
+            }
+            files.push_back(std::move(name));
+        }
+        if (!openFile(0)) {
+            throw(std::runtime_error(fileName + " is not a readable record log"));
+        }
+    }
+
+    bool RecordLogReader::openFile(std::size_t index)
+    {
+        fileIndex = index;
+        keys.clear();
+        in.close();
+        in.clear();
+        in.open(files[index], std::ios::binary | std::ios::ate);
+        auto end = in.tellg();
+        fileSize = (end > 0) ? static_cast<std::uint64_t>(end) : 0;
+        in.seekg(0);
+        char header[sizeof(logFileHeader)];
+        in.read(header, sizeof(header));
+        return (in.gcount() == static_cast<std::streamsize>(sizeof(header)) &&
+                std::equal(header, header + sizeof(header), logFileHeader));
+    }
+
+    bool RecordLogReader::readString(std::string& str)
+    {
+        std::uint64_t size{0};
+        if (!readVarint(in, size)) {
+            return false;
+        }
+        // the length comes from the file so it is checked before any memory is allocated for it
+        auto position = in.tellg();
+        auto remaining = (position >= 0 && static_cast<std::uint64_t>(position) <= fileSize) ?
+            fileSize - static_cast<std::uint64_t>(position) :
+            0;
+        if (size > remaining) {
+            readError = "record log " + files[fileIndex] + " has a string of length " +
+                std::to_string(size) + " with only " + std::to_string(remaining) +
+                " bytes remaining";
+            return false;
+        }
+        str.resize(static_cast<std::size_t>(size));
+        if (size > 0) {
+            in.read(&str[0], static_cast<std::streamsize>(size));
+        }
+        return static_cast<std::uint64_t>(in.gcount()) == size || size == 0;
+    }
+
+    void RecordLogReader::reset()
+    {
+        readError.clear();
+        openFile(0);
+    }
+
+    bool RecordLogReader::next(RecordLogEntry& entry)
+    {
+        if (!readError.empty()) {
+            return false;
+        }
+        while (true) {
+            auto code = in.get();
+            bool valid{true};
+            switch (code) {
+                case keyRecord: {
+                    std::uint64_t index{0};
+                    std::string key;
+                    std::string type;
+                    valid = readVarint(in, index) && readString(key) && readString(type);
+                    if (valid && index > fileSize) {
+                        // every index has its own key record so no valid index exceeds the file size
+                        readError = "record log " + files[fileIndex] + " has a key index of " +
+                            std::to_string(index);
+                        valid = false;
+                    }
+                    if (valid) {
+                        if (index >= keys.size()) {
+                            keys.resize(static_cast<std::size_t>(index) + 1);
+                        }
+                        keys[static_cast<std::size_t>(index)] = {std::move(key), std::move(type)};
+                        continue;
+                    }
+                } break;
+                case valueRecord: {
+                    std::uint64_t index{0};
+                    std::uint64_t iteration{0};
+                    valid = readVarint(in, index) && readTime(in, entry.time) &&
+                        readVarint(in, iteration);
+                    auto first = in.get();
+                    if (valid && first != std::char_traits<char>::eof() && readString(rawValue)) {
+                        entry.isMessage = false;
+                        entry.iteration = static_cast<int>(iteration);
+                        entry.first = (first != 0);
+                        if (index < keys.size()) {
+                            entry.key = keys[static_cast<std::size_t>(index)].first;
+                            entry.type = keys[static_cast<std::size_t>(index)].second;
+                        } else {
+                            entry.key.clear();
+                            entry.type.clear();
+                        }
+                        entry.value = valueString(rawValue, getTypeFromString(entry.type));
+                        return true;
+                    }
+                    valid = false;
+                } break;
+                case messageRecord: {
+                    auto& mess = entry.message;
+                    std::uint64_t flags{0};
+                    std::int64_t messageID{0};
+                    std::string data;
+                    valid = readTime(in, mess.time) && readVarint(in, flags) &&
+                        readSigned(in, messageID) && readString(mess.source) &&
+                        readString(mess.original_source) && readString(mess.dest) &&
+                        readString(mess.original_dest) && readString(data);
+                    if (valid) {
+                        entry.isMessage = true;
+                        entry.time = mess.time;
+                        mess.flags = static_cast<std::uint16_t>(flags);
+                        mess.messageID = static_cast<int32_t>(messageID);
+                        mess.data = std::move(data);
+                        return true;
+                    }
+                } break;
+                default:
+                    // the end of the file or a record cut off by a recording that did not finish
+                    valid = false;
+                    break;
+            }
+            if (!valid) {
+                if (!readError.empty()) {
+                    // nothing after a corrupt record can be trusted
+                    return false;
+                }
+                bool opened{false};
+                while (!opened && fileIndex + 1 < files.size()) {
+                    opened = openFile(fileIndex + 1);
+                }
+                if (!opened) {
+                    return false;
+                }
+            }
+        }
+    }
+
+    /** encode the string in base64*/
+    static std::string encode(const std::string& str2encode)
+    {
+        return std::string("b64[") +
+            gmlc::utilities::base64_encode(
+                   reinterpret_cast<const unsigned char*>(str2encode.c_str()),
+                   static_cast<int>(str2encode.size())) +
+            ']';
+    }
+
+    /** check if a message was delivered through the recorder clone endpoint*/
+    static bool isCloned(const Message& mess)
+    {
+        return (mess.dest.size() >= 7) && (mess.dest.compare(mess.dest.size() - 6, 6, "cloneE") == 0);
+    }
+
+    /** exporter writing the tab separated text format*/
+    class TextRecordExporter: public RecordExporter {
+      public:
+        explicit TextRecordExporter(const std::string& fileName): outFile(fileName) {}
+        virtual void addValue(
+            Time time,
+            int iteration,
+            const std::string& key,
+            const std::string& value,
+            const std::string& type,
+            bool first) override
+        {
+            if (!valueHeader) {
+                outFile << "#time \ttag\t value\t type*\n";
+                valueHeader = true;
+            }
+            if (first) {
+                outFile << static_cast<double>(time) << "\t\t" << key << '\t' << value << '\t'
+                        << type << '\n';
+            } else if (iteration > 0) {
+                outFile << static_cast<double>(time) << ':' << iteration << "\t\t" << key << '\t'
+                        << value << '\n';
+            } else {
+                outFile << static_cast<double>(time) << "\t\t" << key << '\t' << value << '\n';
+            }
+        }
+        virtual void addMessage(const Message& mess) override
+        {
+            if (!messageHeader) {
+                outFile << "# m\t time \tsource\t dest\t message\n";
+                messageHeader = true;
+            }
+            outFile << "m\t" << static_cast<double>(mess.time) << '\t' << mess.source << '\t'
+                    << (isCloned(mess) ? mess.original_dest : mess.dest);
+            if (isBinaryData(mess.data)) {
+                outFile << "\t\"" << encode(mess.data.to_string()) << "\"\n";
+            } else {
+                outFile << "\t\"" << mess.data.to_string() << "\"\n";
+            }
+        }
+        virtual void finish() override { outFile.flush(); }
+
+      private:
+        std::ofstream outFile;
+        bool valueHeader{false};
+        bool messageHeader{false};
+    };
+
+    /** exporter writing the JSON format one element at a time*/
+    class JsonRecordExporter: public RecordExporter {
+      public:
+        explicit JsonRecordExporter(const std::string& fileName): outFile(fileName)
+        {
+            Json::StreamWriterBuilder builder;
+            builder["commentStyle"] = "None";
+            builder["indentation"] = "   ";
+            writer.reset(builder.newStreamWriter());
+            outFile << '{';
+        }
+        virtual void addValue(
+            Time time,
+            int iteration,
+            const std::string& key,
+            const std::string& value,
+            const std::string& type,
+            bool first) override
+        {
+            Json::Value point;
+            point["key"] = key;
+            point["value"] = value;
+            point["time"] = static_cast<double>(time);
+            if (iteration > 0) {
+                point["iteration"] = iteration;
+            }
+            if (first) {
+                point["type"] = type;
+            }
+            writeElement("points", point);
+        }
+        virtual void addMessage(const Message& mess) override
+        {
+            Json::Value message;
+            message["time"] = static_cast<double>(mess.time);
+            message["src"] = mess.source;
+            if ((!mess.original_source.empty()) && (mess.original_source != mess.source)) {
+                message["original_source"] = mess.original_source;
+            }
+            if (!isCloned(mess)) {
+                message["dest"] = mess.dest;
+                message["orig_dest"] = mess.original_dest;
+            } else {
+                message["dest"] = mess.original_dest;
+            }
+            if (isBinaryData(mess.data)) {
+                message["encoding"] = "base64";
+                message["message"] = encode(mess.data.to_string());
+            } else {
+                message["message"] = mess.data.to_string();
+            }
+            writeElement("messages", message);
+        }
+        virtual void finish() override
+        {
+            if (!section.empty()) {
+                outFile << "\n]";
+            }
+            outFile << "\n}" << std::endl;
+            section.clear();
+        }
+
+      private:
+        /** write an element of an array starting the array if needed*/
+        void writeElement(const char* arrayName, const Json::Value& element)
+        {
+            if (section != arrayName) {
+                outFile << (section.empty() ? "\n\"" : "\n],\n\"") << arrayName << "\": [\n";
+                section = arrayName;
+            } else {
+                outFile << ",\n";
+            }
+            writer->write(element, &outFile);
+        }
+        std::ofstream outFile;
+        std::unique_ptr<Json::StreamWriter> writer; //!< writer reused for every element
+        std::string section; //!< the name of the array being written
+    };
+
+    std::unique_ptr<RecordExporter> makeRecordExporter(const std::string& outputFile)
+    {
+        auto lastP = outputFile.find_last_of('.');
+        auto ext = (lastP != std::string::npos) ? outputFile.substr(lastP) : std::string{};
+        if ((ext == ".json") || (ext == ".JSON")) {
+            return std::make_unique<JsonRecordExporter>(outputFile);
+        }
+        return std::make_unique<TextRecordExporter>(outputFile);
+    }
+
+    void exportRecordLog(const std::string& logFile, const std::string& outputFile)
+    {
+        RecordLogReader reader(logFile);
+        auto exporter = makeRecordExporter(outputFile);
+        RecordLogEntry entry;
+        // the output formats list all the values before the messages
+        while (reader.next(entry)) {
+            if (!entry.isMessage) {
+                exporter->addValue(
+                    entry.time, entry.iteration, entry.key, entry.value, entry.type, entry.first);
+            }
+        }
+        reader.reset();
+        while (reader.next(entry)) {
+            if (entry.isMessage) {
+                exporter->addMessage(entry.message);
+            }
+        }
+        exporter->finish();
+        if (!reader.getError().empty()) {
+            throw(std::runtime_error(reader.getError()));
+        }
+    }
+
+} // namespace apps
+} // namespace helics
@@ -0,0 +1,207 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+#include "../application_api/data_view.hpp"
+#include "../core/core-data.hpp"
+#include "../helics_cxx_export.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace helics {
+namespace apps {
+    /** get the name of a file in a rotated sequence of record log files
+    @details the first file uses the base name,  later files have the sequence number inserted before the
+    extension,  so out.hlog is followed by out.1.hlog and out.2.hlog
+    */
+    HELICS_CXX_EXPORT std::string rotatedLogFileName(const std::string& baseName, int sequence);
+
+    /** class writing captured values and messages to a binary record log
+    @details records are encoded on the calling thread and written to disk by a background thread,  the amount of
+    data waiting to be written is bounded so memory use stays fixed no matter how long the recording runs.  The log
+    can be split over a sequence of files based on the size of the file or the span of simulation time it covers,
+    each file can be read on its own.
+
+    The log is a sequence of records following a 4 byte file header "HLG1",  each record starts with a code
+    character,  integers are written as variable length integers and strings are written as a length followed by
+    the characters
+     - 'K' index, key, type : the key and type of a captured value index,  written before the first value for an
+    index in each file
+     - 'V' index, time, iteration, first, value : a captured value in its published binary form
+     - 'M' time, flags, source, original_source, dest, original_dest, data : a captured message
+    */
+    class HELICS_CXX_EXPORT RecordLogWriter {
+      public:
+        /** open a log for writing
+        @param fileName the name of the first file of the log
+        @param maxFileSize start a new file when the current one reaches this many bytes,  0 for no limit
+        @param maxFileSpan start a new file when the current one covers this much simulation time, 0 for no limit
+        @throw std::runtime_error if the file cannot be opened
+        */
+        explicit RecordLogWriter(
+            const std::string& fileName,
+            std::uint64_t maxFileSize = 0,
+            Time maxFileSpan = timeZero);
+        /** destructor writes all remaining data and closes the log*/
+        ~RecordLogWriter();
+        RecordLogWriter(const RecordLogWriter&) = delete;
+        RecordLogWriter& operator=(const RecordLogWriter&) = delete;
+
+        /** add a captured value
+        @param time the time the value was captured
+        @param iteration the iteration count of the capture
+        @param index the index identifying the source of the value
+        @param key the name of the source,  only recorded with the first value of an index in each file
+        @param type the type of the source,  only recorded with the first value of an index in each file
+        @param value the value in the binary form it was published in
+        @param first true if this is the first value captured from the source
+        */
+        void addValue(
+            Time time,
+            int iteration,
+            int index,
+            const std::string& key,
+            const std::string& type,
+            const data_view& value,
+            bool first);
+        /** add a captured message*/
+        void addMessage(const Message& message);
+        /** write everything added so far to disk and wait for it to complete
+        @throw std::runtime_error if a write to the log failed,  the log is closed*/
+        void flush();
+        /** write everything and close the log,  nothing can be added after closing
+        @throw std::runtime_error if a write to the log failed*/
+        void close();
+        /** get the name of the first file of the log*/
+        const std::string& getFileName() const { return baseName; }
+        /** get the number of files started so far*/
+        int fileCount() const { return currentFile + 1; }
+
+      private:
+        /** start a record,  moving to a new file if a rotation limit was reached*/
+        void startRecord(Time time);
+        /** hand the encoded records to the writer thread
+        @param rotate set to true to start a new file after writing the records
+        @throw std::runtime_error if a write to the log failed,  the log is closed*/
+        void commit(bool rotate);
+        /** the loop of the writer thread*/
+        void writerLoop();
+        /** stop the writer thread once everything committed has been handled*/
+        void stopWriterThread();
+        /** close the log after a failed write and throw the error*/
+        void reportWriteError();
+
+        std::string baseName; //!< the name of the first file
+        std::uint64_t maxSize{0}; //!< the file size triggering rotation
+        Time maxSpan{timeZero}; //!< the span of time triggering rotation
+        std::string buffer; //!< records waiting to be handed to the writer thread
+        std::uint64_t fileBytes{0}; //!< the number of bytes committed to the current file
+        Time fileStart{Time::minVal()}; //!< the time of the first record in the current file
+        int currentFile{0}; //!< the sequence number of the current file
+        std::vector<bool> keyWritten; //!< indicators that the key record for an index is in the current file
+        bool closed{false}; //!< indicator that the log was closed
+
+        std::ofstream out; //!< the file being written,  only used by the writer thread after construction
+        std::mutex queueLock; //!< lock protecting the queue
+        std::condition_variable queueCondition; //!< condition signaling changes in the queue
+        std::deque<std::pair<std::string, bool>> pending; //!< blocks waiting to be written
+        std::size_t pendingBytes{0}; //!< the number of bytes waiting to be written
+        std::uint64_t committedBlocks{0}; //!< the number of blocks handed to the writer thread
+        std::uint64_t writtenBlocks{0}; //!< the number of blocks written by the writer thread
+        bool stopWriter{false}; //!< indicator that the writer thread should finish
+        bool writeFailed{false}; //!< indicator that the writer thread failed to write a block
+        std::string writeError; //!< the description of the failed write
+        std::thread writer; //!< the writer thread
+    };
+
+    /** a value or message read from a record log*/
+    class RecordLogEntry {
+      public:
+        bool isMessage{false}; //!< true if the entry is a message
+        Time time{timeZero}; //!< the time of the value or message
+        int iteration{0}; //!< the iteration count of a value
+        bool first{false}; //!< true if the value is the first value from its source
+        std::string key; //!< the name of the source of a value
+        std::string type; //!< the type of the source of a value
+        std::string value; //!< the string representation of the value
+        Message message; //!< the message
+    };
+
+    /** class reading the values and messages from a record log in the order they were written*/
+    class HELICS_CXX_EXPORT RecordLogReader {
+      public:
+        /** open a log,  including any files the log was rotated into
+        @throw std::runtime_error if the first file cannot be opened or is not a record log*/
+        explicit RecordLogReader(const std::string& fileName);
+        /** read the next entry
+        @return false if there are no more entries or a corrupt record was found*/
+        bool next(RecordLogEntry& entry);
+        /** go back to the start of the log*/
+        void reset();
+        /** get the files making up the log*/
+        const std::vector<std::string>& getFiles() const { return files; }
+        /** get the description of the corrupt record that ended the log,  empty if the log was read to the end*/
+        const std::string& getError() const { return readError; }
+
+      private:
+        /** open one of the files of the log
+        @return false if the file could not be opened or is not a record log*/
+        bool openFile(std::size_t index);
+        /** read a length prefixed string,  a length past the end of the file is recorded as an error
+        @return false if the string could not be read*/
+        bool readString(std::string& str);
+
+        std::vector<std::string> files; //!< the files of the log in order
+        std::size_t fileIndex{0}; //!< the index of the file being read
+        std::ifstream in; //!< the file being read
+        std::uint64_t fileSize{0}; //!< the size of the file being read
+        std::string readError; //!< description of a corrupt record found while reading
+        std::vector<std::pair<std::string, std::string>> keys; //!< the key and type for each value index
+        std::string rawValue; //!< buffer for the binary form of a value
+    };
+
+    /** interface for writing captured values and messages in one of the recorder output formats
+    @details all the values must be added before any messages*/
+    class HELICS_CXX_EXPORT RecordExporter {
+      public:
+        virtual ~RecordExporter() = default;
+        /** add a captured value
+        @param type the type of the source,  written with the first value from each source*/
+        virtual void addValue(
+            Time time,
+            int iteration,
+            const std::string& key,
+            const std::string& value,
+            const std::string& type,
+            bool first) = 0;
+        /** add a captured message*/
+        virtual void addMessage(const Message& message) = 0;
+        /** complete the output*/
+        virtual void finish() = 0;
+    };
+
+    /** create an exporter writing a file in the text or JSON recorder format based on its extension*/
+    HELICS_CXX_EXPORT std::unique_ptr<RecordExporter> makeRecordExporter(const std::string& outputFile);
+
+    /** export a record log to a text or JSON file that can be loaded by the Player
+    @param logFile the name of the first file of the log
+    @param outputFile the file to write,  the format is determined by the extension
+    @throw std::runtime_error if the log contains a corrupt record,  the entries before it are still exported
+    */
+    HELICS_CXX_EXPORT void exportRecordLog(const std::string& logFile, const std::string& outputFile);
+
+} // namespace apps
+} // namespace helics
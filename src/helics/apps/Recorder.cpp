@@ -15,7 +15,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../common/loggerCore.hpp"
 #include "../core/helicsCLI11.hpp"
 #include "PrecHelper.hpp"
-#include "gmlc/utilities/base64.h"
+#include "RecordLog.hpp"
 #include "gmlc/utilities/stringOps.h"
 
 #include <algorithm>
@@ -47,6 +47,7 @@ namespace apps {
         if (!deactivated) {
             fed->setFlagOption(helics_flag_observer);
             app->parse(remArgs);
+            exportLog = (app->get_option("--output")->count() > 0);
             if (!masterFileName.empty()) {
                 loadFile(masterFileName);
             }
@@ -81,12 +82,24 @@ namespace apps {
     Recorder::~Recorder()
     {
         try {
-            saveFile(outFileName);
+            if (logWriter) {
+                // a streamed capture is only exported if an output file was requested
+                logWriter->close();
+                if (exportLog) {
+                    exportRecordLog(logWriter->getFileName(), outFileName);
+                }
+            } else {
+                saveFile(outFileName);
+            }
         }
         catch (...) {
         }
     }
 
+    Recorder::Recorder(Recorder&& other_recorder) = default;
+
+    Recorder& Recorder::operator=(Recorder&& other_recorder) = default;
+
     void Recorder::loadJsonFile(const std::string& jsonString)
     {
         loadJsonFileConfiguration("recorder", jsonString);
@@ -216,103 +229,20 @@ namespace apps {
         infile.close();
     }
 
-    void Recorder::writeJsonFile(const std::string& filename)
-    {
-        Json::Value doc;
-        if (!points.empty()) {
-            doc["points"] = Json::Value(Json::arrayValue);
-            for (auto& v : points) {
-                Json::Value point;
-                point["key"] = subscriptions[v.index].getTarget();
-                point["value"] = v.value;
-                point["time"] = static_cast<double>(v.time);
-                if (v.iteration > 0) {
-                    point["iteration"] = v.iteration;
-                }
-                if (v.first) {
-                    point["type"] = subscriptions[v.index].getPublicationType();
-                }
-                doc["points"].append(point);
-            }
-        }
-
-        if (!messages.empty()) {
-            doc["messages"] = Json::Value(Json::arrayValue);
-            for (auto& mess : messages) {
-                Json::Value message;
-                message["time"] = static_cast<double>(mess->time);
-                message["src"] = mess->source;
-                if ((!mess->original_source.empty()) && (mess->original_source != mess->source)) {
-                    message["original_source"] = mess->original_source;
-                }
-                if ((mess->dest.size() < 7) ||
-                    (mess->dest.compare(mess->dest.size() - 6, 6, "cloneE") != 0)) {
-                    message["dest"] = mess->dest;
-                    message["orig_dest"] = mess->original_dest;
-                } else {
-                    message["dest"] = mess->original_dest;
-                }
-                if (isBinaryData(mess->data)) {
-                    message["encoding"] = "base64";
-                    message["message"] = encode(mess->data.to_string());
-                } else {
-                    message["message"] = mess->data.to_string();
-                }
-                doc["messages"].append(message);
-            }
-        }
-
-        std::ofstream o(filename);
-        o << doc << std::endl;
-    }
-
-    void Recorder::writeTextFile(const std::string& filename)
-    {
-        std::ofstream outFile(filename.empty() ? outFileName : filename);
-        if (!points.empty()) {
-            outFile << "#time \ttag\t value\t type*\n";
-        }
-        for (auto& v : points) {
-            if (v.first) {
-                outFile << static_cast<double>(v.time) << "\t\t"
-                        << subscriptions[v.index].getTarget() << '\t' << v.value << '\t'
-                        << subscriptions[v.index].getPublicationType() << '\n';
-            } else {
-                if (v.iteration > 0) {
-                    outFile << static_cast<double>(v.time) << ':' << v.iteration << "\t\t"
-                            << subscriptions[v.index].getTarget() << '\t' << v.value << '\n';
-                } else {
-                    outFile << static_cast<double>(v.time) << "\t\t"
-                            << subscriptions[v.index].getTarget() << '\t' << v.value << '\n';
-                }
-            }
-        }
-        if (!messages.empty()) {
-            outFile << "# m\t time \tsource\t dest\t message\n";
-        }
-        for (auto& m : messages) {
-            outFile << "m\t" << static_cast<double>(m->time) << '\t' << m->source << '\t';
-            if ((m->dest.size() < 7) || (m->dest.compare(m->dest.size() - 6, 6, "cloneE") != 0)) {
-                outFile << m->dest;
-            } else {
-                outFile << m->original_dest;
-            }
-            if (isBinaryData(m->data)) {
-                outFile << "\t\"" << encode(m->data.to_string()) << "\"\n";
-            } else {
-                outFile << "\t\"" << m->data.to_string() << "\"\n";
-            }
-        }
-    }
-
     void Recorder::initialize()
     {
+        if (!logFileName.empty() && !logWriter) {
+            logWriter =
+                std::make_unique<RecordLogWriter>(logFileName, maxLogFileSize, maxLogFileSpan);
+        }
         generateInterfaces();
 
         vStat.resize(subids.size());
         for (auto& val : subkeys) {
             vStat[val.second].key = val.first;
         }
+        // collect the subscriptions as their updates arrive so a capture skips the rest
+        trackSubscriptionUpdates(subids, updatedSubscriptions);
 
         fed->enterInitializingMode();
         captureForCurrentTime(-1.0);
@@ -352,47 +282,68 @@ namespace apps {
     void Recorder::captureForCurrentTime(Time currentTime, int iteration)
     {
         static auto logger = LoggerManager::getLoggerCore();
-        for (auto& sub : subscriptions) {
-            if (sub.isUpdated()) {
-                auto val = sub.getValue<std::string>();
-                int ii = subids[sub.getHandle()];
-                points.emplace_back(currentTime, ii, val);
-                if (iteration > 0) {
-                    points.back().iteration = iteration;
-                }
+        for (auto ii : updatedSubscriptions) {
+            auto& sub = subscriptions[ii];
+            auto val = sub.getRawValue();
+            bool first = (vStat[ii].cnt == 0);
+            if (logWriter) {
+                logWriter->addValue(
+                    currentTime,
+                    iteration,
+                    ii,
+                    sub.getTarget(),
+                    sub.getPublicationType(),
+                    val,
+                    first);
+                ++streamedPoints;
+            }
+            if (verbose || !mapfile.empty()) {
+                auto valstr = valueString(val, getTypeFromString(sub.getPublicationType()));
                 if (verbose) {
-                    std::string valstr;
-                    if (val.size() < 150) {
+                    std::string message;
+                    if (valstr.size() < 150) {
                         if (iteration > 0) {
-                            valstr = fmt::format(
-                                "[{}:{}]value {}={}", currentTime, iteration, sub.getTarget(), val);
+                            message = fmt::format(
+                                "[{}:{}]value {}={}",
+                                currentTime,
+                                iteration,
+                                sub.getTarget(),
+                                valstr);
                         } else {
-                            valstr =
-                                fmt::format("[{}]value {}={}", currentTime, sub.getTarget(), val);
+                            message = fmt::format(
+                                "[{}]value {}={}", currentTime, sub.getTarget(), valstr);
                         }
                     } else {
                         if (iteration > 0) {
-                            valstr = fmt::format(
+                            message = fmt::format(
                                 "[{}:{}]value {}=block[{}]",
                                 currentTime,
                                 iteration,
                                 sub.getTarget(),
-                                val.size());
+                                valstr.size());
                         } else {
-                            valstr = fmt::format(
-                                "[{}]value {}=block[{}]", currentTime, sub.getTarget(), val.size());
+                            message = fmt::format(
+                                "[{}]value {}=block[{}]",
+                                currentTime,
+                                sub.getTarget(),
+                                valstr.size());
                         }
                     }
-                    logger->addMessage(std::move(valstr));
+                    logger->addMessage(std::move(message));
                 }
-                if (vStat[ii].cnt == 0) {
-                    points.back().first = true;
+                vStat[ii].lastVal = std::move(valstr);
+            }
+            if (!logWriter) {
+                points.emplace_back(currentTime, ii, std::move(val));
+                if (iteration > 0) {
+                    points.back().iteration = iteration;
                 }
-                ++vStat[ii].cnt;
-                vStat[ii].lastVal = val;
-                vStat[ii].time = -1.0;
+                points.back().first = first;
             }
+            ++vStat[ii].cnt;
+            vStat[ii].time = -1.0;
         }
+        updatedSubscriptions.clear();
 
         for (auto& ept : endpoints) {
             while (ept.hasMessage()) {
@@ -416,24 +367,25 @@ namespace apps {
                     }
                     logger->addMessage(std::move(messstr));
                 }
-                messages.push_back(std::move(mess));
+                storeMessage(std::move(mess));
             }
         }
         // get the clone endpoints
         if (cloneEndpoint) {
             while (cloneEndpoint->hasMessage()) {
-                messages.push_back(cloneEndpoint->getMessage());
+                storeMessage(cloneEndpoint->getMessage());
             }
         }
     }
 
-    std::string Recorder::encode(const std::string& str2encode)
+    void Recorder::storeMessage(std::unique_ptr<Message> mess)
     {
-        return std::string("b64[") +
-            gmlc::utilities::base64_encode(
-                   reinterpret_cast<const unsigned char*>(str2encode.c_str()),
-                   static_cast<int>(str2encode.size())) +
-            ']';
+        if (logWriter) {
+            logWriter->addMessage(*mess);
+            ++streamedMessages;
+        } else {
+            messages.push_back(std::move(mess));
+        }
     }
 
     /** run the Player until the specified time*/
@@ -552,7 +504,9 @@ namespace apps {
     std::pair<std::string, std::string> Recorder::getValue(int index) const
     {
         if (isValidIndex(index, points)) {
-            return {subscriptions[points[index].index].getTarget(), points[index].value};
+            const auto& sub = subscriptions[points[index].index];
+            return {sub.getTarget(),
+                    valueString(points[index].value, getTypeFromString(sub.getPublicationType()))};
         }
         return {std::string(), std::string()};
     }
@@ -568,13 +522,42 @@ namespace apps {
     /** save the data to a file*/
     void Recorder::saveFile(const std::string& filename)
     {
-        auto lastP = filename.find_last_of('.');
-        auto ext = (lastP != std::string::npos) ? filename.substr(lastP) : std::string{};
-        if ((ext == ".json") || (ext == ".JSON")) {
-            writeJsonFile(filename);
-        } else {
-            writeTextFile(filename);
+        const auto& outputFile = filename.empty() ? outFileName : filename;
+        if (logWriter) {
+            logWriter->flush();
+            exportRecordLog(logWriter->getFileName(), outputFile);
+            return;
+        }
+        std::vector<data_type> types;
+        types.reserve(subscriptions.size());
+        for (auto& sub : subscriptions) {
+            types.push_back(getTypeFromString(sub.getPublicationType()));
         }
+        auto exporter = makeRecordExporter(outputFile);
+        for (auto& v : points) {
+            auto& sub = subscriptions[v.index];
+            exporter->addValue(
+                v.time,
+                v.iteration,
+                sub.getTarget(),
+                valueString(v.value, types[v.index]),
+                sub.getPublicationType(),
+                v.first);
+        }
+        for (auto& mess : messages) {
+            exporter->addMessage(*mess);
+        }
+        exporter->finish();
+    }
+
+    void Recorder::streamToFile(
+        const std::string& logFile,
+        std::uint64_t maxFileSize,
+        Time maxFileSpan)
+    {
+        logFileName = logFile;
+        maxLogFileSize = maxFileSize;
+        maxLogFileSpan = maxFileSpan;
     }
 
     std::shared_ptr<helicsCLI11App> Recorder::buildArgParserApp()
@@ -596,6 +579,27 @@ namespace apps {
 
         app->add_option("--output,-o", outFileName, "the output file for recording the data", true);
 
+        auto stream_group = app->add_option_group(
+            "streaming", "Options related to streaming the captured data to a binary record log");
+        stream_group
+            ->add_option(
+                "--stream_file",
+                logFileName,
+                "write the captured data to a binary record log as it is captured instead of keeping it in memory")
+            ->ignore_underscore();
+        stream_group
+            ->add_option(
+                "--rotate_size",
+                maxLogFileSize,
+                "start a new record log file when the current one reaches this many bytes")
+            ->ignore_underscore();
+        stream_group
+            ->add_option(
+                "--rotate_time",
+                maxLogFileSpan,
+                "start a new record log file when the current one covers this much time")
+            ->ignore_underscore();
+
         auto clone_group = app->add_option_group(
             "cloning", "Options related to endpoint cloning operations and specifications");
         clone_group->add_option("--clone", "existing endpoints to clone all packets to and from")
@@ -10,14 +10,18 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../application_api/Subscriptions.hpp"
 #include "helicsApp.hpp"
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <set>
+#include <utility>
 
 namespace helics {
 class CloningFilter;
 
 namespace apps {
+    class RecordLogWriter;
+
     /** class designed to capture data points from a set of subscriptions or endpoints*/
     class HELICS_CXX_EXPORT Recorder: public App {
       public:
@@ -54,9 +58,9 @@ namespace apps {
     */
         Recorder(const std::string& name, const std::string& file);
         /** move construction*/
-        Recorder(Recorder&& other_recorder) = default;
+        Recorder(Recorder&& other_recorder);
         /** move assignment*/
-        Recorder& operator=(Recorder&& other_recorder) = default;
+        Recorder& operator=(Recorder&& other_recorder);
         /** destructor*/
         ~Recorder();
         /** run the Player until the specified time*/
@@ -73,13 +77,26 @@ namespace apps {
     @param captureDesc describes a federate to capture all the interfaces for
     */
         void addCapture(const std::string& captureDesc);
-        /** save the data to a file*/
+        /** save the data to a file
+        @details if the data is being streamed to a record log the log is exported to the file*/
         void saveFile(const std::string& filename);
+        /** write the captured data to a binary record log as it is captured instead of keeping it in memory
+        @details must be called before the recorder is initialized,  the log can be converted to the text or JSON
+        formats with saveFile or exportRecordLog
+        @param logFile the name of the first file of the log
+        @param maxFileSize start a new log file when the current one reaches this many bytes,  0 for no limit
+        @param maxFileSpan start a new log file when the current one covers this much time,  0 for no limit
+        */
+        void streamToFile(
+            const std::string& logFile,
+            std::uint64_t maxFileSize = 0,
+            Time maxFileSpan = timeZero);
         /** get the number of captured points*/
-        auto pointCount() const { return points.size(); }
+        auto pointCount() const { return points.size() + streamedPoints; }
         /** get the number of captured messages*/
-        auto messageCount() const { return messages.size(); }
+        auto messageCount() const { return messages.size() + streamedMessages; }
         /** get a string with the value of point index
+    @details points written to a record log are not available
     @param index the number of the point to retrieve
     @return a pair with the tag as the first element and the value as the second
     */
@@ -97,17 +114,15 @@ namespace apps {
         virtual void loadJsonFile(const std::string& jsonString) override;
         /** load a text file*/
         virtual void loadTextFile(const std::string& textFile) override;
-        /** helper function to write the date to a JSON file*/
-        void writeJsonFile(const std::string& filename);
-        /** helper function to write the date to a text file*/
-        void writeTextFile(const std::string& filename);
 
         virtual void initialize() override;
         void generateInterfaces();
+        /** capture the values and messages received since the last capture
+        @details only the subscriptions reported as updated by the federate are visited*/
         void captureForCurrentTime(Time currentTime, int iteration = 0);
+        /** keep a captured message in memory or write it to the record log*/
+        void storeMessage(std::unique_ptr<Message> mess);
         void loadCaptureInterfaces();
-        /** encode the string in base64 if needed otherwise just return the string*/
-        std::string encode(const std::string& str2encode);
         /** build the command line argument processing application*/
         std::shared_ptr<helicsCLI11App> buildArgParserApp();
         /** process remaining command line arguments*/
@@ -121,10 +136,10 @@ namespace apps {
             int index = -1;
             int16_t iteration = 0;
             bool first = false;
-            std::string value;
+            data_view value; //!< the value in the binary form it was published in
             ValueCapture() = default;
-            ValueCapture(helics::Time t1, int id1, const std::string& val):
-                time(t1), index(id1), value(val){};
+            ValueCapture(helics::Time t1, int id1, data_view val):
+                time(t1), index(id1), value(std::move(val)){};
         };
 
         /** helper class for displaying statistics*/
@@ -147,6 +162,7 @@ namespace apps {
         std::unique_ptr<Endpoint> cloneEndpoint; //!< the endpoint for cloned message delivery
         std::vector<std::unique_ptr<Message>> messages; //!< list of messages
         std::map<helics::interface_handle, int> subids; //!< map of the subscription ids
+        std::vector<int> updatedSubscriptions; //!< subscriptions updated since the last capture
         std::map<std::string, int> subkeys; //!< translate subscription names to an index
         std::map<helics::interface_handle, int> eptids; // translate subscription id to index
         std::map<std::string, int> eptNames; //!< translate endpoint name to index
@@ -154,6 +170,13 @@ namespace apps {
         std::vector<std::string> captureInterfaces; //!< storage for the interfaces to capture
         std::string mapfile; //!< file name for the on-line file updater
         std::string outFileName{"out.txt"}; //!< the final output file
+        std::string logFileName; //!< the record log file for streaming capture
+        std::uint64_t maxLogFileSize{0}; //!< the size at which the record log starts a new file
+        Time maxLogFileSpan{timeZero}; //!< the time span at which the record log starts a new file
+        bool exportLog{false}; //!< export the record log to the output file when the recorder closes
+        std::unique_ptr<RecordLogWriter> logWriter; //!< the writer for streaming capture
+        std::size_t streamedPoints{0}; //!< the number of points written to the record log
+        std::size_t streamedMessages{0}; //!< the number of messages written to the record log
     };
 
 } // namespace apps
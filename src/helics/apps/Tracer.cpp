@@ -84,6 +84,8 @@ namespace apps {
             subscriptions.emplace_back(fed->getInput(ii));
             subkeys.emplace(
                 subscriptions.back().getName(), static_cast<int>(subscriptions.size()) - 1);
+            subids.emplace(
+                subscriptions.back().getHandle(), static_cast<int>(subscriptions.size()) - 1);
         }
         auto eptCount = fed->getEndpointCount();
         for (int ii = 0; ii < eptCount; ++ii) {
@@ -206,6 +208,7 @@ namespace apps {
         auto state = fed->getCurrentMode();
         if (state == Federate::modes::startup) {
             generateInterfaces();
+            trackSubscriptionUpdates(subids, updatedSubscriptions);
 
             fed->enterInitializingMode();
             captureForCurrentTime(-1.0);
@@ -239,44 +242,47 @@ namespace apps {
     void Tracer::captureForCurrentTime(Time currentTime, int iteration)
     {
         static auto logger = LoggerManager::getLoggerCore();
-        for (auto& sub : subscriptions) {
-            if (sub.isUpdated()) {
-                auto val = sub.getValue<std::string>();
-
-                if (printMessage) {
-                    std::string valstr;
-                    if (val.size() < 150) {
-                        if (iteration > 0) {
-                            valstr = fmt::format(
-                                "[{}:{}]value {}={}", currentTime, iteration, sub.getTarget(), val);
-                        } else {
-                            valstr =
-                                fmt::format("[{}]value {}={}", currentTime, sub.getTarget(), val);
-                        }
+        for (auto ii : updatedSubscriptions) {
+            auto& sub = subscriptions[ii];
+            auto raw = sub.getRawValue();
+            if (!printMessage && !valueCallback) {
+                continue;
+            }
+            auto val = valueString(raw, getTypeFromString(sub.getPublicationType()));
+
+            if (printMessage) {
+                std::string valstr;
+                if (val.size() < 150) {
+                    if (iteration > 0) {
+                        valstr = fmt::format(
+                            "[{}:{}]value {}={}", currentTime, iteration, sub.getTarget(), val);
                     } else {
-                        if (iteration > 0) {
-                            valstr = fmt::format(
-                                "[{}:{}]value {}=block[{}]",
-                                currentTime,
-                                iteration,
-                                sub.getTarget(),
-                                val.size());
-                        } else {
-                            valstr = fmt::format(
-                                "[{}]value {}=block[{}]", currentTime, sub.getTarget(), val.size());
-                        }
+                        valstr = fmt::format("[{}]value {}={}", currentTime, sub.getTarget(), val);
                     }
-                    if (skiplog) {
-                        std::cout << valstr << '\n';
+                } else {
+                    if (iteration > 0) {
+                        valstr = fmt::format(
+                            "[{}:{}]value {}=block[{}]",
+                            currentTime,
+                            iteration,
+                            sub.getTarget(),
+                            val.size());
                     } else {
-                        logger->addMessage(std::move(valstr));
+                        valstr = fmt::format(
+                            "[{}]value {}=block[{}]", currentTime, sub.getTarget(), val.size());
                     }
                 }
-                if (valueCallback) {
-                    valueCallback(currentTime, sub.getTarget(), val);
+                if (skiplog) {
+                    std::cout << valstr << '\n';
+                } else {
+                    logger->addMessage(std::move(valstr));
                 }
             }
+            if (valueCallback) {
+                valueCallback(currentTime, sub.getTarget(), val);
+            }
         }
+        updatedSubscriptions.clear();
 
         for (auto& ept : endpoints) {
             while (ept.hasMessage()) {
@@ -397,6 +403,7 @@ namespace apps {
             subscriptions.push_back(helics::make_subscription(*fed, key));
             auto index = static_cast<int>(subscriptions.size()) - 1;
             subkeys[key] = index; // this is a potential replacement
+            subids[subscriptions.back().getHandle()] = index;
         }
     }
 
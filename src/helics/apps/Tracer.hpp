@@ -109,6 +109,8 @@ namespace apps {
 
         virtual void initialize() override;
         void generateInterfaces();
+        /** capture the values and messages received since the last capture
+        @details only the subscriptions reported as updated by the federate are visited*/
         void captureForCurrentTime(Time currentTime, int iteration = 0);
         void loadCaptureInterfaces();
 
@@ -125,6 +127,8 @@ namespace apps {
 
         std::vector<Input> subscriptions; //!< the actual subscription objects
         std::map<std::string, int> subkeys; //!< translate subscription names to an index
+        std::map<helics::interface_handle, int> subids; //!< map of the subscription ids
+        std::vector<int> updatedSubscriptions; //!< subscriptions updated since the last capture
 
         std::vector<Endpoint> endpoints; //!< the actual endpoint objects
         std::map<std::string, int> eptNames; //!< translate endpoint name to index
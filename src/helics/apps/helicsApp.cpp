@@ -201,6 +201,19 @@ namespace apps {
 
     void App::finalize() { fed->finalize(); }
 
+    void App::trackSubscriptionUpdates(
+        const std::map<interface_handle, int>& subscriptionIds,
+        std::vector<int>& updated)
+    {
+        updated.reserve(subscriptionIds.size());
+        fed->setInputNotificationCallback([&subscriptionIds, &updated](Input& inp, Time /*time*/) {
+            auto res = subscriptionIds.find(inp.getHandle());
+            if (res != subscriptionIds.end()) {
+                updated.push_back(res->second);
+            }
+        });
+    }
+
     /*run the App*/
     void App::run()
     {
@@ -8,6 +8,9 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "../application_api/CombinationFederate.hpp"
 
+#include <map>
+#include <vector>
+
 namespace CLI {
 class App;
 } // namespace CLI
@@ -107,6 +110,15 @@ external protection, that will result in undefined behavior
         void loadJsonFileConfiguration(const std::string& appName, const std::string& jsonString);
         /** load a text file*/
         virtual void loadTextFile(const std::string& textFile);
+        /** collect the subscriptions as the federate reports their updates
+        @details the index of each updated subscription is added to updated,  the caller clears it after
+        processing the updates
+        @param subscriptionIds the map from the handle of each subscription to its index
+        @param updated the vector to add the updated subscription indices to
+        */
+        void trackSubscriptionUpdates(
+            const std::map<interface_handle, int>& subscriptionIds,
+            std::vector<int>& updated);
 
       private:
         void loadConfigOptions(const Json::Value& element);
@@ -12,6 +12,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <algorithm>
 #include <complex>
 #include <cstring>
+#include <stdexcept>
 
 namespace helics {
 ActionMessage::ActionMessage(action_message_def::action_t startingAction):
@@ -31,29 +32,26 @@ ActionMessage::ActionMessage(
 ActionMessage::ActionMessage(ActionMessage&& act) noexcept:
     messageAction(act.messageAction), messageID(act.messageID), source_id(act.source_id),
     source_handle(act.source_handle), dest_id(act.dest_id), dest_handle(act.dest_handle),
-    counter(act.counter), flags(act.flags), actionTime(act.actionTime),
+    counter(act.counter), flags(act.flags), sequenceID(act.sequenceID), actionTime(act.actionTime),
     payload(std::move(act.payload)), name(payload), Te(act.Te), Tdemin(act.Tdemin), Tso(act.Tso),
-    stringData(std::move(act.stringData))
+    stringData(std::move(act.stringData)), sharedPayload(std::move(act.sharedPayload))
 {
 }
 
 ActionMessage::ActionMessage(const ActionMessage& act):
     messageAction(act.messageAction), messageID(act.messageID), source_id(act.source_id),
     source_handle(act.source_handle), dest_id(act.dest_id), dest_handle(act.dest_handle),
-    counter(act.counter), flags(act.flags), actionTime(act.actionTime), payload(act.payload),
-    name(payload), Te(act.Te), Tdemin(act.Tdemin), Tso(act.Tso), stringData(act.stringData)
-
+    counter(act.counter), flags(act.flags), sequenceID(act.sequenceID), actionTime(act.actionTime),
+    payload(act.payload), name(payload), Te(act.Te), Tdemin(act.Tdemin), Tso(act.Tso), stringData(act.stringData),
+    sharedPayload(act.sharedPayload)
 {
 }
 
 ActionMessage::ActionMessage(std::unique_ptr<Message> message):
     messageAction(CMD_SEND_MESSAGE), messageID(message->messageID), actionTime(message->time),
-    payload(std::move(message->data.m_data)), name(payload),
-    stringData({std::move(message->dest),
-                std::move(message->source),
-                std::move(message->original_source),
-                std::move(message->original_dest)})
+    payload(std::move(message->data.m_data)), name(payload)
 {
+    setMessageStrings(std::move(*message));
 }
 
 ActionMessage::ActionMessage(const std::string& bytes): ActionMessage()
@@ -83,12 +81,14 @@ ActionMessage& ActionMessage::operator=(const ActionMessage& act)
     dest_handle = act.dest_handle;
     counter = act.counter;
     flags = act.flags;
+    sequenceID = act.sequenceID;
     actionTime = act.actionTime;
     Te = act.Te;
     Tdemin = act.Tdemin;
     Tso = act.Tso;
     payload = act.payload;
     stringData = act.stringData;
+    sharedPayload = act.sharedPayload;
     return *this;
 }
 
@@ -102,12 +102,14 @@ ActionMessage& ActionMessage::operator=(ActionMessage&& act) noexcept
     dest_handle = act.dest_handle;
     counter = act.counter;
     flags = act.flags;
+    sequenceID = act.sequenceID;
     actionTime = act.actionTime;
     Te = act.Te;
     Tdemin = act.Tdemin;
     Tso = act.Tso;
     payload = std::move(act.payload);
     stringData = std::move(act.stringData);
+    sharedPayload = std::move(act.sharedPayload);
     return *this;
 }
 
@@ -116,11 +118,18 @@ void ActionMessage::moveInfo(std::unique_ptr<Message> message)
     messageAction = CMD_SEND_MESSAGE;
     messageID = message->messageID;
     payload = std::move(message->data.m_data);
+    sharedPayload.reset();
     actionTime = message->time;
-    stringData = {std::move(message->dest),
-                  std::move(message->source),
-                  std::move(message->original_source),
-                  std::move(message->original_dest)};
+    setMessageStrings(std::move(*message));
+}
+
+void ActionMessage::setMessageStrings(Message&& message)
+{
+    stringData.resize(4);
+    stringData[targetStringLoc] = std::move(message.dest);
+    stringData[sourceStringLoc] = std::move(message.source);
+    stringData[origSourceStringLoc] = std::move(message.original_source);
+    stringData[origDestStringLoc] = std::move(message.original_dest);
 }
 
 void ActionMessage::setAction(action_message_def::action_t newAction)
@@ -128,6 +137,16 @@ void ActionMessage::setAction(action_message_def::action_t newAction)
     messageAction = newAction;
 }
 
+shared_data_block ActionMessage::extractSharedPayload()
+{
+    if (!sharedPayload.isValid()) {
+        return shared_data_block(std::move(payload));
+    }
+    shared_data_block buffer;
+    std::swap(buffer, sharedPayload);
+    return buffer;
+}
+
 static const std::string emptyStr;
 const std::string& ActionMessage::getString(int index) const
 {
@@ -149,6 +168,33 @@ void ActionMessage::setString(int index, const std::string& str)
     }
 }
 
+void ActionMessage::compactMessageNames()
+{
+    if ((stringData.size() != 3) ||
+        (stringData[sourceStringLoc] != stringData[origSourceStringLoc])) {
+        return;
+    }
+    stringData[targetStringLoc].clear();
+    stringData.resize(2);
+}
+
+bool ActionMessage::hasCompactNames() const
+{
+    // a message built from the API always carries at least a destination, source and original source
+    return (messageAction == CMD_SEND_MESSAGE) && (stringData.size() == 2) &&
+        stringData[targetStringLoc].empty();
+}
+
+void ActionMessage::expandMessageNames(const std::string& destName)
+{
+    if (!hasCompactNames()) {
+        return;
+    }
+    stringData.resize(3);
+    stringData[targetStringLoc] = destName;
+    stringData[origSourceStringLoc] = stringData[sourceStringLoc];
+}
+
 /** check for little endian*/
 static inline std::uint8_t isLittleEndian()
 {
@@ -166,9 +212,13 @@ int ActionMessage::toByteArray(char* data, int buffer_size) const
     if (static_cast<int>(buffer_size) < serializedByteCount()) {
         return -1;
     }
+    if (payloadSize() > maxSerializedPayloadSize) {
+        throw(std::invalid_argument(
+            "payload is too large to serialize, it must be sent as a chunked transfer"));
+    }
     char* dataStart = data;
     // put the main string size in the first 4 bytes;
-    auto ssize = static_cast<uint32_t>(payload.size()) & 0x00FFFFFFu;
+    auto ssize = static_cast<uint32_t>(payloadSize());
     *data = littleEndian;
     data[1] = static_cast<uint8_t>(ssize >> 16U);
     data[2] = static_cast<uint8_t>((ssize >> 8U) & 0xFFU);
@@ -208,7 +258,7 @@ int ActionMessage::toByteArray(char* data, int buffer_size) const
         data += sizeof(Time::baseType);
     }
     if (ssize > 0) {
-        std::memcpy(data, payload.data(), ssize);
+        std::memcpy(data, payloadData(), ssize);
         data += ssize;
     }
 
@@ -238,7 +288,7 @@ static constexpr int action_message_base_size = static_cast<int>(
 int ActionMessage::serializedByteCount() const
 {
     int size{action_message_base_size};
-    size += static_cast<int>(payload.size());
+    size += static_cast<int>(payloadSize());
     // for time request add an additional 3*8 bytes
     if (messageAction == CMD_TIME_REQUEST) {
         size += static_cast<int>(3 * sizeof(Time::baseType));
@@ -275,16 +325,23 @@ std::string ActionMessage::packetize() const
 
 void ActionMessage::packetize(std::string& data) const
 {
+    data.clear();
+    appendPacketized(data);
+}
+
+void ActionMessage::appendPacketized(std::string& data) const
+{
+    auto start = data.size();
     auto sz = serializedByteCount();
-    data.resize(sizeof(uint32_t) + static_cast<size_t>(sz));
-    toByteArray(&(data[4]), sz);
+    data.resize(start + sizeof(uint32_t) + static_cast<size_t>(sz));
+    toByteArray(&(data[start + 4]), sz);
 
-    data[0] = LEADING_CHAR;
+    data[start] = LEADING_CHAR;
     // now generate a length header
-    auto dsz = static_cast<uint32_t>(data.size());
-    data[1] = static_cast<char>(((dsz >> 16U) & 0xFFU));
-    data[2] = static_cast<char>(((dsz >> 8U) & 0xFFU));
-    data[3] = static_cast<char>(dsz & 0xFFu);
+    auto dsz = static_cast<uint32_t>(data.size() - start);
+    data[start + 1] = static_cast<char>(((dsz >> 16U) & 0xFFU));
+    data[start + 2] = static_cast<char>(((dsz >> 8U) & 0xFFU));
+    data[start + 3] = static_cast<char>(dsz & 0xFFu);
     data.push_back(TAIL_CHAR1);
     data.push_back(TAIL_CHAR2);
 }
@@ -300,16 +357,32 @@ std::vector<char> ActionMessage::to_vector() const
 
 void ActionMessage::to_vector(std::vector<char>& data) const
 {
-    auto sz = serializedByteCount();
-    data.resize(sz);
-    toByteArray(data.data(), sz);
+    serializeInto(data);
 }
 
 void ActionMessage::to_string(std::string& data) const
+{
+    serializeInto(data);
+}
+
+int ActionMessage::serializeInto(std::string& buffer) const
 {
     auto sz = serializedByteCount();
-    data.resize(sz);
-    toByteArray(&(data[0]), sz);
+    buffer.resize(sz);
+    return toByteArray(&(buffer[0]), sz);
+}
+
+int ActionMessage::serializeInto(std::vector<char>& buffer) const
+{
+    auto sz = serializedByteCount();
+    buffer.resize(sz);
+    return toByteArray(buffer.data(), sz);
+}
+
+std::string& threadSerializationBuffer()
+{
+    static thread_local std::string buffer;
+    return buffer;
 }
 
 template<std::size_t DataSize>
@@ -399,9 +472,12 @@ int ActionMessage::fromByteArray(const char* data, int buffer_size)
         Tdemin = timeZero;
         Tso = timeZero;
     }
+    sharedPayload.reset();
     if (sz > 0) {
         payload.assign(data, sz);
         data += sz;
+    } else {
+        payload.clear();
     }
     int stringCount = *data;
     ++data;
@@ -520,7 +596,11 @@ std::unique_ptr<Message> createMessageFromCommand(const ActionMessage& cmd)
             msg->original_dest = cmd.stringData[3];
             break;
     }
-    msg->data = cmd.payload;
+    if (cmd.hasSharedPayload()) {
+        msg->data.assign(cmd.payloadData(), cmd.payloadSize());
+    } else {
+        msg->data = cmd.payload;
+    }
     msg->time = cmd.actionTime;
     msg->messageID = cmd.messageID;
 
@@ -552,7 +632,11 @@ std::unique_ptr<Message> createMessageFromCommand(ActionMessage&& cmd)
             msg->original_dest = std::move(cmd.stringData[3]);
             break;
     }
-    msg->data = std::move(cmd.payload);
+    if (cmd.hasSharedPayload()) {
+        msg->data.assign(cmd.payloadData(), cmd.payloadSize());
+    } else {
+        msg->data = std::move(cmd.payload);
+    }
     msg->time = cmd.actionTime;
     msg->messageID = cmd.messageID;
     return msg;
@@ -653,6 +737,10 @@ static constexpr std::pair<action_message_def::action_t, const char*> actionStri
     {action_message_def::action_t::cmd_remove_named_filter, "remove_named_filter"},
     {action_message_def::action_t::cmd_close_interface, "close_interface"},
     {action_message_def::action_t::cmd_multi_message, "multi message"},
+    {action_message_def::action_t::cmd_message_chunk, "message chunk"},
+    {action_message_def::action_t::cmd_shard_sync, "shard sync"},
+    {action_message_def::action_t::cmd_endpoint_resolved, "endpoint resolved"},
+    {action_message_def::action_t::cmd_request_full_value, "request full value"},
     // protocol messages are meant for the communication standard and are not used in the Cores/Brokers
     {action_message_def::action_t::cmd_protocol_priority, "protocol_priority"},
     {action_message_def::action_t::cmd_protocol, "protocol"},
@@ -740,7 +828,7 @@ std::string prettyPrintString(const ActionMessage& command)
                 "From ({}) handle({}) size {} at {} to {}",
                 command.source_id.baseValue(),
                 command.dest_handle.baseValue(),
-                command.payload.size(),
+                command.payloadSize(),
                 static_cast<double>(command.actionTime),
                 command.dest_id.baseValue()));
             break;
@@ -798,7 +886,9 @@ int appendMessage(ActionMessage& m, const ActionMessage& newMessage)
 {
     if (m.action() == CMD_MULTI_MESSAGE) {
         if (m.counter < 255) {
-            m.setString(m.counter++, newMessage.to_string());
+            auto& buffer = threadSerializationBuffer();
+            newMessage.serializeInto(buffer);
+            m.setString(m.counter++, buffer);
             return m.counter;
         }
     }
@@ -11,6 +11,7 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace helics {
 constexpr int targetStringLoc = 0;
@@ -22,6 +23,9 @@ constexpr int typeStringLoc = 0;
 constexpr int typeOutStringLoc = 1;
 
 constexpr int32_t cmd_info_basis = 65536;
+/** the largest payload that fits in the 24 bit size field of a serialized message,  larger payloads are sent
+as chunked transfers*/
+constexpr std::size_t maxSerializedPayloadSize{0x00FFFFFFU};
 
 /** class defining the primary message object used in HELICS */
 class ActionMessage {
@@ -36,16 +40,17 @@ class ActionMessage {
     interface_handle dest_handle{}; //!< 24 local handle for a targeted message
     uint16_t counter{0}; //!< 26 counter for filter tracking or message counter
     uint16_t flags{0}; //!<  28 set of messageFlags
-    uint32_t sequenceID{0}; //!< a sequence number for ordering
-    Time actionTime{timeZero}; //!< 40 the time an action took place or will take place	//32
+    uint32_t sequenceID{0}; //!< 32 a sequence number for ordering
+    Time actionTime{timeZero}; //!< 40 the time an action took place or will take place
     std::string
-        payload; //!< string containing the data	//96 std::string is 32 bytes on most platforms (except libc++)
-    std::string& name; //!< alias payload to a name reference for registration functions
-    Time Te{timeZero}; //!< 48 event time
-    Time Tdemin{timeZero}; //!< 56 min dependent event time
-    Time Tso{timeZero}; //!< 64 the second order dependent time
+        payload; //!< 72 string containing the data, std::string is 32 bytes on most platforms (24 on libc++)
+    std::string& name; //!< 80 alias payload to a name reference for registration functions
+    Time Te{timeZero}; //!< 88 event time
+    Time Tdemin{timeZero}; //!< 96 min dependent event time
+    Time Tso{timeZero}; //!< 104 the second order dependent time
   private:
-    std::vector<std::string> stringData; //!< container for extra string data
+    std::vector<std::string> stringData; //!< 128 container for extra string data
+    shared_data_block sharedPayload; //!< 144 payload shared with other messages in place of payload
   public:
     /** default constructor*/
     ActionMessage() noexcept: name(payload){};
@@ -141,6 +146,40 @@ class ActionMessage {
     const std::string& getString(int index) const;
 
     void setString(int index, const std::string& str);
+    /** drop the names of a message that is addressed to a resolved endpoint handle
+    @details the destination name is known wherever the handle is and the original source is the same as the
+    source, so only the source name travels with the message,  messages renamed by a filter are left alone*/
+    void compactMessageNames();
+    /** check if the names of a message were removed by compactMessageNames
+    @details the compaction is marked by the string layout so no user settable flag is needed*/
+    bool hasCompactNames() const;
+    /** restore the names removed by compactMessageNames
+    @param destName the name of the destination endpoint*/
+    void expandMessageNames(const std::string& destName);
+    /** set the payload to a shared buffer
+    @details the data is not copied until the message is serialized, any data in payload is cleared
+    */
+    void setSharedPayload(shared_data_block buffer)
+    {
+        payload.clear();
+        sharedPayload = std::move(buffer);
+    }
+    /** check if the message payload is stored in a shared buffer*/
+    bool hasSharedPayload() const noexcept { return sharedPayload.isValid(); }
+    /** get the size of the payload whether it is shared or not*/
+    size_t payloadSize() const
+    {
+        return (sharedPayload.isValid()) ? sharedPayload.size() : payload.size();
+    }
+    /** get a pointer to the payload data whether it is shared or not*/
+    const char* payloadData() const
+    {
+        return (sharedPayload.isValid()) ? sharedPayload.data() : payload.data();
+    }
+    /** extract the payload as a shared buffer
+    @details if the payload is not already shared the payload string is moved into a new shared buffer
+    */
+    shared_data_block extractSharedPayload();
     /** get the source global_handle*/
     global_handle getSource() const { return global_handle{source_id, source_handle}; }
     /** get the global destination handle*/
@@ -164,8 +203,16 @@ class ActionMessage {
     @param[out] data pointer to memory to store the command
     @param buffer_size  the size of the buffer
     @return the size of the buffer actually used
+    @throw std::invalid_argument if the payload is larger than maxSerializedPayloadSize
     */
     int toByteArray(char* data, int buffer_size) const;
+    /** serialize the message into a caller owned buffer
+    @details the buffer is resized to the serialized size, a buffer that is reused keeps its capacity so
+    serializing into the same buffer repeatedly does not allocate once it fits the largest message
+    @return the number of bytes written*/
+    int serializeInto(std::string& buffer) const;
+    /** serialize the message into a caller owned byte vector \ref serializeInto(std::string&)*/
+    int serializeInto(std::vector<char>& buffer) const;
     /** convert to a string using a reference*/
     void to_string(std::string& data) const;
     /** convert to a byte string*/
@@ -174,6 +221,8 @@ class ActionMessage {
      */
     std::string packetize() const;
     void packetize(std::string& data) const;
+    /** packetize the message and append it to the end of an existing packet stream*/
+    void appendPacketized(std::string& data) const;
     /** covert to a byte vector using a reference*/
     void to_vector(std::vector<char>& data) const;
     /** convert a command to a byte vector*/
@@ -191,6 +240,10 @@ class ActionMessage {
 
     friend std::unique_ptr<Message> createMessageFromCommand(const ActionMessage& cmd);
     friend std::unique_ptr<Message> createMessageFromCommand(ActionMessage&& cmd);
+
+  private:
+    /** move the routing strings of a message into the string data*/
+    void setMessageStrings(Message&& message);
 };
 
 inline bool operator<(const ActionMessage& cmd, const ActionMessage& cmd2)
@@ -305,6 +358,11 @@ std::ostream& operator<<(std::ostream& os, const ActionMessage& command);
 @return the integer location of the message in the stringData section*/
 int appendMessage(ActionMessage& m, const ActionMessage& newMessage);
 
+/** get a serialization buffer owned by the calling thread
+@details the buffer keeps its capacity between uses so serializing into it does not allocate in steady state,
+the contents are only valid until the next use of the buffer on the same thread*/
+std::string& threadSerializationBuffer();
+
 /** generate a string reprenting an error from an ActionMessage
 @param command the command to generate the error string for
 @return a string describing the error, if the string is not an error the string is empty
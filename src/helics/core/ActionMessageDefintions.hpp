@@ -157,6 +157,13 @@ across different compilers*/
 
         cmd_close_interface = 133, //!< cmd to close all communications from an interface
         cmd_multi_message = 1037, //!< cmd that encapsulates a bunch of messages in its payload
+        cmd_message_chunk = 1039, //!< cmd carrying a piece of a message too large to send at once
+        cmd_shard_sync =
+            1041, //!< marker from a core routing thread that its forwarded commands have been processed
+        cmd_endpoint_resolved =
+            1043, //!< notice of the global handle an endpoint name resolved to so messages can use the handle
+        cmd_request_full_value =
+            1045, //!< request from an input that lost the base of a delta for the next value to be sent in full
 
         cmd_connection_error = 2034, //!< cmd indicating a connection error with a broker/federate
 
@@ -303,6 +310,10 @@ across different compilers*/
 #define CMD_SET_GLOBAL action_message_def::action_t::cmd_set_global
 
 #define CMD_MULTI_MESSAGE action_message_def::action_t::cmd_multi_message
+#define CMD_MESSAGE_CHUNK action_message_def::action_t::cmd_message_chunk
+#define CMD_SHARD_SYNC action_message_def::action_t::cmd_shard_sync
+#define CMD_ENDPOINT_RESOLVED action_message_def::action_t::cmd_endpoint_resolved
+#define CMD_REQUEST_FULL_VALUE action_message_def::action_t::cmd_request_full_value
 
 // definitions for the protocol options
 #define PROTOCOL_PING 10
@@ -0,0 +1,260 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "ActionMessage.hpp"
+#include "gmlc/containers/BlockingPriorityQueue.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace helics {
+/** unbounded lock free queue with any number of producers and a single consumer with a priority channel
+@details each channel is an intrusive linked list, a push is a single atomic exchange so producers never wait
+on each other or on the consumer,  the consumer always drains the priority channel before the regular channel.
+When both channels are empty the consumer spins briefly then sleeps on a condition variable, producers only
+touch the mutex if the consumer has flagged that it is sleeping*/
+template<class X>
+class LockFreePriorityQueue {
+  private:
+    struct node {
+        std::atomic<node*> next{nullptr};
+        X value;
+        node() = default;
+        template<class... Args>
+        explicit node(Args&&... args): value(std::forward<Args>(args)...)
+        {
+        }
+    };
+    /** a single multi-producer single-consumer channel*/
+    class channel {
+      public:
+        channel(): head(&stub), tail(&stub) {}
+        ~channel()
+        {
+            while (tail != nullptr) {
+                auto* next = tail->next.load(std::memory_order_relaxed);
+                if (tail != &stub) {
+                    delete tail;
+                }
+                tail = next;
+            }
+        }
+        channel(const channel&) = delete;
+        channel& operator=(const channel&) = delete;
+        void push(node* item)
+        {
+            auto* prev = head.exchange(item, std::memory_order_acq_rel);
+            prev->next.store(item, std::memory_order_release);
+        }
+        /** pop a value, only safe from the consumer thread*/
+        bool pop(X& val)
+        {
+            auto* current = tail;
+            auto* next = current->next.load(std::memory_order_acquire);
+            if (next == nullptr) {
+                return false;
+            }
+            val = std::move(next->value);
+            tail = next;
+            if (current != &stub) {
+                delete current;
+            }
+            return true;
+        }
+        /** check if there is anything available to the consumer*/
+        bool empty() const { return tail->next.load(std::memory_order_acquire) == nullptr; }
+
+      private:
+        std::atomic<node*> head; //!< the last node pushed
+        // keep the producer and consumer ends on separate cache lines
+        char padding[64 - sizeof(std::atomic<node*>)];
+        node* tail; //!< the last node consumed
+        node stub; //!< placeholder node the list starts from
+    };
+
+  public:
+    LockFreePriorityQueue() = default;
+    /** push an element onto the queue*/
+    template<class Z>
+    void push(Z&& val)
+    {
+        regular.push(new node(std::forward<Z>(val)));
+        notifyConsumer();
+    }
+    /** push an element onto the priority channel*/
+    template<class Z>
+    void pushPriority(Z&& val)
+    {
+        priority.push(new node(std::forward<Z>(val)));
+        notifyConsumer();
+    }
+    /** construct an element in place on the queue*/
+    template<class... Args>
+    void emplace(Args&&... args)
+    {
+        regular.push(new node(std::forward<Args>(args)...));
+        notifyConsumer();
+    }
+    /** construct an element in place on the priority channel*/
+    template<class... Args>
+    void emplacePriority(Args&&... args)
+    {
+        priority.push(new node(std::forward<Args>(args)...));
+        notifyConsumer();
+    }
+    /** try to pop an element, only callable from the consumer thread*/
+    stx::optional<X> try_pop()
+    {
+        X val;
+        if (priority.pop(val) || regular.pop(val)) {
+            return val;
+        }
+        return stx::nullopt;
+    }
+    /** blocking pop of an element, only callable from the consumer thread*/
+    X pop()
+    {
+        X val;
+        while (true) {
+            for (int ii = 0; ii < spinCount; ++ii) {
+                if (priority.pop(val) || regular.pop(val)) {
+                    return val;
+                }
+                if (ii >= spinCount / 2) {
+                    std::this_thread::yield();
+                }
+            }
+            consumerSleeping.store(true, std::memory_order_relaxed);
+            // pairs with the fence in notifyConsumer so a push is either seen here or the producer sees the
+            // sleeping flag
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (priority.pop(val) || regular.pop(val)) {
+                consumerSleeping.store(false, std::memory_order_relaxed);
+                return val;
+            }
+            std::unique_lock<std::mutex> lock(sleepLock);
+            wakeCondition.wait(
+                lock, [this] { return !consumerSleeping.load(std::memory_order_relaxed); });
+        }
+    }
+    /** check if the queue is empty, only meaningful from the consumer thread*/
+    bool empty() const { return priority.empty() && regular.empty(); }
+
+  private:
+    void notifyConsumer()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (consumerSleeping.load(std::memory_order_relaxed)) {
+            std::lock_guard<std::mutex> lock(sleepLock);
+            consumerSleeping.store(false, std::memory_order_relaxed);
+            wakeCondition.notify_one();
+        }
+    }
+    static constexpr int spinCount{64}; //!< number of empty checks before the consumer sleeps
+    channel priority; //!< channel for priority elements
+    channel regular; //!< channel for all other elements
+    std::atomic<bool> consumerSleeping{false}; //!< the consumer is sleeping or about to
+    std::mutex sleepLock; //!< lock used only to put the consumer to sleep
+    std::condition_variable wakeCondition; //!< condition the consumer sleeps on
+};
+
+/** the queue of actions for a broker or core
+@details wraps either the default blocking priority queue or a lock free multi producer single consumer queue
+with the same priority semantics,  the type of queue can only be changed before the processing loop starts*/
+class ActionQueue {
+  public:
+    ActionQueue() = default;
+    /** select the lock free queue implementation
+    @details must not be called while any other thread is using the queue,  any queued actions are
+    transferred to the newly selected queue*/
+    void setLockFree(bool useLockFree)
+    {
+        if (useLockFree == lockFree) {
+            return;
+        }
+        if (useLockFree) {
+            auto val = blockingQueue.try_pop();
+            while (val) {
+                // the blocking queue pops priority actions first so they stay ahead in the new queue
+                if (isPriorityCommand(*val)) {
+                    lockFreeQueue.pushPriority(std::move(*val));
+                } else {
+                    lockFreeQueue.push(std::move(*val));
+                }
+                val = blockingQueue.try_pop();
+            }
+        } else {
+            auto val = lockFreeQueue.try_pop();
+            while (val) {
+                if (isPriorityCommand(*val)) {
+                    blockingQueue.pushPriority(std::move(*val));
+                } else {
+                    blockingQueue.push(std::move(*val));
+                }
+                val = lockFreeQueue.try_pop();
+            }
+        }
+        lockFree = useLockFree;
+    }
+    /** check if the lock free queue is in use*/
+    bool isLockFree() const noexcept { return lockFree; }
+
+    template<class Z>
+    void push(Z&& val)
+    {
+        if (lockFree) {
+            lockFreeQueue.push(std::forward<Z>(val));
+        } else {
+            blockingQueue.push(std::forward<Z>(val));
+        }
+    }
+    template<class Z>
+    void pushPriority(Z&& val)
+    {
+        if (lockFree) {
+            lockFreeQueue.pushPriority(std::forward<Z>(val));
+        } else {
+            blockingQueue.pushPriority(std::forward<Z>(val));
+        }
+    }
+    template<class... Args>
+    void emplace(Args&&... args)
+    {
+        if (lockFree) {
+            lockFreeQueue.emplace(std::forward<Args>(args)...);
+        } else {
+            blockingQueue.emplace(std::forward<Args>(args)...);
+        }
+    }
+    template<class... Args>
+    void emplacePriority(Args&&... args)
+    {
+        if (lockFree) {
+            lockFreeQueue.emplacePriority(std::forward<Args>(args)...);
+        } else {
+            blockingQueue.emplacePriority(std::forward<Args>(args)...);
+        }
+    }
+    /** blocking pop, only callable from the processing thread*/
+    ActionMessage pop() { return (lockFree) ? lockFreeQueue.pop() : blockingQueue.pop(); }
+    /** non blocking pop, only callable from the processing thread*/
+    stx::optional<ActionMessage> try_pop()
+    {
+        return (lockFree) ? lockFreeQueue.try_pop() : blockingQueue.try_pop();
+    }
+
+  private:
+    gmlc::containers::BlockingPriorityQueue<ActionMessage> blockingQueue;
+    LockFreePriorityQueue<ActionMessage> lockFreeQueue;
+    bool lockFree{false}; //!< indicator that the lock free queue is in use
+};
+
+} // namespace helics
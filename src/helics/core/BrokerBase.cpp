@@ -137,6 +137,11 @@ std::shared_ptr<helicsCLI11App> BrokerBase::generateBaseCLI()
         "--conservative_time_policy,--restrictive_time_policy",
         restrictive_time_policy,
         "specify that a broker should use a conservative time policy in the time coordinator");
+    hApp->add_flag(
+        "--lock_free_queue,--lockfree_queue",
+        useLockFreeQueue,
+        "use a lock free queue for the actions sent to the broker/core, reduces contention when many "
+        "threads send actions to the same broker or core");
     auto logging_group =
         hApp->add_option_group("logging", "Options related to file and message logging");
     logging_group->option_defaults()->ignore_underscore();
@@ -244,6 +249,7 @@ void BrokerBase::configureBase()
         loggingObj->openFile(logFile);
     }
     loggingObj->startLogging(maxLogLevel, maxLogLevel);
+    actionQueue.setLockFree(useLockFreeQueue);
     mainLoopIsRunning.store(true);
     queueProcessingThread = std::thread(&BrokerBase::queueProcessingLoop, this);
     brokerState = broker_state_t::configured;
@@ -587,6 +593,11 @@ action_message_def::action_t BrokerBase::commandProcessor(ActionMessage& command
                 }
             }
             break;
+        case CMD_MESSAGE_CHUNK:
+            if (chunkAssembler.addChunk(command)) {
+                return commandProcessor(command);
+            }
+            break;
         default:
             if (!haltOperations) {
                 if (isPriorityCommand(command)) {
@@ -12,8 +12,9 @@ and some common methods used cores and brokers
 */
 
 #include "ActionMessage.hpp"
+#include "ActionQueue.hpp"
+#include "ChunkedTransfer.hpp"
 #include "federate_id_extra.hpp"
-#include "gmlc/containers/BlockingPriorityQueue.hpp"
 
 #include <atomic>
 #include <memory>
@@ -69,12 +70,14 @@ class BrokerBase {
         false}; //!< flag indicating that the message queue should not be used and all functions
     //!< called directly instead of distinct thread
     bool disable_timer{false}; //!< turn off the timer/timeout subsystem completely
+    bool useLockFreeQueue{false}; //!< use the lock free implementation of the action queue
     std::atomic<std::size_t> messageCounter{
         0}; //!< counter for the total number of message processed
+    MessageAssembler chunkAssembler; //!< reassembles messages that arrived as a chunked transfer
   protected:
     std::string logFile; //!< the file to log message to
     std::unique_ptr<ForwardingTimeCoordinator> timeCoord; //!< object managing the time control
-    gmlc::containers::BlockingPriorityQueue<ActionMessage> actionQueue; //!< primary routing queue
+    ActionQueue actionQueue; //!< primary routing queue
     /** enumeration of the possible core states*/
     enum class broker_state_t : int16_t {
         created = -6, //!< the broker has been created
@@ -32,6 +32,10 @@ SPDX-License-Identifier: BSD-3-Clause
 #    include "ipc/IpcBroker.h"
 #endif
 
+#ifdef ENABLE_SHM_CORE
+#    include "shm/ShmBroker.h"
+#endif
+
 #ifdef ENABLE_UDP_CORE
 #    include "udp/UdpBroker.h"
 #endif
@@ -136,6 +140,17 @@ std::shared_ptr<Broker> makeBroker(core_type type, const std::string& name)
             break;
 #else
             throw(HelicsException("ipc broker type is not available"));
+#endif
+        case core_type::SHM:
+#ifdef ENABLE_SHM_CORE
+            if (name.empty()) {
+                broker = std::make_shared<shm::ShmBroker>();
+            } else {
+                broker = std::make_shared<shm::ShmBroker>(name);
+            }
+            break;
+#else
+            throw(HelicsException("shared memory broker type is not available"));
 #endif
         case core_type::UDP:
 #ifdef ENABLE_UDP_CORE
@@ -298,6 +313,12 @@ need be without issue*/
                     return (dynamic_cast<ipc::IpcBroker*>(ptr.get()) != nullptr);
 #else
                     return false;
+#endif
+                case core_type::SHM:
+#ifdef ENABLE_SHM_CORE
+                    return (dynamic_cast<shm::ShmBroker*>(ptr.get()) != nullptr);
+#else
+                    return false;
 #endif
                 case core_type::UDP:
 #ifdef ENABLE_UDP_CORE
@@ -0,0 +1,75 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "ChunkedTransfer.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+
+namespace helics {
+MessageChunker::MessageChunker(ActionMessage&& message, int32_t transferId, std::size_t chunkSize):
+    header(std::move(message)), data(header.extractSharedPayload()),
+    chunkSize((std::max)(chunkSize, std::size_t{1})), transferId(transferId)
+{
+}
+
+ActionMessage MessageChunker::nextChunk()
+{
+    ActionMessage chunk(CMD_MESSAGE_CHUNK);
+    chunk.source_id = header.source_id;
+    chunk.dest_id = header.dest_id;
+    chunk.messageID = transferId;
+    chunk.sequenceID = sequence++;
+    if (!headerSent) {
+        header.serializeInto(chunk.payload);
+        chunk.setStringData(std::to_string(data.size()));
+        headerSent = true;
+        return chunk;
+    }
+    auto sliceSize = (std::min)(chunkSize, data.size() - offset);
+    chunk.payload.assign(data.data() + offset, sliceSize);
+    offset += sliceSize;
+    return chunk;
+}
+
+bool MessageAssembler::addChunk(ActionMessage& chunk)
+{
+    auto key = std::make_pair(chunk.source_id, chunk.messageID);
+    if (chunk.sequenceID == 0) {
+        auto& partial = transfers[key];
+        partial.message.from_string(chunk.payload);
+        partial.totalSize = std::strtoull(chunk.getString(0).c_str(), nullptr, 10);
+        partial.nextSequence = 1;
+        if (partial.message.action() == CMD_INVALID) {
+            transfers.erase(key);
+            return false;
+        }
+        partial.message.payload.reserve(partial.totalSize);
+        return false;
+    }
+    auto fnd = transfers.find(key);
+    if (fnd == transfers.end()) {
+        return false;
+    }
+    auto& partial = fnd->second;
+    if (chunk.sequenceID != partial.nextSequence) {
+        // a chunk went missing so the message can't be reconstructed
+        transfers.erase(fnd);
+        return false;
+    }
+    ++partial.nextSequence;
+    partial.message.payload.append(chunk.payload);
+    if (partial.message.payload.size() < partial.totalSize) {
+        return false;
+    }
+    chunk = std::move(partial.message);
+    transfers.erase(fnd);
+    return true;
+}
+
+} // namespace helics
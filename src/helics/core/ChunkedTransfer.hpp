@@ -0,0 +1,74 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "ActionMessage.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <utility>
+
+namespace helics {
+/** default size of the payload slices of a chunked transfer*/
+constexpr std::size_t defaultChunkSize{1U << 20U};
+
+/** class splitting a message with a large payload into a sequence of CMD_MESSAGE_CHUNK commands
+@details the first chunk carries the message with its payload removed and the total payload size, each
+following chunk carries the next slice of the payload, the payload is held in a shared buffer so it is not
+copied until each slice is serialized
+*/
+class MessageChunker {
+  public:
+    /** construct a chunker for a message
+    @param message the message to split
+    @param transferId an identifier for the transfer unique for the source of the message
+    @param chunkSize the maximum payload size of each chunk
+    */
+    MessageChunker(ActionMessage&& message, int32_t transferId, std::size_t chunkSize);
+    /** generate the next chunk of the transfer*/
+    ActionMessage nextChunk();
+    /** check if all the chunks have been generated*/
+    bool done() const noexcept { return headerSent && offset >= data.size(); }
+    /** get the source of the message being transferred*/
+    global_federate_id getSource() const noexcept { return header.source_id; }
+
+  private:
+    ActionMessage header; //!< the message without its payload
+    shared_data_block data; //!< the payload of the message
+    std::size_t offset{0}; //!< the amount of the payload already sent
+    std::size_t chunkSize; //!< the maximum payload slice of a chunk
+    int32_t transferId; //!< the identifier of the transfer
+    uint32_t sequence{0}; //!< the sequence number of the next chunk
+    bool headerSent{false}; //!< indicator that the first chunk has been generated
+};
+
+/** class reassembling messages from the CMD_MESSAGE_CHUNK commands generated by a MessageChunker
+@details chunks of a transfer are expected in sequence, a transfer with a missing chunk is discarded
+*/
+class MessageAssembler {
+  public:
+    /** add a chunk to a transfer
+    @param chunk the chunk command, if it completes a transfer it is replaced by the reassembled message
+    @return true if the chunk completed a message
+    */
+    bool addChunk(ActionMessage& chunk);
+    /** get the number of transfers in progress*/
+    std::size_t pendingTransfers() const noexcept { return transfers.size(); }
+
+  private:
+    /** the state of a transfer being reassembled*/
+    struct partialMessage {
+        ActionMessage message; //!< the message with the payload received so far
+        std::size_t totalSize{0}; //!< the size of the complete payload
+        uint32_t nextSequence{1}; //!< the sequence number of the expected chunk
+    };
+    std::map<std::pair<global_federate_id, int32_t>, partialMessage>
+        transfers; //!< transfers in progress indexed by source and transfer id
+};
+
+} // namespace helics
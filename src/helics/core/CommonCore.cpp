@@ -18,6 +18,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "FilterCoordinator.hpp"
 #include "FilterInfo.hpp"
 #include "ForwardingTimeCoordinator.hpp"
+#include "InputAggregation.hpp"
 #include "NamedInputInfo.hpp"
 #include "PublicationInfo.hpp"
 #include "TimeoutMonitor.h"
@@ -25,6 +26,8 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "coreTypeOperations.hpp"
 #include "fileConnections.hpp"
 #include "gmlc/concurrency/DelayedObjects.hpp"
+#include "gmlc/containers/BlockingQueue.hpp"
+#include "helicsCLI11.hpp"
 #include "helics_definitions.hpp"
 #include "loggingHelper.hpp"
 #include "queryHelpers.hpp"
@@ -34,9 +37,24 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <cstring>
 #include <fstream>
 #include <functional>
+#include <thread>
 
 namespace helics {
 // timeoutMon is a unique_ptr
+/** a routing thread with its own queue handling the value and timing traffic of a subset of the local federates
+@details anything the thread cannot route itself is forwarded to the main processing loop followed by a
+CMD_SHARD_SYNC marker, until the marker comes back everything else from the shard follows the same path so the
+commands from a federate are never reordered*/
+class CommonCore::RoutingShard {
+  public:
+    explicit RoutingShard(int shardIndex): index(shardIndex) {}
+    gmlc::containers::BlockingQueue<ActionMessage> queue; //!< the commands to route
+    std::thread worker; //!< the routing thread
+    const int index; //!< the index of the shard
+    int32_t forwarded{0}; //!< the last marker sent to the main loop, only used by the routing thread
+    std::atomic<int32_t> synced{0}; //!< the last marker processed by the main loop
+};
+
 CommonCore::CommonCore() noexcept: timeoutMon(new TimeoutMonitor) {}
 
 CommonCore::CommonCore(bool /*arg*/) noexcept: timeoutMon(new TimeoutMonitor) {}
@@ -173,6 +191,7 @@ void CommonCore::processDisconnect(bool skipUnregister)
         }
         brokerDisconnect();
     }
+    stopRoutingShards();
     brokerState = broker_state_t::terminated;
     if (!skipUnregister) {
         unregister();
@@ -237,9 +256,156 @@ void CommonCore::unregister()
 }
 CommonCore::~CommonCore()
 {
+    stopRoutingShards();
     joinAllThreads();
 }
 
+std::shared_ptr<helicsCLI11App> CommonCore::generateCLI()
+{
+    auto app = BrokerBase::generateCLI();
+    app->add_option(
+        "--routing_threads",
+        routingThreads,
+        "the number of threads used to route the value and timing traffic of the local federates once the "
+        "core is executing, the default (0) routes everything through the main processing loop");
+    return app;
+}
+
+void CommonCore::addActionMessage(const ActionMessage& m)
+{
+    if (shardsActive.load(std::memory_order_acquire) && !isPriorityCommand(m)) {
+        // the check is repeated once registered as a producer so stopRoutingShards can wait for the push
+        ++shardProducers;
+        if (shardsActive.load()) {
+            auto fnd = shardFederates.find(m.source_id);
+            if (fnd != shardFederates.end()) {
+                routingShards[fnd->second.second]->queue.push(m);
+                --shardProducers;
+                return;
+            }
+        }
+        --shardProducers;
+    }
+    BrokerBase::addActionMessage(m);
+}
+
+void CommonCore::addActionMessage(ActionMessage&& m)
+{
+    if (shardsActive.load(std::memory_order_acquire) && !isPriorityCommand(m)) {
+        ++shardProducers;
+        if (shardsActive.load()) {
+            auto fnd = shardFederates.find(m.source_id);
+            if (fnd != shardFederates.end()) {
+                routingShards[fnd->second.second]->queue.push(std::move(m));
+                --shardProducers;
+                return;
+            }
+        }
+        --shardProducers;
+    }
+    BrokerBase::addActionMessage(std::move(m));
+}
+
+void CommonCore::startRoutingShards()
+{
+    if (routingThreads <= 0 || !routingShards.empty()) {
+        return;
+    }
+    // filtered messages and the timing blocks they generate need the bookkeeping in the main loop
+    if (filters.size() > 0 || !filterCoord.empty()) {
+        return;
+    }
+    auto shardCount = (std::min)(routingThreads, static_cast<int>(loopFederates.size()));
+    if (shardCount <= 0) {
+        return;
+    }
+    // the set of local federates is fixed once the core is operating so this never changes while the shards run
+    int index{0};
+    for (auto& fed : loopFederates) {
+        shardFederates.emplace(fed->global_id.load(), std::make_pair(fed.fed, index % shardCount));
+        ++index;
+    }
+    shardRoutes = routing_table;
+    for (int ii = 0; ii < shardCount; ++ii) {
+        routingShards.push_back(std::make_unique<RoutingShard>(ii));
+    }
+    for (auto& shard : routingShards) {
+        auto* shardPtr = shard.get();
+        shard->worker = std::thread([this, shardPtr]() { shardProcessingLoop(*shardPtr); });
+    }
+    shardsActive.store(true, std::memory_order_release);
+}
+
+void CommonCore::stopRoutingShards()
+{
+    shardsActive.store(false);
+    // a producer that saw the shards active finishes its push before the terminate command is queued
+    while (shardProducers.load() > 0) {
+        std::this_thread::yield();
+    }
+    for (auto& shard : routingShards) {
+        if (shard->worker.joinable()) {
+            shard->queue.push(CMD_TERMINATE_IMMEDIATELY);
+            shard->worker.join();
+        }
+    }
+}
+
+void CommonCore::shardProcessingLoop(RoutingShard& shard)
+{
+    while (true) {
+        auto cmd = shard.queue.pop();
+        if (cmd.action() == CMD_TERMINATE_IMMEDIATELY) {
+            break;
+        }
+        if (shard.synced.load(std::memory_order_acquire) == shard.forwarded) {
+            if (routeShardCommand(cmd)) {
+                continue;
+            }
+        }
+        BrokerBase::addActionMessage(std::move(cmd));
+        ActionMessage sync(CMD_SHARD_SYNC);
+        sync.counter = static_cast<uint16_t>(shard.index);
+        sync.messageID = ++shard.forwarded;
+        BrokerBase::addActionMessage(sync);
+    }
+}
+
+bool CommonCore::routeShardCommand(ActionMessage& cmd)
+{
+    switch (cmd.action()) {
+        case CMD_PUB:
+        case CMD_TIME_REQUEST:
+        case CMD_TIME_GRANT:
+        case CMD_EXEC_REQUEST:
+        case CMD_EXEC_GRANT:
+            break;
+        default:
+            return false;
+    }
+    if ((cmd.dest_id == parent_broker_id) || (cmd.dest_id == higher_broker_id)) {
+        transmit(parent_route_id, std::move(cmd));
+        return true;
+    }
+    auto fnd = shardFederates.find(cmd.dest_id);
+    if (fnd != shardFederates.end()) {
+        auto* fed = fnd->second.first;
+        auto state = fed->getState();
+        if ((state == federate_state::HELICS_FINISHED) || (state == federate_state::HELICS_ERROR)) {
+            return false;
+        }
+        fed->addAction(std::move(cmd));
+        return true;
+    }
+    auto route = shardRoutes.find(cmd.dest_id, route_id{});
+    if (route.isValid()) {
+        transmit(route, std::move(cmd));
+        return true;
+    }
+    // the core itself and unknown destinations are handled in the main loop
+    return false;
+}
+
 FederateState* CommonCore::getFederateAt(local_federate_id federateID) const
 {
     /*
@@ -326,8 +492,7 @@ bool CommonCore::isLocal(global_federate_id global_fedid) const
 
 route_id CommonCore::getRoute(global_federate_id global_fedid) const
 {
-    auto fnd = routing_table.find(global_fedid);
-    return (fnd != routing_table.end()) ? fnd->second : parent_route_id;
+    return routing_table.find(global_fedid, parent_route_id);
 }
 
 bool CommonCore::isConfigured() const
@@ -831,7 +996,7 @@ interface_handle CommonCore::registerInput(
     m.name = key;
     m.setStringData(type, units);
 
-    actionQueue.push(std::move(m));
+    addActionMessage(std::move(m));
     return id;
 }
 
@@ -879,7 +1044,7 @@ interface_handle CommonCore::registerPublication(
     m.flags = handle.flags;
     m.setStringData(type, units);
 
-    actionQueue.push(std::move(m));
+    addActionMessage(std::move(m));
     return id;
 }
 
@@ -952,8 +1117,9 @@ const std::string& CommonCore::getInjectionType(interface_handle handle) const
                 auto fed = getFederateAt(handleInfo->local_fed_id);
                 auto inpInfo = fed->interfaces().getInput(handle);
                 if (inpInfo != nullptr) {
-                    if (!inpInfo->inputType.empty()) {
-                        return inpInfo->inputType;
+                    const auto& itype = inpInfo->getInjectionType();
+                    if (!itype.empty()) {
+                        return itype;
                     }
                 }
                 break;
@@ -988,13 +1154,30 @@ const std::string& CommonCore::getExtractionType(interface_handle handle) const
 }
 
 void CommonCore::setHandleOption(interface_handle handle, int32_t option, bool option_value)
+{
+    setHandleOptionValue(handle, option, option_value ? 1 : 0);
+}
+
+bool CommonCore::getHandleOption(interface_handle handle, int32_t option) const
+{
+    return (getHandleOptionValue(handle, option) != 0);
+}
+
+void CommonCore::setHandleOptionValue(
+    interface_handle handle,
+    int32_t option,
+    int32_t option_value)
 {
     auto handleInfo = getHandleInfo(handle);
     if (handleInfo == nullptr) {
         return;
     }
+    if ((option == defs::options::multi_input_handling_method) &&
+        (!isValidMultiInputMethod(option_value))) {
+        throw(InvalidParameter("unsupported multi input handling method"));
+    }
     handles.modify([handle, option, option_value](auto& hand) {
-        return hand.setHandleOption(handle, option, option_value);
+        return hand.setHandleOption(handle, option, option_value != 0);
     });
 
     ActionMessage fcn(CMD_INTERFACE_CONFIGURE);
@@ -1002,9 +1185,11 @@ void CommonCore::setHandleOption(interface_handle handle, int32_t option, bool o
     fcn.messageID = option;
     fcn.counter = static_cast<uint16_t>(handleInfo->handleType);
 
-    if (option_value) {
+    if (option_value != 0) {
         setActionFlag(fcn, indicator_flag);
     }
+    // the full value is carried for options that are not just on or off
+    fcn.sequenceID = static_cast<uint32_t>(option_value);
     if (handleInfo->handleType != handle_type::filter) {
         auto fed = getHandleFederate(handle);
         if (fed != nullptr) {
@@ -1016,7 +1201,7 @@ void CommonCore::setHandleOption(interface_handle handle, int32_t option, bool o
     }
 }
 
-bool CommonCore::getHandleOption(interface_handle handle, int32_t option) const
+int32_t CommonCore::getHandleOptionValue(interface_handle handle, int32_t option) const
 {
     auto handleInfo = getHandleInfo(handle);
     if (handleInfo == nullptr) {
@@ -1167,6 +1352,9 @@ void CommonCore::addSourceTarget(interface_handle handle, const std::string& tar
     addActionMessage(std::move(cmd));
 }
 
+/** publication values up to this size are copied into each subscriber message instead of being shared*/
+static constexpr uint64_t maxInlinePublicationSize{64};
+
 void CommonCore::setValue(interface_handle handle, const char* data, uint64_t len)
 {
     auto handleInfo = getHandleInfo(handle);
@@ -1193,43 +1381,44 @@ void CommonCore::setValue(interface_handle handle, const char* data, uint64_t le
         if (subs.empty()) {
             return;
         }
-        if (subs.size() == 1) {
-            ActionMessage mv(CMD_PUB);
-            mv.source_id = handleInfo->getFederateId();
-            mv.source_handle = handle;
-            mv.setDestination(subs[0]);
-            mv.counter = static_cast<uint16_t>(fed->getCurrentIteration());
-            mv.payload = std::string(data, len);
-            mv.actionTime = fed->nextAllowedSendTime();
-
-            actionQueue.push(std::move(mv));
-            return;
-        } else {
-            ActionMessage package(CMD_MULTI_MESSAGE);
-            package.source_id = handleInfo->getFederateId();
-            package.source_handle = handle;
-
-            ActionMessage mv(CMD_PUB);
-            mv.source_id = handleInfo->getFederateId();
-            mv.source_handle = handle;
-            mv.counter = static_cast<uint16_t>(fed->getCurrentIteration());
-            mv.payload = std::string(data, len);
-            mv.actionTime = fed->nextAllowedSendTime();
-
-            for (auto& target : subs) {
-                mv.setDestination(target);
-                auto res = appendMessage(package, mv);
-                if (res < 0) // deal with max package size if there are a lot of subscribers
-                {
-                    actionQueue.push(std::move(package));
-                    package = ActionMessage(CMD_MULTI_MESSAGE);
-                    package.source_id = handleInfo->getFederateId();
-                    package.source_handle = handle;
-                    appendMessage(package, mv);
-                }
+        ActionMessage mv(CMD_PUB);
+        std::string delta;
+        bool useDelta = fed->generateValueDelta(handle, data, len, delta);
+        if (useDelta) {
+            setActionFlag(mv, delta_value_flag);
+        }
+        mv.source_id = handleInfo->getFederateId();
+        mv.source_handle = handle;
+        mv.counter = static_cast<uint16_t>(fed->getCurrentIteration());
+        mv.actionTime = fed->nextAllowedSendTime();
+        auto payloadSize = (useDelta) ? delta.size() : len;
+        if (subs.size() == 1 || payloadSize <= maxInlinePublicationSize) {
+            // a single subscriber or a small value is cheaper to copy than to share
+            if (useDelta) {
+                mv.payload = std::move(delta);
+            } else {
+                mv.payload.assign(data, len);
             }
-            actionQueue.push(std::move(package));
+            for (size_t ii = 0; ii + 1 < subs.size(); ++ii) {
+                mv.setDestination(subs[ii]);
+                addActionMessage(mv);
+            }
+            mv.setDestination(subs.back());
+            addActionMessage(std::move(mv));
+            return;
+        }
+        // the data is copied once into a shared buffer and each subscriber message references that buffer
+        // so a local fan-out does not copy the payload, it only gets serialized if it goes out over comms
+        shared_data_block buffer =
+            (useDelta) ? shared_data_block(std::move(delta)) : shared_data_block(data, len);
+        for (size_t ii = 0; ii + 1 < subs.size(); ++ii) {
+            mv.setDestination(subs[ii]);
+            mv.setSharedPayload(buffer);
+            addActionMessage(mv);
         }
+        mv.setDestination(subs.back());
+        mv.setSharedPayload(std::move(buffer));
+        addActionMessage(std::move(mv));
     }
 }
 
@@ -1300,7 +1489,7 @@ interface_handle CommonCore::registerEndpoint(
     m.name = name;
     m.setStringData(type);
     m.flags = handle.flags;
-    actionQueue.push(std::move(m));
+    addActionMessage(std::move(m));
 
     return id;
 }
@@ -1348,7 +1537,7 @@ interface_handle CommonCore::registerFilter(
     if ((!type_in.empty()) || (!type_out.empty())) {
         m.setStringData(type_in, type_out);
     }
-    actionQueue.push(std::move(m));
+    addActionMessage(std::move(m));
     return id;
 }
 
@@ -1393,7 +1582,7 @@ interface_handle CommonCore::registerCloningFilter(
     if ((!type_in.empty()) || (!type_out.empty())) {
         m.setStringData(type_in, type_out);
     }
-    actionQueue.push(std::move(m));
+    addActionMessage(std::move(m));
     return id;
 }
 
@@ -1587,17 +1776,34 @@ void CommonCore::deliverMessage(ActionMessage& message)
     switch (message.action()) {
         case CMD_SEND_MESSAGE: {
             // Find the destination endpoint
-            auto localP = (message.dest_id == parent_broker_id) ?
-                loopHandles.getEndpoint(message.getString(targetStringLoc)) :
-                loopHandles.findHandle(message.getDest());
-            if (localP == nullptr) {
-                auto kfnd = knownExternalEndpoints.find(message.getString(targetStringLoc));
-                if (kfnd != knownExternalEndpoints.end()) { // destination is known
-                    transmit(kfnd->second, message);
+            BasicHandleInfo* localP{nullptr};
+            if (message.dest_id == parent_broker_id) {
+                auto& destName = message.getString(targetStringLoc);
+                auto resolved = resolvedEndpoints.find(destName);
+                if (resolved != resolvedEndpoints.end()) {
+                    message.setDestination(resolved->second);
                 } else {
-                    transmit(parent_route_id, message);
+                    localP = loopHandles.getEndpoint(destName);
+                    if (localP == nullptr) {
+                        // the broker resolves the name and sends back a CMD_ENDPOINT_RESOLVED
+                        transmit(parent_route_id, message);
+                        return;
+                    }
+                    resolvedEndpoints.emplace(destName, localP->handle);
                 }
-                return;
+            }
+            if (localP == nullptr) {
+                localP = loopHandles.findHandle(message.getDest());
+                if (localP == nullptr) {
+                    // the receiving core knows the destination name so it does not need to travel
+                    message.compactMessageNames();
+                    transmit(getRoute(message.dest_id), message);
+                    return;
+                }
+            }
+            if (message.hasCompactNames() && checkActionFlag(*localP, has_dest_filter_flag)) {
+                // filters operate on the full message
+                message.expandMessageNames(localP->key);
             }
             // now we deal with local processing
             if (checkActionFlag(*localP, has_dest_filter_flag)) {
@@ -1772,7 +1978,7 @@ void CommonCore::logMessage(
     m.dest_id = gid;
     m.messageID = logLevel;
     m.payload = messageToLog;
-    actionQueue.push(m);
+    addActionMessage(m);
 }
 
 void CommonCore::setLoggingLevel(int logLevel)
@@ -1806,7 +2012,7 @@ void CommonCore::setLoggingCallback(
             setActionFlag(loggerUpdate, empty_flag);
         }
 
-        actionQueue.push(loggerUpdate);
+        addActionMessage(loggerUpdate);
     } else {
         auto fed = getFederateAt(federateID);
         if (fed == nullptr) {
@@ -1857,7 +2063,7 @@ void CommonCore::setFilterOperator(
     dataAirlocks[ii].load(std::move(callback));
     filtOpUpdate.counter = ii;
     filtOpUpdate.source_handle = filter;
-    actionQueue.push(filtOpUpdate);
+    addActionMessage(filtOpUpdate);
 }
 
 FilterCoordinator* CommonCore::getFilterCoordinator(interface_handle handle)
@@ -2710,7 +2916,7 @@ void CommonCore::processCommand(ActionMessage&& command)
             processDestFilterReturn(command);
             break;
         case CMD_PUB:
-            routeMessage(command);
+            routeMessage(std::move(command));
             break;
         case CMD_LOG:
             if (command.dest_id == global_broker_id_local) {
@@ -2848,6 +3054,8 @@ void CommonCore::processCommand(ActionMessage&& command)
             if (brokerState.compare_exchange_strong(
                     exp, broker_state_t::operating)) { // forward the grant to all federates
                 organizeFilterOperations();
+                // the federates are all waiting on the grant so nothing from them is in flight yet
+                startRoutingShards();
                 loopFederates.apply([&command](auto& fed) { fed->addAction(command); });
                 timeCoord->enteringExecMode();
                 auto res = timeCoord->checkExecEntry();
@@ -2860,6 +3068,18 @@ void CommonCore::processCommand(ActionMessage&& command)
             }
         } break;
 
+        case CMD_ENDPOINT_RESOLVED:
+            resolvedEndpoints[command.name] = global_handle(command.source_id, command.source_handle);
+            break;
+        case CMD_REQUEST_FULL_VALUE:
+            routeMessage(command);
+            break;
+        case CMD_SHARD_SYNC:
+            if (command.counter < routingShards.size()) {
+                routingShards[command.counter]->synced.store(
+                    command.messageID, std::memory_order_release);
+            }
+            break;
         case CMD_SEND_MESSAGE:
             if ((command.dest_id == parent_broker_id) && (isLocal(command.source_id))) {
                 deliverMessage(processMessage(command));
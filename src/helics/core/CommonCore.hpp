@@ -11,6 +11,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "BrokerBase.hpp"
 #include "Core.hpp"
 #include "HandleManager.hpp"
+#include "RoutingTable.hpp"
 #include "gmlc/concurrency/DelayedObjects.hpp"
 #include "gmlc/concurrency/TriggerVariable.hpp"
 #include "gmlc/containers/AirLock.hpp"
@@ -24,7 +25,12 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include <array>
 #include <atomic>
+#include <map>
+#include <memory>
 #include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace helics {
 class TestHandle;
@@ -121,6 +127,10 @@ class CommonCore: public Core, public BrokerBase {
         setHandleOption(interface_handle handle, int32_t option, bool option_value) override final;
 
     virtual bool getHandleOption(interface_handle handle, int32_t option) const override final;
+    virtual void setHandleOptionValue(interface_handle handle, int32_t option, int32_t option_value)
+        override final;
+    virtual int32_t
+        getHandleOptionValue(interface_handle handle, int32_t option) const override final;
     virtual void closeHandle(interface_handle handle) override final;
     virtual void
         removeTarget(interface_handle handle, const std::string& targetToRemove) override final;
@@ -223,6 +233,12 @@ class CommonCore: public Core, public BrokerBase {
 
     virtual void setInterfaceInfo(interface_handle handle, std::string info) override final;
     virtual const std::string& getInterfaceInfo(interface_handle handle) const override final;
+    /** add an action Message to the process queue
+    @details if routing threads are active, commands from local federates go through the routing thread of the
+    source federate so they stay in order, anything else goes to the primary queue*/
+    void addActionMessage(const ActionMessage& m);
+    /** move an action Message into the process queue*/
+    void addActionMessage(ActionMessage&& m);
 
   private:
     /** implementation details of the connection process
@@ -233,6 +249,8 @@ class CommonCore: public Core, public BrokerBase {
     virtual void brokerDisconnect() = 0;
 
   protected:
+    virtual std::shared_ptr<helicsCLI11App> generateCLI() override;
+
     virtual void processCommand(ActionMessage&& cmd) override final;
 
     virtual void processPriorityCommand(ActionMessage&& cmd) override final;
@@ -285,12 +303,11 @@ class CommonCore: public Core, public BrokerBase {
 
   private:
     std::string prevIdentifier; //!< storage for the case of requiring a renaming
-    std::map<global_federate_id, route_id>
-        routing_table; //!< map for external routes  <global federate id, route id>
+    RoutingTable routing_table; //!< table of the routes to other federates and brokers
     gmlc::containers::SimpleQueue<ActionMessage>
         delayTransmitQueue; //!< FIFO queue for transmissions to the root that need to be delays for a certain time
-    std::unordered_map<std::string, route_id>
-        knownExternalEndpoints; //!< external map for all known external endpoints with names and route
+    /** endpoint names already resolved to a global handle, messages to these go straight to the handle*/
+    std::unordered_map<std::string, global_handle> resolvedEndpoints;
 
     std::unique_ptr<TimeoutMonitor>
         timeoutMon; //!< class to handle timeouts and disconnection notices
@@ -389,6 +406,16 @@ class CommonCore: public Core, public BrokerBase {
     std::array<gmlc::containers::AirLock<stx::any>, 4>
         dataAirlocks; //!< airlocks for updating filter operators and other functions
     gmlc::concurrency::TriggerVariable disconnection; //!< controller for the disconnection process
+
+    class RoutingShard;
+    int routingThreads{0}; //!< the number of threads routing federate traffic once the core is operating
+    std::vector<std::unique_ptr<RoutingShard>> routingShards; //!< the routing threads and their queues
+    /** the local federates and the index of the routing shard they use, fixed when the shards start*/
+    std::unordered_map<global_federate_id, std::pair<FederateState*, int>> shardFederates;
+    RoutingTable shardRoutes; //!< copy of the routing table for use in the routing threads
+    std::atomic<bool> shardsActive{false}; //!< indicator that the routing threads are in use
+    std::atomic<int> shardProducers{0}; //!< the number of threads handing a command to a routing shard
+
   private:
     /** wait for the core to be registered with the broker*/
     bool waitCoreRegistration();
@@ -454,6 +481,15 @@ class CommonCore: public Core, public BrokerBase {
     bool checkAndProcessDisconnect();
     /** send a disconnect message to time dependencies and child federates*/
     void sendDisconnect();
+    /** start the routing threads if they are requested and can be used*/
+    void startRoutingShards();
+    /** stop and join the routing threads*/
+    void stopRoutingShards();
+    /** the processing loop of a routing thread*/
+    void shardProcessingLoop(RoutingShard& shard);
+    /** route a command from a routing thread
+    @return false if the command needs to be processed by the main processing loop*/
+    bool routeShardCommand(ActionMessage& cmd);
 
     friend class TimeoutMonitor;
 };
@@ -8,11 +8,16 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "NetworkBrokerData.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <iterator>
+#include <random>
 
 namespace helics {
 CommsInterface::CommsInterface(thread_generation threads):
-    singleThread(threads == thread_generation::single)
+    singleThread(threads == thread_generation::single),
+    // a random start keeps the transfer ids from different comms forwarding the same source from colliding
+    transferCounter(static_cast<uint32_t>(std::random_device{}()))
 {
 }
 
@@ -31,6 +36,8 @@ void CommsInterface::loadNetworkInfo(const NetworkBrokerData& netInfo)
         interfaceNetwork = netInfo.interfaceNetwork;
         maxMessageSize = netInfo.maxMessageSize;
         maxMessageCount = netInfo.maxMessageCount;
+        maxBatchSize = (std::max)((std::min)(netInfo.maxBatchSize, 255), 1);
+        batchLinger = std::chrono::milliseconds(netInfo.batchLinger);
         brokerInitString = netInfo.brokerInitString;
         autoBroker = netInfo.autobroker;
         switch (netInfo.server_mode) {
@@ -97,6 +104,156 @@ void CommsInterface::transmit(route_id rid, ActionMessage&& cmd)
     }
 }
 
+std::pair<route_id, ActionMessage> CommsInterface::getNextTransmission()
+{
+    return std::move(*nextTransmission(true));
+}
+
+stx::optional<std::pair<route_id, ActionMessage>> CommsInterface::tryGetNextTransmission()
+{
+    return nextTransmission(false);
+}
+
+stx::optional<std::pair<route_id, ActionMessage>> CommsInterface::nextTransmission(bool wait)
+{
+    while (true) {
+        stx::optional<std::pair<route_id, ActionMessage>> next;
+        if (hasHeldTransmission) {
+            hasHeldTransmission = false;
+            next = std::move(heldTransmission);
+        } else if (!releasedTransmissions.empty()) {
+            next = std::move(releasedTransmissions.front());
+            releasedTransmissions.pop_front();
+        } else if (transfers.empty()) {
+            if (wait) {
+                next = txQueue.pop();
+            } else {
+                next = txQueue.try_pop();
+                if (!next) {
+                    return next;
+                }
+            }
+        } else if (!sendChunkNext) {
+            // alternate queued messages and chunks so a large transfer does not block other traffic
+            next = txQueue.try_pop();
+        }
+        if (!next) {
+            sendChunkNext = false;
+            return nextTransferChunk();
+        }
+        if (holdForTransfer(*next)) {
+            continue;
+        }
+        // the first chunk of a new transfer takes the place of a chunk in the alternation
+        sendChunkNext = !startTransfer(*next);
+        return next;
+    }
+}
+
+bool CommsInterface::holdForTransfer(std::pair<route_id, ActionMessage>& transmission)
+{
+    if (transfers.empty() || transmission.first == control_route ||
+        isProtocolCommand(transmission.second) || isPriorityCommand(transmission.second)) {
+        return false;
+    }
+    auto source = transmission.second.source_id;
+    auto fnd = std::find_if(transfers.begin(), transfers.end(), [source](const auto& transfer) {
+        return transfer.chunker.getSource() == source;
+    });
+    if (fnd == transfers.end()) {
+        return false;
+    }
+    fnd->waiting.push_back(std::move(transmission));
+    return true;
+}
+
+bool CommsInterface::startTransfer(std::pair<route_id, ActionMessage>& transmission)
+{
+    if (transmission.first == control_route || isProtocolCommand(transmission.second) ||
+        transmission.second.payloadSize() <= maxChunkSize) {
+        return false;
+    }
+    transfers.push_back(chunkedTransfer{
+        transmission.first,
+        MessageChunker(
+            std::move(transmission.second), static_cast<int32_t>(++transferCounter), maxChunkSize),
+        {}});
+    transmission.second = transfers.back().chunker.nextChunk();
+    return true;
+}
+
+std::pair<route_id, ActionMessage> CommsInterface::nextTransferChunk()
+{
+    auto& transfer = transfers.front();
+    std::pair<route_id, ActionMessage> chunk(transfer.rid, transfer.chunker.nextChunk());
+    if (transfer.chunker.done()) {
+        std::move(
+            transfer.waiting.begin(),
+            transfer.waiting.end(),
+            std::back_inserter(releasedTransmissions));
+        transfers.pop_front();
+    } else if (transfers.size() > 1) {
+        transfers.push_back(std::move(transfer));
+        transfers.pop_front();
+    }
+    return chunk;
+}
+
+/** check if a message can be combined with other messages in a single send
+@details the receiving command processor stops unpacking a multi message at a control command such as a
+stop or ping so those are always sent on their own*/
+static bool isBatchable(const ActionMessage& cmd)
+{
+    switch (cmd.action()) {
+        case CMD_TICK:
+        case CMD_PING:
+        case CMD_STOP:
+        case CMD_TERMINATE_IMMEDIATELY:
+        case CMD_MULTI_MESSAGE:
+            return false;
+        default:
+            return !(isProtocolCommand(cmd) || isPriorityCommand(cmd));
+    }
+}
+
+void CommsInterface::collectTransmitBatch(
+    route_id rid,
+    const ActionMessage& cmd,
+    int maxBytes,
+    std::vector<ActionMessage>& batch)
+{
+    batch.clear();
+    if (maxBatchSize <= 1 || hasHeldTransmission || rid == control_route || !isBatchable(cmd) ||
+        !transfers.empty() || !releasedTransmissions.empty()) {
+        return;
+    }
+    int bytes = cmd.serializedByteCount();
+    auto lingerEnd = std::chrono::steady_clock::now() + batchLinger;
+    while (static_cast<int>(batch.size()) + 1 < maxBatchSize) {
+        auto next = txQueue.try_pop();
+        if (!next && batchLinger > std::chrono::milliseconds(0)) {
+            auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+                lingerEnd - std::chrono::steady_clock::now());
+            if (remaining > std::chrono::milliseconds(0)) {
+                next = txQueue.pop(remaining);
+            }
+        }
+        if (!next) {
+            break;
+        }
+        // the extra 4 bytes cover the size prefix of a message in a multi message
+        auto nextBytes = next->second.serializedByteCount() + 4;
+        if (next->first != rid || !isBatchable(next->second) || bytes + nextBytes > maxBytes ||
+            next->second.payloadSize() > maxChunkSize) {
+            heldTransmission = std::move(*next);
+            hasHeldTransmission = true;
+            break;
+        }
+        bytes += nextBytes;
+        batch.push_back(std::move(next->second));
+    }
+}
+
 void CommsInterface::addRoute(route_id rid, const std::string& routeInfo)
 {
     ActionMessage rt(CMD_PROTOCOL_PRIORITY);
@@ -449,6 +606,35 @@ void CommsInterface::setServerMode(bool serverActive)
     }
 }
 
+void packetizeBatch(
+    const ActionMessage& cmd,
+    const std::vector<ActionMessage>& batch,
+    std::string& buffer)
+{
+    buffer.clear();
+    cmd.appendPacketized(buffer);
+    for (const auto& msg : batch) {
+        msg.appendPacketized(buffer);
+    }
+}
+
+void serializeBatch(
+    const ActionMessage& cmd,
+    const std::vector<ActionMessage>& batch,
+    std::string& buffer)
+{
+    if (batch.empty()) {
+        cmd.to_string(buffer);
+        return;
+    }
+    ActionMessage multi(CMD_MULTI_MESSAGE);
+    appendMessage(multi, cmd);
+    for (const auto& msg : batch) {
+        appendMessage(multi, msg);
+    }
+    multi.to_string(buffer);
+}
+
 bool CommsInterface::isConnected() const
 {
     return (
@@ -7,13 +7,20 @@ SPDX-License-Identifier: BSD-3-Clause
 #pragma once
 
 #include "ActionMessage.hpp"
+#include "ChunkedTransfer.hpp"
 #include "NetworkBrokerData.hpp"
 #include "gmlc/concurrency/TriggerVariable.hpp"
 #include "gmlc/concurrency/TripWire.hpp"
 #include "gmlc/containers/BlockingPriorityQueue.hpp"
 
+#include <chrono>
+#include <cstdint>
+#include <deque>
 #include <functional>
+#include <string>
 #include <thread>
+#include <utility>
+#include <vector>
 
 namespace helics {
 enum class interface_networks : char;
@@ -132,6 +139,10 @@ class CommsInterface {
         4000}; // timeout for the initial connection to a broker or to bind a broker port(in ms)
     int maxMessageSize = 16 * 1024; //!< the maximum message size for the queues (if needed)
     int maxMessageCount = 512; //!< the maximum number of message to buffer (if needed)
+    int maxBatchSize = 1; //!< the maximum number of messages combined in a single send, 1 disables batching
+    std::chrono::milliseconds batchLinger{0}; //!< the time to wait for more messages to fill a batch
+    /// payloads larger than this are sent as a chunked transfer interleaved with other traffic
+    std::size_t maxChunkSize{defaultChunkSize};
     std::atomic<bool> requestDisconnect{false}; //!< flag gets set when disconnect is called
     std::function<void(ActionMessage&&)>
         ActionCallback; //!< the callback for what to do with a received message
@@ -166,12 +177,72 @@ class CommsInterface {
     void propertyUnLock();
     /** function to join the processing threads*/
     void join_tx_rx_thread();
+    /** get the next message to transmit
+    @details a message held back while collecting a batch is returned before anything in the transmit queue.
+    A message with a payload larger than maxChunkSize is converted into a chunked transfer, while a transfer is
+    in progress its chunks alternate with other queued messages, messages from the same source as a transfer
+    are held until the transfer is complete so the ordering from each source is preserved
+    */
+    std::pair<route_id, ActionMessage> getNextTransmission();
+    /** get the next message to transmit without waiting for one \ref getNextTransmission*/
+    stx::optional<std::pair<route_id, ActionMessage>> tryGetNextTransmission();
+    /** collect the messages waiting in the transmit queue that can be sent along with a message
+    @details messages are collected until the batch size limit or the byte limit is reached, the queue is still
+    empty after the batch linger time, or a message for a different route or that cannot be batched is found,
+    that message is held and returned by the next call to getNextTransmission
+    @param rid the route the message is going to
+    @param cmd the message starting the batch
+    @param maxBytes the maximum total serialized size of the batch
+    @param batch vector to place the additional messages in, it is cleared first
+    */
+    void collectTransmitBatch(
+        route_id rid,
+        const ActionMessage& cmd,
+        int maxBytes,
+        std::vector<ActionMessage>& batch);
 
   private:
     gmlc::concurrency::TripWireDetector
         tripDetector; //!< try to detect if everything is shutting down
+    std::pair<route_id, ActionMessage> heldTransmission; //!< message held back from a batch
+    bool hasHeldTransmission{false}; //!< indicator that there is a held message
+    /** a chunked transfer in progress*/
+    struct chunkedTransfer {
+        route_id rid; //!< the route the transfer is going to
+        MessageChunker chunker; //!< the generator for the chunks
+        /// messages from the same source waiting for the transfer to complete
+        std::vector<std::pair<route_id, ActionMessage>> waiting;
+    };
+    std::deque<chunkedTransfer> transfers; //!< the chunked transfers in progress
+    /// messages released by a completed transfer, sent before anything in the transmit queue
+    std::deque<std::pair<route_id, ActionMessage>> releasedTransmissions;
+    uint32_t transferCounter{0}; //!< the identifier of the last chunked transfer, wraps around
+    bool sendChunkNext{false}; //!< indicator that a chunk should be sent before the next queued message
+    /** get the next message to transmit, optionally waiting for one*/
+    stx::optional<std::pair<route_id, ActionMessage>> nextTransmission(bool wait);
+    /** hold a message if a transfer from the same source is in progress
+    @return true if the message was held*/
+    bool holdForTransfer(std::pair<route_id, ActionMessage>& transmission);
+    /** start a chunked transfer if the payload is too large for a single message
+    @return true if a transfer was started, the message is replaced with the first chunk*/
+    bool startTransfer(std::pair<route_id, ActionMessage>& transmission);
+    /** generate the next chunk of the transfers in progress in round robin order*/
+    std::pair<route_id, ActionMessage> nextTransferChunk();
 };
 
+/** generate a packetized stream containing a message and the batch of messages that follow it*/
+void packetizeBatch(
+    const ActionMessage& cmd,
+    const std::vector<ActionMessage>& batch,
+    std::string& buffer);
+/** generate a single serialized command containing a message and the batch of messages that follow it
+@details if the batch is empty the result is the serialized message, otherwise it is a multi message command
+*/
+void serializeBatch(
+    const ActionMessage& cmd,
+    const std::vector<ActionMessage>& batch,
+    std::string& buffer);
+
 template<class X>
 class ConditionalChangeOnDestroy {
   private:
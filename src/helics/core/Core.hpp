@@ -418,6 +418,20 @@ class Core {
     */
     virtual bool getHandleOption(interface_handle handle, int32_t option) const = 0;
 
+    /** set a handle option that takes an integer value
+    @param handle the handle from the publication, input, endpoint or filter
+    @param option the option to set
+    @param option_value the value to set the option to, flag options treat any non-zero value as true
+    */
+    virtual void
+        setHandleOptionValue(interface_handle handle, int32_t option, int32_t option_value) = 0;
+
+    /** get the integer value of a handle option
+    @param handle the handle from the publication, input, endpoint or filter
+    @param option the option to get see /ref defs::options
+    */
+    virtual int32_t getHandleOptionValue(interface_handle handle, int32_t option) const = 0;
+
     /** close a handle from further connections
     @param handle the handle from the publication, input, endpoint or filter
     */
@@ -55,9 +55,7 @@ route_id CoreBroker::getRoute(global_federate_id fedid) const
     if ((fedid == parent_broker_id) || (fedid == higher_broker_id)) {
         return parent_route_id;
     }
-    auto fnd = routing_table.find(fedid);
-    return (fnd != routing_table.end()) ? fnd->second :
-                                          parent_route_id; // zero is the default route
+    return routing_table.find(fedid, parent_route_id); // zero is the default route
 }
 
 BasicBrokerInfo* CoreBroker::getBrokerById(global_broker_id brokerid)
@@ -312,7 +310,7 @@ void CoreBroker::processPriorityCommand(ActionMessage&& command)
                     // we would get this if the ack didn't go through for some reason
                     brk->route = route_id{routeCount++};
                     addRoute(brk->route, command.getString(targetStringLoc));
-                    routing_table[brk->global_id] = brk->route;
+                    routing_table.set(brk->global_id, brk->route);
 
                     // sending the response message
                     ActionMessage brokerReply(CMD_BROKER_ACK);
@@ -1004,13 +1002,21 @@ void CoreBroker::processCommand(ActionMessage&& command)
         case CMD_NULL_MESSAGE:
             if (command.dest_id == parent_broker_id) {
                 auto route = fillMessageRouteInformation(command);
+                if ((command.action() == CMD_SEND_MESSAGE) && (command.dest_id != parent_broker_id)) {
+                    // let the sending core address further messages to this endpoint by handle
+                    ActionMessage resolved(CMD_ENDPOINT_RESOLVED);
+                    resolved.setSource(command.getDest());
+                    resolved.dest_id = command.source_id;
+                    resolved.name = command.getString(targetStringLoc);
+                    routeMessage(resolved);
+                }
                 transmit(route, command);
             } else {
                 transmit(getRoute(command.dest_id), command);
             }
             break;
         case CMD_PUB:
-            transmit(getRoute(command.dest_id), command);
+            transmit(getRoute(command.dest_id), std::move(command));
             break;
 
         case CMD_LOG:
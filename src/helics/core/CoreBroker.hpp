@@ -12,6 +12,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "Broker.hpp"
 #include "BrokerBase.hpp"
 #include "HandleManager.hpp"
+#include "RoutingTable.hpp"
 #include "TimeDependencies.hpp"
 #include "UnknownHandleManager.hpp"
 #include "federate_id_extra.hpp"
@@ -92,8 +93,7 @@ class CoreBroker: public Broker, public BrokerBase {
         delayedDependencies; //!< set of dependencies that need to be created on init
     std::unordered_map<global_federate_id, local_federate_id>
         global_id_translation; //!< map to translate global ids to local ones
-    std::unordered_map<global_federate_id, route_id>
-        routing_table; //!< map for external routes  <global federate id, route id>
+    RoutingTable routing_table; //!< table of the routes to other federates and brokers
     std::unordered_map<std::string, route_id>
         knownExternalEndpoints; //!< external map for all known external endpoints with names and route
     std::unordered_map<std::string, std::string> global_values; //!< storage for global values
@@ -30,6 +30,10 @@ SPDX-License-Identifier: BSD-3-Clause
 #    include "ipc/IpcCore.h"
 #endif
 
+#ifdef ENABLE_SHM_CORE
+#    include "shm/ShmCore.h"
+#endif
+
 #ifdef ENABLE_UDP_CORE
 #    include "udp/UdpCore.h"
 #endif
@@ -148,6 +152,17 @@ std::shared_ptr<Core> makeCore(core_type type, const std::string& name)
             break;
 #else
             throw(HelicsException("IPC core is not available"));
+#endif
+        case core_type::SHM:
+#ifdef ENABLE_SHM_CORE
+            if (name.empty()) {
+                core = std::make_shared<shm::ShmCore>();
+            } else {
+                core = std::make_shared<shm::ShmCore>(name);
+            }
+            break;
+#else
+            throw(HelicsException("shared memory core is not available"));
 #endif
         case core_type::UDP:
 #ifdef ENABLE_UDP_CORE
@@ -397,6 +412,12 @@ without issue*/
                     return (dynamic_cast<ipc::IpcCore*>(ptr.get()) != nullptr);
 #else
                     break;
+#endif
+                case core_type::SHM:
+#ifdef ENABLE_SHM_CORE
+                    return (dynamic_cast<shm::ShmCore*>(ptr.get()) != nullptr);
+#else
+                    break;
 #endif
                 case core_type::UDP:
 #ifdef ENABLE_UDP_CORE
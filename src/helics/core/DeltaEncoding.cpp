@@ -0,0 +1,123 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "DeltaEncoding.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+namespace helics {
+/** unchanged runs shorter than this are included in a range rather than starting a new one*/
+constexpr std::size_t minimumGap{8};
+/** size of the blocks compared at once while skipping unchanged data*/
+constexpr std::size_t blockSize{64};
+
+static void appendVarInt(std::string& str, std::size_t val)
+{
+    while (val >= 0x80U) {
+        str.push_back(static_cast<char>((val & 0x7FU) | 0x80U));
+        val >>= 7U;
+    }
+    str.push_back(static_cast<char>(val));
+}
+
+static bool readVarInt(const char*& loc, const char* end, std::size_t& val)
+{
+    val = 0;
+    unsigned int shift{0};
+    while (loc < end && shift < 64) {
+        auto byte = static_cast<unsigned char>(*loc++);
+        val |= static_cast<std::size_t>(byte & 0x7FU) << shift;
+        if ((byte & 0x80U) == 0) {
+            return true;
+        }
+        shift += 7;
+    }
+    return false;
+}
+
+/** find the first byte at or after start that differs between the two buffers*/
+static std::size_t nextDifference(const char* a, const char* b, std::size_t start, std::size_t len)
+{
+    while (start + blockSize <= len && std::memcmp(a + start, b + start, blockSize) == 0) {
+        start += blockSize;
+    }
+    while (start < len && a[start] == b[start]) {
+        ++start;
+    }
+    return start;
+}
+
+bool encodeValueDelta(
+    const std::string& previous,
+    const char* data,
+    std::size_t len,
+    std::string& delta)
+{
+    if (previous.size() != len || len == 0) {
+        return false;
+    }
+    const char* prev = previous.data();
+    const std::size_t limit = len / 2;
+    delta.clear();
+    appendVarInt(delta, len);
+    std::size_t lastEnd{0};
+    std::size_t pos = nextDifference(prev, data, 0, len);
+    while (pos < len) {
+        // extend the range until there is a long enough run of unchanged bytes
+        std::size_t end = pos + 1;
+        std::size_t same{0};
+        while (end < len && same < minimumGap) {
+            same = (prev[end] == data[end]) ? same + 1 : 0;
+            ++end;
+        }
+        end -= same;
+        appendVarInt(delta, pos - lastEnd);
+        appendVarInt(delta, end - pos);
+        delta.append(data + pos, end - pos);
+        if (delta.size() >= limit) {
+            return false;
+        }
+        lastEnd = end;
+        pos = nextDifference(prev, data, end, len);
+    }
+    return true;
+}
+
+bool applyValueDelta(
+    const std::string& base,
+    const char* delta,
+    std::size_t len,
+    std::string& result)
+{
+    const char* loc = delta;
+    const char* end = delta + len;
+    std::size_t size{0};
+    if (!readVarInt(loc, end, size) || size != base.size()) {
+        return false;
+    }
+    result = base;
+    std::size_t pos{0};
+    while (loc < end) {
+        std::size_t skip{0};
+        std::size_t count{0};
+        if (!readVarInt(loc, end, skip) || !readVarInt(loc, end, count)) {
+            return false;
+        }
+        if (skip > size - pos) {
+            return false;
+        }
+        pos += skip;
+        if (count > size - pos || count > static_cast<std::size_t>(end - loc)) {
+            return false;
+        }
+        std::memcpy(&result[pos], loc, count);
+        loc += count;
+        pos += count;
+    }
+    return true;
+}
+} // namespace helics
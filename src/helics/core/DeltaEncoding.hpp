@@ -0,0 +1,44 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace helics {
+/** generate a delta of a value against a previously transmitted value
+@details the delta is the size of the value followed by a sequence of ranges of bytes that differ from the
+previous value, each range is encoded as the distance from the end of the previous range, the length of the
+range, and the new bytes.  Ranges separated by only a few unchanged bytes are merged.  The delta only works on
+the serialized bytes so it is independent of the type of the value, values with a different size than the
+previous value are always sent in full
+@param previous the previously transmitted value
+@param data the new value
+@param len the size of the new value
+@param delta the string to store the delta in
+@return true if a delta was generated and is less than half the size of the value, false if the full value
+should be transmitted instead
+*/
+bool encodeValueDelta(
+    const std::string& previous,
+    const char* data,
+    std::size_t len,
+    std::string& delta);
+
+/** reconstruct a value from a delta generated by encodeValueDelta
+@param base the value the delta was generated against
+@param delta the delta data
+@param len the size of the delta data
+@param result the string to store the reconstructed value in
+@return false if the delta is malformed or was not generated from a value the size of base
+*/
+bool applyValueDelta(
+    const std::string& base,
+    const char* delta,
+    std::size_t len,
+    std::string& result);
+} // namespace helics
@@ -7,9 +7,6 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "EndpointInfo.hpp"
 //#include "core/core-data.hpp"
 
-#include <algorithm>
-#include <cstring>
-
 namespace helics {
 std::unique_ptr<Message> EndpointInfo::getMessage(Time maxTime)
 {
@@ -17,9 +14,10 @@ std::unique_ptr<Message> EndpointInfo::getMessage(Time maxTime)
     if (handle->empty()) {
         return nullptr;
     }
-    if (handle->front()->time <= maxTime) {
-        auto msg = std::move(handle->front());
-        handle->pop_front();
+    auto first = handle->begin();
+    if (first->message->time <= maxTime) {
+        auto msg = std::move(first->message);
+        handle->erase(first);
         return msg;
     }
     return nullptr;
@@ -28,20 +26,15 @@ std::unique_ptr<Message> EndpointInfo::getMessage(Time maxTime)
 Time EndpointInfo::firstMessageTime() const
 {
     auto handle = message_queue.lock_shared();
-    return (handle->empty()) ? Time::maxVal() : handle->front()->time;
+    return (handle->empty()) ? Time::maxVal() : handle->begin()->message->time;
 }
-// this is the function which determines message order
-static auto msgSorter = [](const auto& m1, const auto& m2) {
-    // first by time
-    return (m1->time != m2->time) ? (m1->time < m2->time) :
-                                    (m1->original_source < m2->original_source);
-};
 
 void EndpointInfo::addMessage(std::unique_ptr<Message> message)
 {
     auto handle = message_queue.lock();
-    handle->push_back(std::move(message));
-    std::stable_sort(handle->begin(), handle->end(), msgSorter);
+    // equivalent messages are inserted after existing ones, and hinting at the end makes the common case of
+    // messages arriving in order constant time
+    handle->insert(handle->end(), queuedMessage{std::move(message)});
 }
 
 void EndpointInfo::clearQueue()
@@ -52,9 +45,15 @@ void EndpointInfo::clearQueue()
 int32_t EndpointInfo::queueSize(Time maxTime) const
 {
     auto handle = message_queue.lock_shared();
+    if (handle->empty()) {
+        return 0;
+    }
+    if (handle->rbegin()->message->time <= maxTime) {
+        return static_cast<int32_t>(handle->size());
+    }
     int32_t cnt = 0;
     for (auto& msg : *handle) {
-        if (msg->time <= maxTime) {
+        if (msg.message->time <= maxTime) {
             ++cnt;
         } else {
             break;
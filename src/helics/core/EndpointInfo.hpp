@@ -9,7 +9,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../common/GuardedTypes.hpp"
 #include "basic_core_types.hpp"
 
-#include <deque>
+#include <set>
 namespace helics {
 /** data class containing the information about an endpoint*/
 class EndpointInfo {
@@ -24,7 +24,23 @@ class EndpointInfo {
     const std::string key; //!< name of the endpoint
     const std::string type; //!< type of the endpoint
   private:
-    shared_guarded<std::deque<std::unique_ptr<Message>>>
+    /** element of the message queue
+    @details the message is mutable so it can be moved out of the queue just prior to being erased*/
+    struct queuedMessage {
+        mutable std::unique_ptr<Message> message;
+    };
+    /** ordering of the queued messages
+    @details messages are ordered by time then by original source, messages that compare equal stay in the
+    order they arrived*/
+    struct messageOrder {
+        bool operator()(const queuedMessage& m1, const queuedMessage& m2) const
+        {
+            return (m1.message->time != m2.message->time) ?
+                (m1.message->time < m2.message->time) :
+                (m1.message->original_source < m2.message->original_source);
+        }
+    };
+    shared_guarded<std::multiset<queuedMessage, messageOrder>>
         message_queue; //!< storage for the messages
   public:
     bool hasFilter = false; //!< indicator that the message has a filter
@@ -180,6 +180,20 @@ bool FederateState::checkAndSetValue(interface_handle pub_id, const char* data,
     return res;
 }
 
+bool FederateState::generateValueDelta(
+    interface_handle pub_id,
+    const char* data,
+    uint64_t len,
+    std::string& delta)
+{
+    std::lock_guard<FederateState> plock(*this);
+    auto pub = interfaceInformation.getPublication(pub_id);
+    if (pub == nullptr || !pub->delta_transmission) {
+        return false;
+    }
+    return pub->generateDelta(data, len, delta);
+}
+
 std::string FederateState::generateConfig() const
 {
     static const std::string truestr{"true"};
@@ -213,8 +227,13 @@ uint64_t FederateState::getQueueSize(interface_handle handle_) const
 uint64_t FederateState::getQueueSize() const
 {
     uint64_t cnt = 0;
-    for (const auto& end_point : interfaceInformation.getEndpoints()) {
-        cnt += end_point->queueSize(time_granted);
+    std::lock_guard<std::mutex> lock(messageIndexLock);
+    // only endpoints whose first message is ready can contribute to the count
+    for (const auto& entry : messageIndex) {
+        if (entry.first.first > time_granted) {
+            break;
+        }
+        cnt += entry.second->queueSize(time_granted);
     }
     return cnt;
 }
@@ -223,35 +242,43 @@ std::unique_ptr<Message> FederateState::receive(interface_handle handle_)
 {
     auto epI = interfaceInformation.getEndpoint(handle_);
     if (epI != nullptr) {
-        return epI->getMessage(time_granted);
+        std::lock_guard<std::mutex> lock(messageIndexLock);
+        auto previousTime = epI->firstMessageTime();
+        auto result = epI->getMessage(time_granted);
+        updateMessageIndex(epI, previousTime);
+        return result;
     }
     return nullptr;
 }
 
 std::unique_ptr<Message> FederateState::receiveAny(interface_handle& id)
 {
-    Time earliest_time = Time::maxVal();
-    EndpointInfo* endpointI = nullptr;
-    auto elock = interfaceInformation.getEndpoints();
-    // Find the end point with the earliest message time
-    for (auto& end_point : elock) {
-        auto t = end_point->firstMessageTime();
-        if (t < earliest_time) {
-            earliest_time = t;
-            endpointI = end_point.get();
-        }
-    }
-    if (endpointI == nullptr) {
+    std::lock_guard<std::mutex> lock(messageIndexLock);
+    // the first entry in the index is the endpoint with the earliest message
+    auto first = messageIndex.begin();
+    if ((first == messageIndex.end()) || (first->first.first > time_granted)) {
+        id = interface_handle();
         return nullptr;
     }
-    // Return the message found and remove from the queue
-    if (earliest_time <= time_granted) {
-        auto result = endpointI->getMessage(time_granted);
-        id = endpointI->id.handle;
-        return result;
+    auto endpointI = first->second;
+    auto result = endpointI->getMessage(time_granted);
+    updateMessageIndex(endpointI, first->first.first);
+    id = endpointI->id.handle;
+    return result;
+}
+
+void FederateState::updateMessageIndex(EndpointInfo* ept, Time previousTime)
+{
+    auto newTime = ept->firstMessageTime();
+    if (newTime == previousTime) {
+        return;
+    }
+    if (previousTime != Time::maxVal()) {
+        messageIndex.erase(std::make_pair(previousTime, ept->id.handle));
+    }
+    if (newTime != Time::maxVal()) {
+        messageIndex.emplace(std::make_pair(newTime, ept->id.handle), ept);
     }
-    id = interface_handle();
-    return nullptr;
 }
 
 void FederateState::routeMessage(const ActionMessage& msg)
@@ -344,7 +371,10 @@ void FederateState::closeInterface(interface_handle handle, handle_type type)
         case handle_type::endpoint: {
             auto ept = interfaceInformation.getEndpoint(handle);
             if (ept != nullptr) {
+                std::lock_guard<std::mutex> lock(messageIndexLock);
+                auto previousTime = ept->firstMessageTime();
                 ept->clearQueue();
+                updateMessageIndex(ept, previousTime);
             }
         } break;
         case handle_type::input: {
@@ -357,7 +387,7 @@ void FederateState::closeInterface(interface_handle handle, handle_type type)
                     rem.setDestination(pub);
                     routeMessage(rem);
                 }
-                ipt->input_sources.clear();
+                ipt->clearSources();
                 ipt->clearFutureData();
             }
         } break;
@@ -1043,7 +1073,12 @@ message_processing_result FederateState::processActionMessage(ActionMessage& cmd
             if (epi != nullptr) {
                 timeCoord->updateMessageTime(cmd.actionTime);
                 LOG_DATA(fmt::format("receive_message {}", prettyPrintString(cmd)));
+                // names dropped in transit are only materialized here where the message is delivered
+                cmd.expandMessageNames(epi->key);
+                std::lock_guard<std::mutex> lock(messageIndexLock);
+                auto previousTime = epi->firstMessageTime();
                 epi->addMessage(createMessageFromCommand(std::move(cmd)));
+                updateMessageIndex(epi, previousTime);
             }
         } break;
         case CMD_PUB: {
@@ -1051,20 +1086,34 @@ message_processing_result FederateState::processActionMessage(ActionMessage& cmd
             if (subI == nullptr) {
                 break;
             }
-            for (auto& src : subI->input_sources) {
-                if ((cmd.source_id == src.fed_id) && (cmd.source_handle == src.handle)) {
-                    subI->addData(
-                        src,
-                        cmd.actionTime,
-                        cmd.counter,
-                        std::make_shared<const data_block>(std::move(cmd.payload)));
-                    if (!subI->not_interruptible) {
-                        timeCoord->updateValueTime(cmd.actionTime);
-                        LOG_TRACE(timeCoord->printTimeStatus());
+            auto src = cmd.getSource();
+            if (subI->getSourceIndex(src) < 0) {
+                break;
+            }
+            if (checkActionFlag(cmd, delta_value_flag)) {
+                if (!subI->addDeltaData(
+                        src, cmd.actionTime, cmd.counter, cmd.payloadData(), cmd.payloadSize())) {
+                    if (subI->requestFullValue(src)) {
+                        // the base value was lost so ask the publication to send its next value in full
+                        ActionMessage resync(CMD_REQUEST_FULL_VALUE);
+                        resync.setSource(subI->id);
+                        resync.setDestination(src);
+                        routeMessage(resync);
                     }
-                    LOG_DATA(fmt::format("receive publication {}", prettyPrintString(cmd)));
+                    LOG_WARNING(fmt::format(
+                        "unable to apply value delta from {} to {}",
+                        prettyPrintString(cmd),
+                        subI->key));
+                    break;
                 }
+            } else {
+                subI->addData(src, cmd.actionTime, cmd.counter, cmd.extractSharedPayload().share());
+            }
+            if (!subI->not_interruptible) {
+                timeCoord->updateValueTime(cmd.actionTime);
+                LOG_TRACE(timeCoord->printTimeStatus());
             }
+            LOG_DATA(fmt::format("receive publication {}", prettyPrintString(cmd)));
         } break;
         case CMD_WARNING:
             if (cmd.payload.empty()) {
@@ -1102,9 +1151,17 @@ message_processing_result FederateState::processActionMessage(ActionMessage& cmd
             auto pubI = interfaceInformation.getPublication(cmd.dest_handle);
             if (pubI != nullptr) {
                 pubI->subscribers.emplace_back(cmd.source_id, cmd.source_handle);
+                // the new subscriber has no base for a delta so the next value must be sent in full
+                pubI->lastTransmission.clear();
                 addDependent(cmd.source_id);
             }
         } break;
+        case CMD_REQUEST_FULL_VALUE: {
+            auto pubI = interfaceInformation.getPublication(cmd.dest_handle);
+            if (pubI != nullptr) {
+                pubI->lastTransmission.clear();
+            }
+        } break;
         case CMD_ADD_DEPENDENCY:
         case CMD_REMOVE_DEPENDENCY:
         case CMD_ADD_DEPENDENT:
@@ -1233,7 +1290,9 @@ void FederateState::setInterfaceProperty(const ActionMessage& cmd)
     switch (static_cast<char>(cmd.counter)) {
         case 'i':
             used = interfaceInformation.setInputProperty(
-                cmd.dest_handle, cmd.messageID, checkActionFlag(cmd, indicator_flag));
+                cmd.dest_handle,
+                cmd.messageID,
+                (checkActionFlag(cmd, indicator_flag)) ? static_cast<int32_t>(cmd.sequenceID) : 0);
             if (!used) {
                 auto ipt = interfaceInformation.getInput(cmd.dest_handle);
                 if (ipt != nullptr) {
@@ -1436,7 +1495,7 @@ bool FederateState::getOptionFlag(int optionFlag) const
     }
 }
 
-bool FederateState::getHandleOption(interface_handle handle, char iType, int32_t option) const
+int32_t FederateState::getHandleOption(interface_handle handle, char iType, int32_t option) const
 {
     switch (iType) {
         case 'i':
@@ -1536,16 +1595,11 @@ Time FederateState::nextValueTime() const
 /** find the next Message Event*/
 Time FederateState::nextMessageTime() const
 {
-    auto firstMessageTime = Time::maxVal();
-    for (auto& ep : interfaceInformation.getEndpoints()) {
-        auto messageTime = ep->firstMessageTime();
-        if (messageTime >= time_granted) {
-            if (messageTime < firstMessageTime) {
-                firstMessageTime = messageTime;
-            }
-        }
-    }
-    return firstMessageTime;
+    std::lock_guard<std::mutex> lock(messageIndexLock);
+    // a default interface_handle sorts before any valid handle so this finds the first endpoint
+    // whose first message is at or after the granted time
+    auto next = messageIndex.lower_bound(std::make_pair(time_granted, interface_handle()));
+    return (next != messageIndex.end()) ? next->first.first : Time::maxVal();
 }
 
 void FederateState::setCoreObject(CommonCore* parent)
@@ -18,6 +18,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <atomic>
 #include <chrono>
 #include <map>
+#include <mutex>
 #include <thread>
 #include <vector>
 
@@ -106,6 +107,9 @@ class FederateState {
     Time time_granted = startupTime; //!< the most recent granted time;
     Time allowed_send_time = startupTime; //!< the next time a message can be sent;
     mutable std::atomic_flag processing = ATOMIC_FLAG_INIT; //!< the federate is processing
+    /** index of endpoints with queued messages keyed by the first message time and the handle*/
+    std::map<std::pair<Time, interface_handle>, EndpointInfo*> messageIndex;
+    mutable std::mutex messageIndexLock; //!< lock protecting the message index
   private:
     /** a logging function for logging or printing messages*/
     std::function<void(int, const std::string&, const std::string&)>
@@ -116,6 +120,12 @@ class FederateState {
     Time nextValueTime() const;
     /** find the next Message Event*/
     Time nextMessageTime() const;
+    /** update the message index entry for an endpoint after its queue was modified
+    @details the messageIndexLock must be held by the caller
+    @param ept the endpoint whose queue was modified
+    @param previousTime the time of the first message in the endpoint queue before the modification
+    */
+    void updateMessageIndex(EndpointInfo* ept, Time previousTime);
 
     /** update the federate state */
     void setState(federate_state newState);
@@ -176,7 +186,7 @@ class FederateState {
     /** get an option flag value*/
     bool getOptionFlag(int optionFlag) const;
     /** get the currently active option for a handle*/
-    bool getHandleOption(interface_handle handle, char iType, int32_t option) const;
+    int32_t getHandleOption(interface_handle handle, char iType, int32_t option) const;
     /** get the currently active interface flags*/
     uint16_t getInterfaceFlags() const { return interfaceFlags.load(); }
     /** get an option flag value*/
@@ -352,6 +362,18 @@ class FederateState {
     @return true if it should be published, false if not
     */
     bool checkAndSetValue(interface_handle pub_id, const char* data, uint64_t len);
+    /** generate a delta of a value for a publication using delta transmission
+    @param pub_id the handle of the publication
+    @param data the raw data to transmit
+    @param len the length of the data
+    @param delta the string to store the delta in
+    @return true if the delta should be transmitted instead of the data
+    */
+    bool generateValueDelta(
+        interface_handle pub_id,
+        const char* data,
+        uint64_t len,
+        std::string& delta);
 
     /** route a message either forward to parent or add to queue*/
     void routeMessage(const ActionMessage& msg);
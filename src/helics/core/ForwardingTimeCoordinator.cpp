@@ -76,12 +76,12 @@ class minTimeSet {
     DependencyInfo::time_state_t tState = DependencyInfo::time_state_t::time_requested;
 };
 
-static minTimeSet generateMinTimeSet(
+/** search all the dependencies for the minimum times*/
+static void searchMinTimeSet(
+    minTimeSet& mTime,
     const TimeDependencies& dependencies,
-    bool restricted,
-    global_federate_id ignore = global_federate_id())
+    global_federate_id ignore)
 {
-    minTimeSet mTime;
     for (auto& dep : dependencies) {
         if (dep.fedID == ignore) {
             continue;
@@ -111,6 +111,25 @@ static minTimeSet generateMinTimeSet(
             mTime.minDe = dep.Te;
         }
     }
+}
+
+static minTimeSet generateMinTimeSet(
+    const TimeDependencies& dependencies,
+    bool restricted,
+    global_federate_id ignore = global_federate_id())
+{
+    minTimeSet mTime;
+    auto summary = dependencies.getTimeSummary();
+    if (!ignore.isValid() && summary.invalidDemin == 0) {
+        // the tracked summary is the same as the result of a search when all the Tdemin are valid
+        mTime.minNext = summary.minNext;
+        mTime.tState = summary.tState;
+        mTime.minminDe = summary.minminDe;
+        mTime.minFed = summary.minFed;
+        mTime.minDe = summary.minDe;
+    } else {
+        searchMinTimeSet(mTime, dependencies, ignore);
+    }
 
     mTime.minminDe = std::min(mTime.minDe, mTime.minminDe);
 
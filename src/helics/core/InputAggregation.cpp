@@ -0,0 +1,314 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "InputAggregation.hpp"
+
+#include "../helics_enums.h"
+#include "NativeVectorLayout.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <unordered_set>
+
+namespace helics {
+static const std::unordered_set<std::string> doubleTypes{"double", "float", "d", "f"};
+static const std::unordered_set<std::string> integerTypes{"int",
+                                                          "int64",
+                                                          "integer",
+                                                          "int32",
+                                                          "uint32",
+                                                          "uint64",
+                                                          "int16",
+                                                          "uint16",
+                                                          "int8",
+                                                          "uint8",
+                                                          "uchar",
+                                                          "byte",
+                                                          "short",
+                                                          "long",
+                                                          "long long",
+                                                          "i",
+                                                          "i64"};
+static const std::unordered_set<std::string> vectorTypes{"vector",
+                                                         "double_vector",
+                                                         "double vector",
+                                                         "v"};
+/** types that carry no information about the encoding*/
+static const std::unordered_set<std::string> genericTypes{"",
+                                                          "def",
+                                                          "default",
+                                                          "any",
+                                                          "raw",
+                                                          "all"};
+
+static bool nativeLittleEndian()
+{
+    const std::uint16_t test{1};
+    unsigned char first{0};
+    std::memcpy(&first, &test, 1);
+    return first == 1;
+}
+
+/** read an 8 byte value from a buffer written by the portable binary archive*/
+template<class X>
+static X readValue(const char* loc, bool swap)
+{
+    char bytes[sizeof(X)];
+    std::memcpy(bytes, loc, sizeof(X));
+    if (swap) {
+        std::reverse(bytes, bytes + sizeof(X));
+    }
+    X val;
+    std::memcpy(&val, bytes, sizeof(X));
+    return val;
+}
+
+/** check the endianness byte at the start of a binary value
+@return false if the byte is not a valid indicator*/
+static bool checkEndianness(const data_block& data, bool& swap)
+{
+    auto flag = static_cast<unsigned char>(data[0]);
+    if (flag > 1) {
+        return false;
+    }
+    swap = ((flag == 1) != nativeLittleEndian());
+    return true;
+}
+
+static bool decodeDouble(const data_block& data, std::vector<double>& values)
+{
+    bool swap{false};
+    if (data.size() != sizeof(double) + 1 || !checkEndianness(data, swap)) {
+        return false;
+    }
+    values.assign(1, readValue<double>(data.data() + 1, swap));
+    return true;
+}
+
+static bool decodeInteger(const data_block& data, std::vector<double>& values)
+{
+    bool swap{false};
+    if (data.size() != sizeof(std::int64_t) + 1 || !checkEndianness(data, swap)) {
+        return false;
+    }
+    values.assign(1, static_cast<double>(readValue<std::int64_t>(data.data() + 1, swap)));
+    return true;
+}
+
+static bool decodeVector(const data_block& data, std::vector<double>& values)
+{
+    bool swap{false};
+    std::size_t nativeCount{0};
+    if (native_vector::readHeader(
+            data.data(), data.size(), sizeof(double), nativeCount, swap)) {
+        values.resize(nativeCount);
+        if (nativeCount > 0) {
+            const char* loc = data.data() + native_vector::headerSize;
+            if (!swap) {
+                std::memcpy(values.data(), loc, nativeCount * sizeof(double));
+            } else {
+                native_vector::copySwapped(values.data(), loc, nativeCount * sizeof(double));
+            }
+        }
+        return true;
+    }
+    constexpr std::size_t header{sizeof(std::uint64_t) + 1};
+    if (data.size() < header || !checkEndianness(data, swap)) {
+        return false;
+    }
+    auto count = readValue<std::uint64_t>(data.data() + 1, swap);
+    if (count != (data.size() - header) / sizeof(double) ||
+        (data.size() - header) % sizeof(double) != 0) {
+        return false;
+    }
+    values.resize(count);
+    const char* loc = data.data() + header;
+    if (!swap) {
+        std::memcpy(values.data(), loc, count * sizeof(double));
+    } else {
+        for (auto& val : values) {
+            val = readValue<double>(loc, true);
+            loc += sizeof(double);
+        }
+    }
+    return true;
+}
+
+static bool decodeString(const data_block& data, std::vector<double>& values)
+{
+    const auto& str = data.to_string();
+    char* end{nullptr};
+    double val = std::strtod(str.c_str(), &end);
+    if (end == str.c_str()) {
+        return false;
+    }
+    values.assign(1, val);
+    return true;
+}
+
+bool isNumericVectorType(const std::string& type)
+{
+    return (vectorTypes.find(type) != vectorTypes.end());
+}
+
+bool decodeNumericValue(
+    const std::string& type,
+    const data_block& data,
+    std::vector<double>& values)
+{
+    if (data.size() == 0) {
+        return false;
+    }
+    if (doubleTypes.find(type) != doubleTypes.end()) {
+        return decodeDouble(data, values);
+    }
+    if (integerTypes.find(type) != integerTypes.end()) {
+        return decodeInteger(data, values);
+    }
+    if (vectorTypes.find(type) != vectorTypes.end()) {
+        return decodeVector(data, values);
+    }
+    if (genericTypes.find(type) != genericTypes.end()) {
+        // no type information so go by the structure of the data
+        return decodeDouble(data, values) || decodeVector(data, values) ||
+            decodeString(data, values);
+    }
+    return decodeString(data, values);
+}
+
+data_block encodeNumericValue(const std::vector<double>& values, bool asVector)
+{
+    data_block result;
+    if (asVector) {
+        result.resize(native_vector::headerSize + values.size() * sizeof(double));
+        native_vector::writeHeader(result.data(), values.size(), sizeof(double));
+        if (!values.empty()) {
+            std::memcpy(
+                result.data() + native_vector::headerSize,
+                values.data(),
+                values.size() * sizeof(double));
+        }
+    } else {
+        double val = (values.empty()) ? std::nan("0") : values.front();
+        result.resize(1 + sizeof(double));
+        result[0] = nativeLittleEndian() ? 1 : 0;
+        std::memcpy(result.data() + 1, &val, sizeof(double));
+    }
+    return result;
+}
+
+// the kernels are kept as simple loops over contiguous arrays so the compiler can vectorize them
+static void sumKernel(double* __restrict res, const double* __restrict vals, std::size_t count)
+{
+    for (std::size_t ii = 0; ii < count; ++ii) {
+        res[ii] += vals[ii];
+    }
+}
+
+static void maxKernel(double* __restrict res, const double* __restrict vals, std::size_t count)
+{
+    for (std::size_t ii = 0; ii < count; ++ii) {
+        res[ii] = (vals[ii] > res[ii]) ? vals[ii] : res[ii];
+    }
+}
+
+static void minKernel(double* __restrict res, const double* __restrict vals, std::size_t count)
+{
+    for (std::size_t ii = 0; ii < count; ++ii) {
+        res[ii] = (vals[ii] < res[ii]) ? vals[ii] : res[ii];
+    }
+}
+
+bool isValidMultiInputMethod(int method)
+{
+    switch (method) {
+        case helics_multi_input_no_op:
+        case helics_multi_input_vectorize_operation:
+        case helics_multi_input_sum_operation:
+        case helics_multi_input_max_operation:
+        case helics_multi_input_min_operation:
+        case helics_multi_input_average_operation:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void aggregateNumericValues(
+    int method,
+    const std::vector<std::vector<double>>& values,
+    std::vector<double>& result)
+{
+    result.clear();
+    if (method == helics_multi_input_vectorize_operation) {
+        for (const auto& val : values) {
+            result.insert(result.end(), val.begin(), val.end());
+        }
+        return;
+    }
+    std::size_t maxLength{0};
+    std::size_t minLength{(std::numeric_limits<std::size_t>::max)()};
+    for (const auto& val : values) {
+        if (!val.empty()) {
+            maxLength = (std::max)(maxLength, val.size());
+            minLength = (std::min)(minLength, val.size());
+        }
+    }
+    if (maxLength == 0) {
+        return;
+    }
+    switch (method) {
+        case helics_multi_input_sum_operation:
+        case helics_multi_input_average_operation:
+            result.assign(maxLength, 0.0);
+            for (const auto& val : values) {
+                sumKernel(result.data(), val.data(), val.size());
+            }
+            if (method == helics_multi_input_average_operation) {
+                if (minLength == maxLength) {
+                    std::size_t count{0};
+                    for (const auto& val : values) {
+                        count += (val.empty()) ? 0 : 1;
+                    }
+                    const double scale = 1.0 / static_cast<double>(count);
+                    for (auto& res : result) {
+                        res *= scale;
+                    }
+                } else {
+                    // values of different lengths so each element has its own count
+                    std::vector<double> counts(maxLength, 0.0);
+                    for (const auto& val : values) {
+                        for (std::size_t ii = 0; ii < val.size(); ++ii) {
+                            counts[ii] += 1.0;
+                        }
+                    }
+                    for (std::size_t ii = 0; ii < maxLength; ++ii) {
+                        result[ii] /= counts[ii];
+                    }
+                }
+            }
+            break;
+        case helics_multi_input_max_operation:
+            result.assign(maxLength, -std::numeric_limits<double>::infinity());
+            for (const auto& val : values) {
+                maxKernel(result.data(), val.data(), val.size());
+            }
+            break;
+        case helics_multi_input_min_operation:
+            result.assign(maxLength, std::numeric_limits<double>::infinity());
+            for (const auto& val : values) {
+                minKernel(result.data(), val.data(), val.size());
+            }
+            break;
+        default:
+            break;
+    }
+}
+} // namespace helics
@@ -0,0 +1,52 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "core-data.hpp"
+
+#include <string>
+#include <vector>
+
+namespace helics {
+/** check if a type string describes a vector of doubles*/
+bool isNumericVectorType(const std::string& type);
+
+/** decode the numeric content of a serialized value
+@details the standard binary encodings of doubles, integers, and vectors of doubles are understood along
+with strings containing a number,  scalars are returned as a vector of length 1
+@param type the type string of the source that generated the value
+@param data the serialized value
+@param values the vector to store the decoded values in
+@return false if the value could not be interpreted as numbers
+*/
+bool decodeNumericValue(
+    const std::string& type,
+    const data_block& data,
+    std::vector<double>& values);
+
+/** encode the result of an aggregation in the standard binary encoding
+@param values the values to encode
+@param asVector true if the result should be encoded as a vector of doubles in the native vector layout,
+otherwise the first element is encoded as a double
+*/
+data_block encodeNumericValue(const std::vector<double>& values, bool asVector);
+
+/** check if a value is one of the supported operations see /ref helics_multi_input_mode*/
+bool isValidMultiInputMethod(int method);
+
+/** combine a set of numerical values from several sources
+@details the operations other than vectorize are applied element by element,  scalars are treated as vectors of
+length 1 and the result is the length of the longest value,  sources that have no value are ignored
+@param method the operation to apply see /ref helics_multi_input_mode
+@param values the decoded values of each source
+@param result the vector to store the combined value in
+*/
+void aggregateNumericValues(
+    int method,
+    const std::vector<std::vector<double>>& values,
+    std::vector<double>& result);
+} // namespace helics
@@ -111,7 +111,7 @@ EndpointInfo* InterfaceInfo::getEndpoint(interface_handle handle)
     return endpoints.lock()->find(handle);
 }
 
-bool InterfaceInfo::setInputProperty(interface_handle id, int option, bool value)
+bool InterfaceInfo::setInputProperty(interface_handle id, int option, int32_t value)
 {
     auto ipt = getInput(id);
     if (ipt == nullptr) {
@@ -142,6 +142,9 @@ bool InterfaceInfo::setInputProperty(interface_handle id, int option, bool value
         case defs::options::ignore_unit_mismatch:
             ipt->ignore_unit_mismatch = value;
             break;
+        case defs::options::multi_input_handling_method:
+            ipt->setMultiInputMethod(value);
+            break;
         default:
             return false;
             break;
@@ -174,6 +177,9 @@ bool InterfaceInfo::setPublicationProperty(interface_handle id, int option, bool
         case defs::options::buffer_data:
             pub->buffer_data = value;
             break;
+        case defs::options::delta_transmission:
+            pub->delta_transmission = value;
+            break;
         default:
             return false;
             break;
@@ -188,7 +194,7 @@ bool InterfaceInfo::setEndpointProperty(interface_handle /*id*/, int /*option*/,
     return false;
 }
 
-bool InterfaceInfo::getInputProperty(interface_handle id, int option) const
+int32_t InterfaceInfo::getInputProperty(interface_handle id, int option) const
 {
     auto ipt = getInput(id);
     if (ipt == nullptr) {
@@ -216,6 +222,9 @@ bool InterfaceInfo::getInputProperty(interface_handle id, int option) const
         case defs::options::strict_type_checking:
             return ipt->strict_type_matching;
             break;
+        case defs::options::multi_input_handling_method:
+            return ipt->multi_input_method;
+            break;
         default:
             return false;
             break;
@@ -247,6 +256,9 @@ bool InterfaceInfo::getPublicationProperty(interface_handle id, int option) cons
         case defs::options::buffer_data:
             return pub->buffer_data;
             break;
+        case defs::options::delta_transmission:
+            return pub->delta_transmission;
+            break;
         default:
             return false;
             break;
@@ -65,11 +65,11 @@ class InterfaceInfo {
     /** get the current value of the change update flag*/
     bool getChangeUpdateFlag() const { return only_update_on_change; }
     /** set a property on a specific interface*/
-    bool setInputProperty(interface_handle id, int option, bool value);
+    bool setInputProperty(interface_handle id, int option, int32_t value);
     bool setPublicationProperty(interface_handle id, int option, bool value);
     bool setEndpointProperty(interface_handle id, int option, bool value);
     /** get properties for an interface*/
-    bool getInputProperty(interface_handle id, int option) const;
+    int32_t getInputProperty(interface_handle id, int option) const;
     bool getPublicationProperty(interface_handle id, int option) const;
     bool getEndpointProperty(interface_handle id, int option) const;
 
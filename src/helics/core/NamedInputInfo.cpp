@@ -6,6 +6,10 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #include "NamedInputInfo.hpp"
 
+#include "../helics_enums.h"
+#include "DeltaEncoding.hpp"
+#include "InputAggregation.hpp"
+
 #include "units/units/units.hpp"
 
 #include <algorithm>
@@ -32,6 +36,9 @@ std::shared_ptr<const data_block> NamedInputInfo::getData(int index)
 
 std::shared_ptr<const data_block> NamedInputInfo::getData()
 {
+    if (multi_input_method != helics_multi_input_no_op) {
+        return aggregate;
+    }
     int ind = 0;
     int mxind = -1;
     Time mxTime = Time::minVal();
@@ -48,6 +55,61 @@ std::shared_ptr<const data_block> NamedInputInfo::getData()
     return nullptr;
 }
 
+static const std::string doubleTypeString{"double"};
+static const std::string vectorTypeString{"double_vector"};
+
+const std::string& NamedInputInfo::getInjectionType() const
+{
+    if (multi_input_method == helics_multi_input_no_op) {
+        return inputType;
+    }
+    return (hasVectorOutput()) ? vectorTypeString : doubleTypeString;
+}
+
+void NamedInputInfo::setMultiInputMethod(int32_t method)
+{
+    multi_input_method = isValidMultiInputMethod(method) ? method : helics_multi_input_no_op;
+    if (multi_input_method == helics_multi_input_no_op) {
+        source_values.clear();
+        aggregate.reset();
+        return;
+    }
+    source_values.assign(current_data.size(), std::vector<double>());
+    for (std::size_t ii = 0; ii < current_data.size(); ++ii) {
+        if (current_data[ii].data) {
+            if (!decodeNumericValue(
+                    std::get<1>(source_info[ii]), *current_data[ii].data, source_values[ii])) {
+                source_values[ii].clear();
+            }
+        }
+    }
+    updateAggregate();
+}
+
+bool NamedInputInfo::hasVectorOutput() const
+{
+    if (multi_input_method == helics_multi_input_vectorize_operation) {
+        return true;
+    }
+    for (const auto& info : source_info) {
+        if (isNumericVectorType(std::get<1>(info))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void NamedInputInfo::updateAggregate()
+{
+    std::vector<double> result;
+    aggregateNumericValues(multi_input_method, source_values, result);
+    if (result.empty() && multi_input_method != helics_multi_input_vectorize_operation) {
+        aggregate.reset();
+        return;
+    }
+    aggregate = std::make_shared<const data_block>(encodeNumericValue(result, hasVectorOutput()));
+}
+
 static auto recordComparison = [](const NamedInputInfo::dataRecord& rec1,
                                   const NamedInputInfo::dataRecord& rec2) {
     return (rec1.time < rec2.time) ?
@@ -55,24 +117,35 @@ static auto recordComparison = [](const NamedInputInfo::dataRecord& rec1,
         ((rec1.time == rec2.time) ? (rec1.iteration < rec2.iteration) : false);
 };
 
+int NamedInputInfo::getSourceIndex(global_handle source) const
+{
+    auto fnd = source_index.find(source);
+    return (fnd != source_index.end()) ? fnd->second : -1;
+}
+
 void NamedInputInfo::addData(
     global_handle source_id,
     Time valueTime,
     unsigned int iteration,
     std::shared_ptr<const data_block> data)
 {
-    int index;
-    bool found = false;
-    for (index = 0; index < static_cast<int>(input_sources.size()); ++index) {
-        if (input_sources[index] == source_id) {
-            if (valueTime > deactivated[index]) {
-                return;
-            }
-            found = true;
-            break;
-        }
+    auto index = getSourceIndex(source_id);
+    if (index < 0) {
+        return;
     }
-    if (!found) {
+    full_value_requested[index] = false;
+    addSourceData(index, valueTime, iteration, std::move(data));
+}
+
+void NamedInputInfo::addSourceData(
+    int index,
+    Time valueTime,
+    unsigned int iteration,
+    std::shared_ptr<const data_block> data)
+{
+    // the value is the base for the next delta even if it is not used
+    last_received[index] = data;
+    if (valueTime > deactivated[index]) {
         return;
     }
     if ((data_queues[index].empty()) || (valueTime > data_queues[index].back().time)) {
@@ -85,6 +158,36 @@ void NamedInputInfo::addData(
     }
 }
 
+bool NamedInputInfo::addDeltaData(
+    global_handle source_id,
+    Time valueTime,
+    unsigned int iteration,
+    const char* delta,
+    std::size_t len)
+{
+    auto index = getSourceIndex(source_id);
+    if (index < 0 || !last_received[index]) {
+        return false;
+    }
+    std::string value;
+    if (!applyValueDelta(last_received[index]->to_string(), delta, len, value)) {
+        return false;
+    }
+    addSourceData(
+        index, valueTime, iteration, std::make_shared<const data_block>(std::move(value)));
+    return true;
+}
+
+bool NamedInputInfo::requestFullValue(global_handle source_id)
+{
+    auto index = getSourceIndex(source_id);
+    if (index < 0 || full_value_requested[index]) {
+        return false;
+    }
+    full_value_requested[index] = true;
+    return true;
+}
+
 void NamedInputInfo::addSource(
     global_handle newSource,
     const std::string& sourceName,
@@ -95,24 +198,48 @@ void NamedInputInfo::addSource(
         inputType = stype;
         inputUnits = sunits;
     }
+    // the indices only record the first occurrence so duplicates behave like they did with a search
+    if (!source_index.emplace(newSource, static_cast<int>(input_sources.size())).second) {
+        duplicate_handles = true;
+    }
+    if (!source_name_index.emplace(sourceName, static_cast<int>(source_info.size())).second) {
+        duplicate_names = true;
+    }
     input_sources.push_back(newSource);
     source_info.emplace_back(sourceName, stype, sunits);
     data_queues.resize(input_sources.size());
     current_data.resize(input_sources.size());
+    last_received.resize(input_sources.size());
+    full_value_requested.resize(input_sources.size(), false);
+    if (multi_input_method != helics_multi_input_no_op) {
+        source_values.resize(input_sources.size());
+    }
     deactivated.push_back(Time::maxVal());
     has_target = true;
 }
 
+void NamedInputInfo::deactivateSource(int index, Time minTime)
+{
+    while ((!data_queues[index].empty()) && (data_queues[index].back().time > minTime)) {
+        data_queues[index].pop_back();
+    }
+    if (minTime < deactivated[index]) {
+        deactivated[index] = minTime;
+    }
+}
+
 void NamedInputInfo::removeSource(global_handle sourceToRemove, Time minTime)
 {
+    if (!duplicate_handles) {
+        auto index = getSourceIndex(sourceToRemove);
+        if (index >= 0) {
+            deactivateSource(index, minTime);
+        }
+        return;
+    }
     for (size_t ii = 0; ii < input_sources.size(); ++ii) {
         if (input_sources[ii] == sourceToRemove) {
-            while ((!data_queues[ii].empty()) && (data_queues[ii].back().time > minTime)) {
-                data_queues[ii].pop_back();
-            }
-            if (minTime < deactivated[ii]) {
-                deactivated[ii] = minTime;
-            }
+            deactivateSource(static_cast<int>(ii), minTime);
         }
         // there could be duplicate sources so we need to do the full loop
     }
@@ -120,19 +247,27 @@ void NamedInputInfo::removeSource(global_handle sourceToRemove, Time minTime)
 
 void NamedInputInfo::removeSource(const std::string& sourceName, Time minTime)
 {
+    if (!duplicate_names) {
+        auto fnd = source_name_index.find(sourceName);
+        if (fnd != source_name_index.end() && fnd->second < static_cast<int>(data_queues.size())) {
+            deactivateSource(fnd->second, minTime);
+        }
+        return;
+    }
     for (size_t ii = 0; ii < source_info.size(); ++ii) {
         if (std::get<0>(source_info[ii]) == sourceName) {
-            while ((!data_queues[ii].empty()) && (data_queues[ii].back().time > minTime)) {
-                data_queues[ii].pop_back();
-            }
-            if (minTime < deactivated[ii]) {
-                deactivated[ii] = minTime;
-            }
+            deactivateSource(static_cast<int>(ii), minTime);
         }
         // there could be duplicate sources so we need to do the full loop
     }
 }
 
+void NamedInputInfo::clearSources()
+{
+    input_sources.clear();
+    source_index.clear();
+}
+
 void NamedInputInfo::clearFutureData()
 {
     for (auto& vec : data_queues) {
@@ -142,17 +277,13 @@ void NamedInputInfo::clearFutureData()
 
 bool NamedInputInfo::updateTimeUpTo(Time newTime)
 {
-    int index = 0;
     bool updated = false;
-    for (auto& data_queue : data_queues) {
+    for (int index = 0; index < static_cast<int>(data_queues.size()); ++index) {
+        auto& data_queue = data_queues[index];
         auto currentValue = data_queue.begin();
-
         auto it_final = data_queue.end();
-        if (currentValue == it_final) {
-            return false;
-        }
-        if (currentValue->time > newTime) {
-            return false;
+        if (currentValue == it_final || currentValue->time > newTime) {
+            continue;
         }
         auto last = currentValue;
         ++currentValue;
@@ -163,26 +294,25 @@ bool NamedInputInfo::updateTimeUpTo(Time newTime)
 
         auto res = updateData(std::move(*last), index);
         data_queue.erase(data_queue.begin(), currentValue);
-        ++index;
         if (res) {
             updated = true;
         }
     }
+    if (updated && multi_input_method != helics_multi_input_no_op) {
+        updateAggregate();
+    }
     return updated;
 }
 
 bool NamedInputInfo::updateTimeNextIteration(Time newTime)
 {
-    int index = 0;
     bool updated = false;
-    for (auto& data_queue : data_queues) {
+    for (int index = 0; index < static_cast<int>(data_queues.size()); ++index) {
+        auto& data_queue = data_queues[index];
         auto currentValue = data_queue.begin();
         auto it_final = data_queue.end();
-        if (currentValue == it_final) {
-            return false;
-        }
-        if (currentValue->time > newTime) {
-            return false;
+        if (currentValue == it_final || currentValue->time > newTime) {
+            continue;
         }
         auto last = currentValue;
         ++currentValue;
@@ -203,26 +333,25 @@ bool NamedInputInfo::updateTimeNextIteration(Time newTime)
 
         auto res = updateData(std::move(*last), index);
         data_queue.erase(data_queue.begin(), currentValue);
-        ++index;
         if (res) {
             updated = true;
         }
     }
+    if (updated && multi_input_method != helics_multi_input_no_op) {
+        updateAggregate();
+    }
     return updated;
 }
 
 bool NamedInputInfo::updateTimeInclusive(Time newTime)
 {
-    int index = 0;
     bool updated = false;
-    for (auto& data_queue : data_queues) {
+    for (int index = 0; index < static_cast<int>(data_queues.size()); ++index) {
+        auto& data_queue = data_queues[index];
         auto currentValue = data_queue.begin();
         auto it_final = data_queue.end();
-        if (currentValue == it_final) {
-            return false;
-        }
-        if (currentValue->time > newTime) {
-            return false;
+        if (currentValue == it_final || currentValue->time > newTime) {
+            continue;
         }
         auto last = currentValue;
         ++currentValue;
@@ -233,23 +362,30 @@ bool NamedInputInfo::updateTimeInclusive(Time newTime)
 
         auto res = updateData(std::move(*last), index);
         data_queue.erase(data_queue.begin(), currentValue);
-        ++index;
         if (res) {
             updated = true;
         }
     }
+    if (updated && multi_input_method != helics_multi_input_no_op) {
+        updateAggregate();
+    }
     return updated;
 }
 
 bool NamedInputInfo::updateData(dataRecord&& update, int index)
 {
-    if (!only_update_on_change || !current_data[index].data) {
-        current_data[index] = std::move(update);
-        return true;
-    }
-
-    if (*current_data[index].data != *(update.data)) {
+    if (!only_update_on_change || !current_data[index].data ||
+        *current_data[index].data != *(update.data)) {
         current_data[index] = std::move(update);
+        if (multi_input_method != helics_multi_input_no_op) {
+            // only the source that changed needs to be decoded again
+            if (!decodeNumericValue(
+                    std::get<1>(source_info[index]),
+                    *current_data[index].data,
+                    source_values[index])) {
+                source_values[index].clear();
+            }
+        }
         return true;
     }
     if (current_data[index].time ==
@@ -8,7 +8,9 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "basic_core_types.hpp"
 
+#include <string>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 namespace helics {
@@ -65,6 +67,7 @@ class NamedInputInfo {
         false; //!< indicator that the handle need to have strict type matching
     bool single_source = false; //!< allow only a single source to connect
     bool ignore_unit_mismatch = false; //!< ignore unit mismatches
+    int32_t multi_input_method = 0; //!< the operation used to combine multiple sources
     std::vector<dataRecord> current_data; //!< the most recent published data
     std::vector<global_handle> input_sources; //!< the sources of the input signals
     std::vector<Time> deactivated;
@@ -72,20 +75,48 @@ class NamedInputInfo {
         source_info; //!< the name,type,units of the sources
   private:
     std::vector<std::vector<dataRecord>> data_queues; //!< queue of the data
+    std::vector<std::shared_ptr<const data_block>>
+        last_received; //!< the most recently received value from each source
+    std::vector<bool> full_value_requested; //!< indicator that a source was asked for a full value
+    std::vector<std::vector<double>>
+        source_values; //!< the decoded numerical values of the current data of each source
+    std::shared_ptr<const data_block> aggregate; //!< the combined value of all the sources
+    std::unordered_map<global_handle, int>
+        source_index; //!< the index of the first entry in input_sources for each source handle
+    std::unordered_map<std::string, int>
+        source_name_index; //!< the index of the first entry in source_info for each source name
+    bool duplicate_handles{false}; //!< indicator that a handle is used by more than one source
+    bool duplicate_names{false}; //!< indicator that a name is used by more than one source
 
   public:
     /** get all the current data*/
     std::vector<std::shared_ptr<const data_block>> getAllData();
     /** get a particular data input*/
     std::shared_ptr<const data_block> getData(int index);
-    /** get a the most recent data point*/
+    /** get a the most recent data point or the combined value if a multi input method is set*/
     std::shared_ptr<const data_block> getData();
+    /** get the type of the data returned by getData()*/
+    const std::string& getInjectionType() const;
+    /** set the operation used to combine the values of multiple sources see /ref helics_multi_input_mode
+    @details an unsupported value is treated as helics_multi_input_no_op*/
+    void setMultiInputMethod(int32_t method);
     /** add a data block into the queue*/
     void addData(
         global_handle source_id,
         Time valueTime,
         unsigned int iteration,
         std::shared_ptr<const data_block> data);
+    /** add a data block containing only the changes from the previous value of the same source
+    @return false if the delta could not be applied to the previous value*/
+    bool addDeltaData(
+        global_handle source_id,
+        Time valueTime,
+        unsigned int iteration,
+        const char* delta,
+        std::size_t len);
+    /** record that a full value is needed from a source whose delta could not be applied
+    @return true if a full value has not been requested from the source since its last full value*/
+    bool requestFullValue(global_handle source_id);
 
     /** update current data not including data at the specified time
     @param newTime the time to move the subscription to
@@ -111,15 +142,32 @@ class NamedInputInfo {
         const std::string& sourceName,
         const std::string& stype,
         const std::string& sunits);
+    /** get the index of a source in input_sources
+    @return the index of the first entry for the source or -1 if the handle is not a source of the input*/
+    int getSourceIndex(global_handle source) const;
     /** remove a source */
     void removeSource(global_handle sourceToRemove, Time minTime);
     /** remove a source */
     void removeSource(const std::string& sourceName, Time minTime);
     /** clear all non-current data*/
     void clearFutureData();
+    /** disconnect all the sources of the input*/
+    void clearSources();
 
   private:
     bool updateData(dataRecord&& update, int index);
+    /** add a data block to the queue of a source given by its index*/
+    void addSourceData(
+        int index,
+        Time valueTime,
+        unsigned int iteration,
+        std::shared_ptr<const data_block> data);
+    /** mark the data from a source past a specific time as invalid*/
+    void deactivateSource(int index, Time minTime);
+    /** check if the combined value is a vector*/
+    bool hasVectorOutput() const;
+    /** recompute the combined value from the current values of the sources*/
+    void updateAggregate();
 };
 
 bool checkTypeMatch(const std::string& type1, const std::string& type2, bool strict_match);
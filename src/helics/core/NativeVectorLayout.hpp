@@ -0,0 +1,104 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace helics {
+/** definitions for the binary layout of numeric vectors
+
+the layout is an 8 byte header followed by the elements in the byte order of the sender,  so a receiver with the
+same byte order can use the elements directly from the buffer without copying them.  The header is
+ - [0] the layout code 'V',  the portable binary archive starts with 0 or 1 so the layouts can be told apart
+ - [1] the byte order of the sender,  1 for little endian and 0 for big endian
+ - [2] the size of an element in bytes
+ - [3] unused
+ - [4-7] the number of elements as a uint32 in the byte order of the sender
+*/
+namespace native_vector {
+    /** the code in the first byte of a value in the layout*/
+    constexpr char layoutCode{'V'};
+    /** the size of the header before the first element*/
+    constexpr std::size_t headerSize{8};
+
+    /** get the byte order indicator of this machine*/
+    inline char localByteOrder()
+    {
+        const std::uint16_t test{1};
+        char first{0};
+        std::memcpy(&first, &test, 1);
+        return first;
+    }
+
+    /** write the header for a vector
+    @param data the buffer to write into,  must be at least headerSize bytes
+    @param count the number of elements
+    @param elementSize the size of each element in bytes
+    @throw std::invalid_argument if the count does not fit in the header
+    */
+    inline void writeHeader(char* data, std::size_t count, std::size_t elementSize)
+    {
+        if (count > (std::numeric_limits<std::uint32_t>::max)()) {
+            throw std::invalid_argument("too many elements for the native vector layout");
+        }
+        auto cnt = static_cast<std::uint32_t>(count);
+        data[0] = layoutCode;
+        data[1] = localByteOrder();
+        data[2] = static_cast<char>(elementSize);
+        data[3] = 0;
+        std::memcpy(data + 4, &cnt, sizeof(std::uint32_t));
+    }
+
+    /** read the header of a value in the native vector layout
+    @param data the serialized value
+    @param size the size of the serialized value
+    @param elementSize the expected size of each element in bytes
+    @param[out] count the number of elements
+    @param[out] swap true if the elements are in the opposite byte order to this machine
+    @return false if the value is not in the layout or does not match the element size
+    */
+    inline bool readHeader(
+        const char* data,
+        std::size_t size,
+        std::size_t elementSize,
+        std::size_t& count,
+        bool& swap)
+    {
+        if (size < headerSize || data[0] != layoutCode ||
+            static_cast<std::size_t>(static_cast<unsigned char>(data[2])) != elementSize) {
+            return false;
+        }
+        swap = (data[1] != localByteOrder());
+        char cbytes[sizeof(std::uint32_t)];
+        std::memcpy(cbytes, data + 4, sizeof(std::uint32_t));
+        if (swap) {
+            std::reverse(cbytes, cbytes + sizeof(std::uint32_t));
+        }
+        std::uint32_t cnt{0};
+        std::memcpy(&cnt, cbytes, sizeof(std::uint32_t));
+        count = cnt;
+        return (size - headerSize == count * elementSize);
+    }
+
+    /** copy elements composed of doubles from a buffer in the opposite byte order
+    @param dest the destination for the elements
+    @param source the serialized elements
+    @param bytes the number of bytes to copy,  must be a multiple of 8*/
+    inline void copySwapped(void* dest, const char* source, std::size_t bytes)
+    {
+        auto* out = static_cast<char*>(dest);
+        for (std::size_t ii = 0; ii < bytes; ii += sizeof(double)) {
+            std::reverse_copy(source + ii, source + ii + sizeof(double), out + ii);
+        }
+    }
+} // namespace native_vector
+} // namespace helics
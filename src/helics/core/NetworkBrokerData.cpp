@@ -84,6 +84,21 @@ std::shared_ptr<helicsCLI11App>
         ->check(CLI::PositiveNumber);
     nbparser->add_option("--networkretries", maxRetries, "the maximum number of network retries")
         ->capture_default_str();
+    nbparser
+        ->add_option(
+            "--maxbatch,--max_batch_size",
+            maxBatchSize,
+            "the maximum number of messages to the same destination combined in a single network send "
+            "(1 disables batching, max 255)")
+        ->capture_default_str()
+        ->check(CLI::Range(1, 255));
+    nbparser
+        ->add_option(
+            "--batchlinger,--batch_linger",
+            batchLinger,
+            "the maximum time in milliseconds to wait for additional messages to fill a batch")
+        ->capture_default_str()
+        ->check(CLI::NonNegativeNumber);
     nbparser->add_flag(
         "--osport,--use_os_port",
         use_os_port,
@@ -52,6 +52,8 @@ class NetworkBrokerData {
     int maxMessageSize{16 * 256}; //!< maximum message size
     int maxMessageCount{256}; //!< maximum message count
     int maxRetries{5}; //!< the maximum number of retries to establish a network connection
+    int maxBatchSize{1}; //!< the maximum number of messages to combine in a single network send
+    int batchLinger{0}; //!< the time in milliseconds to wait for more messages to fill a batch
     interface_networks interfaceNetwork{interface_networks::local};
     bool reuse_address{false}; //!< allow reuse of binding address
     bool use_os_port{
@@ -6,7 +6,10 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #include "PublicationInfo.hpp"
 
+#include "DeltaEncoding.hpp"
 #include "helics/external/string_view.hpp"
+
+#include <algorithm>
 namespace helics {
 bool PublicationInfo::CheckSetValue(const char* dataToCheck, uint64_t len)
 {
@@ -17,6 +20,17 @@ bool PublicationInfo::CheckSetValue(const char* dataToCheck, uint64_t len)
     return false;
 }
 
+bool PublicationInfo::generateDelta(const char* dataToSend, uint64_t len, std::string& delta)
+{
+    bool useDelta{false};
+    if (deltaCount < deltaSnapshotInterval) {
+        useDelta = encodeValueDelta(lastTransmission, dataToSend, static_cast<std::size_t>(len), delta);
+    }
+    deltaCount = (useDelta) ? deltaCount + 1 : 0;
+    lastTransmission.assign(dataToSend, len);
+    return useDelta;
+}
+
 void PublicationInfo::removeSubscriber(global_handle subscriberToRemove)
 {
     subscribers.erase(
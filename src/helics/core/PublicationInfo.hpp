@@ -38,8 +38,18 @@ class PublicationInfo {
     bool buffer_data = false;
     bool single_destination =
         false; //!< indicator that the publication should only have a single destination
+    bool delta_transmission =
+        false; //!< indicator that changes should be sent as a delta from the last transmission
+    std::string lastTransmission; //!< the last value transmitted used as the base for a delta
+    int deltaCount{0}; //!< the number of deltas sent since the last full value
+    /** the maximum number of deltas sent between full values*/
+    static constexpr int deltaSnapshotInterval{100};
     /** check the value if it is the same as the most recent data and if changed, store it*/
     bool CheckSetValue(const char* checkData, uint64_t len);
+    /** generate a delta for a value against the last transmitted value and record the value as transmitted
+    @details a full value is sent the first time, after a subscriber is added, and periodically
+    @return true if delta contains the changes to transmit, false if the full value should be transmitted*/
+    bool generateDelta(const char* dataToSend, uint64_t len, std::string& delta);
     /** remove a subscriber*/
     void removeSubscriber(global_handle subscriberToRemove);
 };
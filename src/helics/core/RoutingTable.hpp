@@ -0,0 +1,140 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "global_federate_id.hpp"
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+namespace helics {
+/** table of the routes to take to reach federates and brokers
+@details global federate and broker ids are handed out sequentially by the root broker so the routes are stored in
+vectors indexed directly by the id,  ids that do not fit in the vectors go into a map*/
+class RoutingTable {
+  private:
+    std::vector<route_id> federateRoutes; //!< routes indexed by the local index of a federate id
+    std::vector<route_id> brokerRoutes; //!< routes indexed by the local index of a broker id
+    std::unordered_map<global_federate_id, route_id> sparseRoutes; //!< routes for all other ids
+    std::size_t count{0}; //!< the number of routes in the table
+
+  public:
+    /** the largest index stored directly,  limiting the size of the vectors for ids from outside the normal range*/
+    static constexpr global_federate_id::base_type maxDirectIndex{1 << 18};
+
+    /** add a route for an id if there is not already one
+    @return true if the route was added*/
+    bool emplace(global_federate_id id, route_id route)
+    {
+        auto* slot = directSlot(id, true);
+        if (slot == nullptr) {
+            bool added = sparseRoutes.emplace(id, route).second;
+            count += added ? 1 : 0;
+            return added;
+        }
+        if (slot->isValid()) {
+            return false;
+        }
+        *slot = route;
+        ++count;
+        return true;
+    }
+    /** add or replace the route for an id*/
+    void set(global_federate_id id, route_id route)
+    {
+        if (!emplace(id, route)) {
+            auto* slot = directSlot(id, false);
+            if (slot != nullptr) {
+                *slot = route;
+            } else {
+                sparseRoutes[id] = route;
+            }
+        }
+    }
+    /** get the route for an id
+    @param id the global id of a federate or broker
+    @param defaultRoute the route to return if there is no route for the id
+    */
+    route_id find(global_federate_id id, route_id defaultRoute) const
+    {
+        if (id.isFederate()) {
+            auto index = static_cast<std::size_t>(id.localIndex());
+            if (index < federateRoutes.size() && federateRoutes[index].isValid()) {
+                return federateRoutes[index];
+            }
+        } else if (id.isBroker()) {
+            auto index = static_cast<std::size_t>(global_broker_id(id).localIndex());
+            if (index < brokerRoutes.size() && brokerRoutes[index].isValid()) {
+                return brokerRoutes[index];
+            }
+        }
+        if (sparseRoutes.empty()) {
+            return defaultRoute;
+        }
+        auto fnd = sparseRoutes.find(id);
+        return (fnd != sparseRoutes.end()) ? fnd->second : defaultRoute;
+    }
+    /** check if there is a route for an id*/
+    bool contains(global_federate_id id) const { return find(id, route_id{}).isValid(); }
+    /** remove the route for an id*/
+    void erase(global_federate_id id)
+    {
+        auto* slot = directSlot(id, false);
+        if (slot != nullptr) {
+            if (slot->isValid()) {
+                *slot = route_id{};
+                --count;
+            }
+        } else {
+            count -= sparseRoutes.erase(id);
+        }
+    }
+    /** get the number of routes in the table*/
+    std::size_t size() const { return count; }
+    /** check if the table has no routes*/
+    bool empty() const { return count == 0; }
+    /** remove all the routes*/
+    void clear()
+    {
+        federateRoutes.clear();
+        brokerRoutes.clear();
+        sparseRoutes.clear();
+        count = 0;
+    }
+
+  private:
+    /** get the vector slot for an id
+    @param id the id to get the slot for
+    @param grow set to true to extend the vector to include the slot if needed
+    @return a pointer to the slot or nullptr if the id is not stored directly*/
+    route_id* directSlot(global_federate_id id, bool grow)
+    {
+        std::vector<route_id>* routes{nullptr};
+        global_federate_id::base_type index{-1};
+        if (id.isFederate()) {
+            routes = &federateRoutes;
+            index = id.localIndex();
+        } else if (id.isBroker()) {
+            routes = &brokerRoutes;
+            index = global_broker_id(id).localIndex();
+        }
+        if (routes == nullptr || index < 0 || index >= maxDirectIndex) {
+            return nullptr;
+        }
+        auto uindex = static_cast<std::size_t>(index);
+        if (uindex >= routes->size()) {
+            if (!grow) {
+                return nullptr;
+            }
+            routes->resize(uindex + 1);
+        }
+        return &(*routes)[uindex];
+    }
+};
+
+} // namespace helics
@@ -295,22 +295,29 @@ bool TimeCoordinator::updateTimeFactors()
     Time minNext = Time::maxVal();
     Time minminDe = std::min(time_value, time_message);
     Time minDe = minminDe;
-    for (auto& dep : dependencies) {
-        if (dep.Tnext < minNext) {
-            minNext = dep.Tnext;
-        }
-        if (dep.Tdemin >= dep.Tnext) {
-            if (dep.Tdemin < minminDe) {
-                minminDe = dep.Tdemin;
+    auto summary = dependencies.getTimeSummary();
+    if (summary.invalidDemin == 0) {
+        minNext = summary.minNext;
+        minminDe = std::min(minminDe, summary.minminDe);
+        minDe = std::min(minDe, summary.minDe);
+    } else {
+        for (auto& dep : dependencies) {
+            if (dep.Tnext < minNext) {
+                minNext = dep.Tnext;
+            }
+            if (dep.Tdemin >= dep.Tnext) {
+                if (dep.Tdemin < minminDe) {
+                    minminDe = dep.Tdemin;
+                }
+            } else {
+                // this minimum dependent event time received was invalid and can't be trusted
+                // therefore it can't be used to determine a time grant
+                minminDe = -1;
             }
-        } else {
-            // this minimum dependent event time received was invalid and can't be trusted
-            // therefore it can't be used to determine a time grant
-            minminDe = -1;
-        }
 
-        if (dep.Te < minDe) {
-            minDe = dep.Te;
+            if (dep.Te < minDe) {
+                minDe = dep.Te;
+            }
         }
     }
 
@@ -501,7 +508,7 @@ void TimeCoordinator::removeDependent(global_federate_id fedID)
     }
 }
 
-DependencyInfo* TimeCoordinator::getDependencyInfo(global_federate_id ofed)
+const DependencyInfo* TimeCoordinator::getDependencyInfo(global_federate_id ofed) const
 {
     return dependencies.getDependencyInfo(ofed);
 }
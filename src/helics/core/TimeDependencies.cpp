@@ -105,6 +105,56 @@ bool DependencyInfo::ProcessMessage(const ActionMessage& m)
     return true;
 }
 
+/** generate the time summary of a single dependency*/
+static DependencyTimeSummary makeSummary(const DependencyInfo& dep)
+{
+    DependencyTimeSummary summary;
+    summary.minNext = dep.Tnext;
+    summary.tState = dep.time_state;
+    summary.minDe = dep.Te;
+    if (dep.Tdemin >= dep.Tnext) {
+        summary.minminDe = dep.Tdemin;
+        summary.minFed = dep.fedID;
+    } else {
+        summary.invalidDemin = 1;
+    }
+    return summary;
+}
+
+/** combine the summaries of two sets of dependencies
+@details the dependencies summarized in first come before those in second*/
+static DependencyTimeSummary
+    combineSummary(const DependencyTimeSummary& first, const DependencyTimeSummary& second)
+{
+    DependencyTimeSummary summary;
+    if (first.minNext < second.minNext) {
+        summary.minNext = first.minNext;
+        summary.tState = first.tState;
+    } else if (second.minNext < first.minNext) {
+        summary.minNext = second.minNext;
+        summary.tState = second.tState;
+    } else {
+        summary.minNext = first.minNext;
+        summary.tState = (second.tState == DependencyInfo::time_state_t::time_granted) ?
+            second.tState :
+            first.tState;
+    }
+    if (first.minminDe < second.minminDe) {
+        summary.minminDe = first.minminDe;
+        summary.minFed = first.minFed;
+    } else if (second.minminDe < first.minminDe) {
+        summary.minminDe = second.minminDe;
+        summary.minFed = second.minFed;
+    } else {
+        // the minimum is shared so there is no single federate
+        summary.minminDe = first.minminDe;
+        summary.minFed = global_federate_id();
+    }
+    summary.minDe = (std::min)(first.minDe, second.minDe);
+    summary.invalidDemin = first.invalidDemin + second.invalidDemin;
+    return summary;
+}
+
 // comparison helper lambda for comparing dependencies
 static auto dependencyCompare = [](const auto& dep, auto& target) { return (dep.fedID < target); };
 
@@ -127,14 +177,45 @@ const DependencyInfo* TimeDependencies::getDependencyInfo(global_federate_id id)
     return &(*res);
 }
 
-DependencyInfo* TimeDependencies::getDependencyInfo(global_federate_id id)
+DependencyTimeSummary TimeDependencies::getTimeSummary() const
 {
-    auto res = std::lower_bound(dependencies.begin(), dependencies.end(), id, dependencyCompare);
-    if ((res == dependencies.end()) || (res->fedID != id)) {
-        return nullptr;
+    // the empty summary acts as the starting point of a search through the dependencies
+    DependencyTimeSummary start;
+    if (summaryTree.empty()) {
+        return start;
     }
+    return combineSummary(start, summaryTree[1]);
+}
 
-    return &(*res);
+void TimeDependencies::rebuildSummary()
+{
+    if (dependencies.empty()) {
+        summaryTree.clear();
+        leafOffset = 0;
+        return;
+    }
+    leafOffset = 1;
+    while (leafOffset < dependencies.size()) {
+        leafOffset <<= 1U;
+    }
+    summaryTree.assign(2 * leafOffset, DependencyTimeSummary());
+    for (std::size_t ii = 0; ii < dependencies.size(); ++ii) {
+        summaryTree[leafOffset + ii] = makeSummary(dependencies[ii]);
+    }
+    for (std::size_t ii = leafOffset - 1; ii > 0; --ii) {
+        summaryTree[ii] = combineSummary(summaryTree[2 * ii], summaryTree[2 * ii + 1]);
+    }
+}
+
+void TimeDependencies::updateSummary(std::size_t index)
+{
+    auto loc = leafOffset + index;
+    summaryTree[loc] = makeSummary(dependencies[index]);
+    loc >>= 1U;
+    while (loc > 0) {
+        summaryTree[loc] = combineSummary(summaryTree[2 * loc], summaryTree[2 * loc + 1]);
+        loc >>= 1U;
+    }
 }
 
 bool TimeDependencies::addDependency(global_federate_id id)
@@ -142,6 +223,7 @@ bool TimeDependencies::addDependency(global_federate_id id)
 {
     if (dependencies.empty()) {
         dependencies.emplace_back(id);
+        rebuildSummary();
         return true;
     }
     auto dep = std::lower_bound(dependencies.begin(), dependencies.end(), id, dependencyCompare);
@@ -154,6 +236,7 @@ bool TimeDependencies::addDependency(global_federate_id id)
         }
         dependencies.emplace(dep, id);
     }
+    rebuildSummary();
     return true;
 }
 
@@ -163,6 +246,7 @@ void TimeDependencies::removeDependency(global_federate_id id)
     if (dep != dependencies.end()) {
         if (dep->fedID == id) {
             dependencies.erase(dep);
+            rebuildSummary();
         }
     }
 }
@@ -171,11 +255,14 @@ bool TimeDependencies::updateTime(const ActionMessage& m)
 {
     auto dependency_id = (m.action() != CMD_SEND_MESSAGE) ? m.source_id : m.dest_id;
 
-    auto depInfo = getDependencyInfo(global_federate_id(dependency_id));
-    if (depInfo == nullptr) {
+    global_federate_id depId(dependency_id);
+    auto dep = std::lower_bound(dependencies.begin(), dependencies.end(), depId, dependencyCompare);
+    if ((dep == dependencies.end()) || (dep->fedID != depId)) {
         return false;
     }
-    return depInfo->ProcessMessage(m);
+    auto res = dep->ProcessMessage(m);
+    updateSummary(static_cast<std::size_t>(dep - dependencies.begin()));
+    return res;
 }
 
 bool TimeDependencies::checkIfReadyForExecEntry(bool iterating) const
@@ -204,33 +291,20 @@ void TimeDependencies::resetIteratingExecRequests()
             dep.time_state = DependencyInfo::time_state_t::initialized;
         }
     }
+    rebuildSummary();
 }
 
-bool TimeDependencies::checkIfReadyForTimeGrant(bool iterating, Time desiredGrantTime) const
+bool TimeDependencies::checkIfReadyForTimeGrant(bool /*iterating*/, Time desiredGrantTime) const
 {
-    if (iterating) {
-        for (auto& dep : dependencies) {
-            if (dep.Tnext < desiredGrantTime) {
-                return false;
-            }
-            if ((dep.Tnext == desiredGrantTime) &&
-                (dep.time_state == DependencyInfo::time_state_t::time_granted)) {
-                return false;
-            }
-        }
-    } else {
-        for (auto& dep : dependencies) {
-            if (dep.Tnext < desiredGrantTime) {
-                return false;
-            }
-            if (dep.Tnext == desiredGrantTime) {
-                if (dep.time_state == DependencyInfo::time_state_t::time_granted) {
-                    return false;
-                }
-            }
-        }
+    // not ready if a dependency could still send something before the desired time or has
+    // been granted that time,  the summary tracks if any dependency at the minimum is granted
+    auto summary = getTimeSummary();
+    if (summary.minNext < desiredGrantTime) {
+        return false;
     }
-    return true;
+    return !(
+        (summary.minNext == desiredGrantTime) &&
+        (summary.tState == DependencyInfo::time_state_t::time_granted));
 }
 
 void TimeDependencies::resetIteratingTimeRequests(helics::Time requestTime)
@@ -244,6 +318,7 @@ void TimeDependencies::resetIteratingTimeRequests(helics::Time requestTime)
             }
         }
     }
+    rebuildSummary();
 }
 
 void TimeDependencies::resetDependentEvents(helics::Time grantTime)
@@ -252,6 +327,7 @@ void TimeDependencies::resetDependentEvents(helics::Time grantTime)
         dep.Te = (std::max)(dep.Tnext, grantTime);
         dep.Tdemin = dep.Te;
     }
+    rebuildSummary();
 }
 
 } // namespace helics
@@ -47,10 +47,28 @@ class DependencyInfo {
     bool ProcessMessage(const ActionMessage& m);
 };
 
-/** class for managing a set of dependencies*/
+/** summary of the minimum times of a set of dependencies*/
+class DependencyTimeSummary {
+  public:
+    Time minNext{Time::maxVal()}; //!< the minimum Tnext of the dependencies
+    Time minDe{Time::maxVal()}; //!< the minimum Te of the dependencies
+    Time minminDe{Time::maxVal()}; //!< the minimum Tdemin of the dependencies with Tdemin>=Tnext
+    global_federate_id minFed{}; //!< the dependency with minminDe if it is the only one
+    int32_t invalidDemin{0}; //!< the number of dependencies with a Tdemin less than Tnext
+    /** the state of the first dependency with Tnext==minNext or time_granted if any of them are
+    granted*/
+    DependencyInfo::time_state_t tState{DependencyInfo::time_state_t::time_requested};
+};
+
+/** class for managing a set of dependencies
+@details the minimum times of the dependencies are tracked incrementally in a tournament tree so the grant
+checks do not need to scan all the dependencies on every timing message*/
 class TimeDependencies {
   private:
     std::vector<DependencyInfo> dependencies; //!< container
+    std::vector<DependencyTimeSummary>
+        summaryTree; //!< tournament tree of the time summaries of the dependencies
+    std::size_t leafOffset{0}; //!< the location of the first leaf in the summaryTree
   public:
     /** default constructor*/
     TimeDependencies() = default;
@@ -66,10 +84,6 @@ class TimeDependencies {
     bool updateTime(const ActionMessage& m);
     /** get the number of dependencies*/
     auto size() const { return dependencies.size(); }
-    /** iterator to first dependency*/
-    auto begin() { return dependencies.begin(); }
-    /** iterator to end point*/
-    auto end() { return dependencies.end(); }
     /**  const iterator to first dependency*/
     auto begin() const { return dependencies.cbegin(); }
     /** const iterator to end point*/
@@ -79,11 +93,12 @@ class TimeDependencies {
     /**  const iterator to first dependency*/
     auto cend() const { return dependencies.cend(); }
 
-    /** get a pointer to the dependency information for a particular object*/
+    /** get a pointer to the dependency information for a particular object
+    @details the information can only be modified through the update functions so the summary is kept
+    current*/
     const DependencyInfo* getDependencyInfo(global_federate_id id) const;
-
-    /** get a pointer to the dependency information for a particular object*/
-    DependencyInfo* getDependencyInfo(global_federate_id id);
+    /** get the summary of the minimum times of all the dependencies*/
+    DependencyTimeSummary getTimeSummary() const;
 
     /** check if the dependencies would allow entry to exec mode*/
     bool checkIfReadyForExecEntry(bool iterating) const;
@@ -102,5 +117,11 @@ class TimeDependencies {
     void resetDependentEvents(Time grantTime);
     /** check if there are active dependencies*/
     bool hasActiveTimeDependencies() const;
+
+  private:
+    /** rebuild the summary tree after dependencies were added or removed or modified in bulk*/
+    void rebuildSummary();
+    /** update the summary tree after a single dependency was modified*/
+    void updateSummary(std::size_t index);
 };
 } // namespace helics
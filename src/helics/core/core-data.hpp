@@ -140,6 +140,49 @@ inline bool operator!=(const data_block& db1, const data_block& db2)
     return !(db1 == db2);
 }
 
+/** immutable reference counted data buffer
+@details a sibling of data_block used when the same data is delivered to many destinations, copies of a
+shared_data_block share the underlying data so a fan-out to local subscribers does not copy the payload,
+the data is only copied into a byte stream when a message crosses a communication boundary
+*/
+class shared_data_block {
+  private:
+    std::shared_ptr<const data_block> m_block; //!< the shared data
+  public:
+    /** default constructor */
+    shared_data_block() = default;
+    /** construct from an existing shared data_block*/
+    // NOLINTNEXTLINE
+    /* implicit */ shared_data_block(std::shared_ptr<const data_block> block) noexcept:
+        m_block(std::move(block))
+    {
+    }
+    /** char * and length, the data is copied once into the shared buffer*/
+    shared_data_block(const char* s, size_t len):
+        m_block(std::make_shared<const data_block>(s, len))
+    {
+    }
+    /** move from string*/
+    explicit shared_data_block(std::string&& str):
+        m_block(std::make_shared<const data_block>(std::move(str)))
+    {
+    }
+    /** return a pointer to the data or nullptr if there is no data*/
+    const char* data() const { return (m_block) ? m_block->data() : nullptr; }
+    /** get the size of the data*/
+    size_t size() const { return (m_block) ? m_block->size() : 0; }
+    /** check if the block is empty*/
+    bool empty() const noexcept { return (!m_block) || m_block->empty(); }
+    /** check if the object is holding a buffer at all*/
+    bool isValid() const noexcept { return static_cast<bool>(m_block); }
+    /** get the number of objects sharing the data*/
+    long use_count() const noexcept { return m_block.use_count(); }
+    /** release the shared data*/
+    void reset() noexcept { m_block.reset(); }
+    /** get the underlying shared pointer to the data*/
+    const std::shared_ptr<const data_block>& share() const noexcept { return m_block; }
+};
+
 /** class containing a message structure*/
 class Message {
   public:
@@ -152,6 +195,8 @@ class Message {
     std::string source; //!< the most recent source of the message
     std::string original_source; //!< the original source of the message
     std::string original_dest; //!< the original destination of a message
+    std::int32_t counter{0}; //!< extra index for user object usage, not used by HELICS
+    void* backReference{nullptr}; //!< extra pointer for user object usage, not used by HELICS
   public:
     /** default constructor*/
     Message() = default;
@@ -49,6 +49,7 @@ enum class core_type : int {
     HTTP = helics_core_type_http, //!< core/broker using web traffic
     WEBSOCKET = helics_core_type_websocket, //!< core/broker using web sockets
     INPROC = helics_core_type_inproc, //!< core/broker using a stripped down in process core type
+    SHM = helics_core_type_shm, //!< core/broker using lock free rings in shared memory
     UNRECOGNIZED = 22, //!< unknown
 
 };
@@ -44,6 +44,8 @@ namespace core {
                 return "inproc_";
             case core_type::WEBSOCKET:
                 return "websocket_";
+            case core_type::SHM:
+                return "shm_";
             default:
                 return std::string();
         }
@@ -95,6 +97,10 @@ namespace core {
         {"web", core_type::WEBSOCKET},
         {"inproc", core_type::INPROC},
         {"nng", core_type::NNG},
+        {"shm", core_type::SHM},
+        {"SHM", core_type::SHM},
+        {"shared_memory", core_type::SHM},
+        {"sharedmemory", core_type::SHM},
         {"http", core_type::HTTP},
         {"HTTP", core_type::HTTP},
         {"web", core_type::HTTP},
@@ -150,6 +156,9 @@ namespace core {
         if (type.compare(0, 3, "web") == 0) {
             return core_type::WEBSOCKET;
         }
+        if (type.compare(0, 3, "shm") == 0) {
+            return core_type::SHM;
+        }
         return core_type::UNRECOGNIZED;
     }
 
@@ -183,6 +192,12 @@ namespace core {
 #    define IPC_AVAILABILITY true
 #endif
 
+#ifndef ENABLE_SHM_CORE
+#    define SHM_AVAILABILITY false
+#else
+#    define SHM_AVAILABILITY true
+#endif
+
 #ifndef ENABLE_TEST_CORE
 #    define TEST_AVAILABILITY false
 #else
@@ -214,6 +229,9 @@ namespace core {
             case core_type::IPC:
                 available = IPC_AVAILABILITY;
                 break;
+            case core_type::SHM:
+                available = SHM_AVAILABILITY;
+                break;
             case core_type::UDP:
                 available = UDP_AVAILABILITY;
                 break;
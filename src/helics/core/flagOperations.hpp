@@ -34,6 +34,9 @@ enum operation_flags : uint16_t {
 constexpr uint16_t slow_responding_flag =
     14; //overload of extra_flag4 indicating a federate, core or broker is slow responding
 
+constexpr uint16_t delta_value_flag =
+    7; //overload of extra_flag1 indicating a value only carries the changes from the previous value
+
 /** template function to set a flag in an object containing a flags field
 @tparam FlagContainer an object with a .flags field
 @tparam FlagIndex a type that can be used as part of a shift to index into a flag object
@@ -116,7 +116,9 @@ namespace defs {
         buffer_data = helics_handle_option_buffer_data,
         ignore_interrupts = helics_handle_option_ignore_interrupts,
         strict_type_checking = helics_handle_option_strict_type_checking,
-        ignore_unit_mismatch = helics_handle_option_ignore_unit_mismatch
+        ignore_unit_mismatch = helics_handle_option_ignore_unit_mismatch,
+        delta_transmission = helics_handle_option_delta_transmission,
+        multi_input_handling_method = helics_handle_option_multi_input_handling_method
     };
 
 } // namespace defs
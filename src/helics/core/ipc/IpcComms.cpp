@@ -199,13 +199,15 @@ namespace ipc {
             }
         }
 
+        // large payloads are split into chunks that fit in the message queues
+        maxChunkSize = static_cast<std::size_t>((std::max)(maxMessageSize - 128, 64));
         setTxStatus(connection_status::connected);
         bool IPCoperating = false;
         bool continueLoop{true};
         while (continueLoop) {
             route_id rid;
             ActionMessage cmd;
-            std::tie(rid, cmd) = txQueue.pop();
+            std::tie(rid, cmd) = getNextTransmission();
             if (isProtocolCommand(cmd)) {
                 if (rid == control_route) {
                     switch (cmd.messageID) {
@@ -233,7 +235,6 @@ namespace ipc {
                     rxQueue.sendMessage(op, 3);
                 }
             }
-            std::string buffer = cmd.to_string();
             int priority = isPriorityCommand(cmd) ? 3 : 1;
             if (rid == parent_route_id) {
                 if (hasBroker) {
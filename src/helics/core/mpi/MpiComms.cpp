@@ -108,7 +108,7 @@ namespace mpi {
             route_id rid;
             ActionMessage cmd;
 
-            std::tie(rid, cmd) = txQueue.pop();
+            std::tie(rid, cmd) = getNextTransmission();
             bool processed = false;
             if (isProtocolCommand(cmd)) {
                 if (control_route == rid) {
@@ -142,7 +142,7 @@ namespace mpi {
                 if (hasBroker) {
                     // Send using MPI to broker
                     // std::cout << "send msg to brkr rt: " << prettyPrintString(cmd) << std::endl;
-                    mpi_service.sendMessage(brokerLocation, cmd.to_vector());
+                    mpi_service.sendMessage(brokerLocation, cmd);
                 }
             } else if (rid == control_route) { // send to rx thread loop
                 // Send to ourself -- may need command line option to enable for openmpi
@@ -153,12 +153,12 @@ namespace mpi {
                 if (rt_find != routes.end()) {
                     // Send using MPI to rank given by route
                     // std::cout << "send msg to rt: " << prettyPrintString(cmd) << std::endl;
-                    mpi_service.sendMessage(rt_find->second, cmd.to_vector());
+                    mpi_service.sendMessage(rt_find->second, cmd);
                 } else {
                     if (hasBroker) {
                         // Send using MPI to broker
                         // std::cout << "send msg to brkr: " << prettyPrintString(cmd) << std::endl;
-                        mpi_service.sendMessage(brokerLocation, cmd.to_vector());
+                        mpi_service.sendMessage(brokerLocation, cmd);
                     } else {
                         if (!isDisconnectCommand(cmd)) {
                             logWarning(fmt::format(
@@ -246,7 +246,7 @@ namespace mpi {
 
                     // Add to the received message queue for the MpiComms object
                     if (comms[i] != nullptr) {
-                        comms[i]->getRxMessageQueue().push(M);
+                        comms[i]->getRxMessageQueue().push(std::move(M));
                     }
                 }
             }
@@ -284,25 +284,47 @@ namespace mpi {
                 if (comms[destTag] != nullptr) {
                     // Add the message directly to the destination rx queue (same process)
                     ActionMessage M(sendRequestData.second);
-                    comms[destTag]->getRxMessageQueue().push(M);
+                    comms[destTag]->getRxMessageQueue().push(std::move(M));
                 }
                 mpilock.unlock();
+                recycleSendBuffer(std::move(sendRequestData.second));
             }
             sendMsg = txMessageQueue.try_pop();
         }
 
-        send_requests.remove_if([](std::pair<MPI_Request, std::vector<char>>& req) {
+        send_requests.remove_if([this](std::pair<MPI_Request, std::vector<char>>& req) {
             int send_finished;
             MPI_Test(&req.first, &send_finished, MPI_STATUS_IGNORE);
 
             if (send_finished == 1) {
-                // Any cleanup needed here? Freeing the vector or MPI_Request?
+                recycleSendBuffer(std::move(req.second));
             }
 
             return (send_finished == 1);
         });
     }
 
+    std::vector<char> MpiService::getSendBuffer()
+    {
+        std::lock_guard<std::mutex> lock(bufferLock);
+        if (freeBuffers.empty()) {
+            return std::vector<char>();
+        }
+        auto buffer = std::move(freeBuffers.back());
+        freeBuffers.pop_back();
+        return buffer;
+    }
+
+    void MpiService::recycleSendBuffer(std::vector<char>&& buffer)
+    {
+        // limit the pool so a burst of sends does not hold on to memory indefinitely
+        constexpr std::size_t maxFreeBuffers{64};
+        std::lock_guard<std::mutex> lock(bufferLock);
+        if (freeBuffers.size() < maxFreeBuffers) {
+            freeBuffers.push_back(std::move(buffer));
+        }
+    }
+
     void MpiService::drainRemainingMessages()
     {
         // Post receives for any waiting sends
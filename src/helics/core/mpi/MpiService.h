@@ -47,6 +47,17 @@ namespace mpi {
         {
             txMessageQueue.emplace(address, std::move(message));
         }
+        /** serialize a command into a recycled buffer and queue it for sending*/
+        void sendMessage(std::pair<int, int> address, const ActionMessage& cmd)
+        {
+            auto buffer = getSendBuffer();
+            cmd.serializeInto(buffer);
+            txMessageQueue.emplace(address, std::move(buffer));
+        }
+        /** get a buffer to serialize a message into
+        @details the buffer is recycled from a completed send if one is available so the steady state sending
+        does not allocate*/
+        std::vector<char> getSendBuffer();
 
         void sendAndReceiveMessages();
         void drainRemainingMessages();
@@ -63,6 +74,8 @@ namespace mpi {
         std::vector<MpiComms*> comms;
         gmlc::containers::BlockingQueue<std::pair<std::pair<int, int>, std::vector<char>>>
             txMessageQueue;
+        std::mutex bufferLock; //!< lock for the recycled send buffers
+        std::vector<std::vector<char>> freeBuffers; //!< buffers from completed sends available for reuse
 
         bool helics_initialized_mpi{false};
         std::atomic<int> comms_connected{0};
@@ -70,6 +83,8 @@ namespace mpi {
         std::atomic<bool> stop_service{false};
         std::unique_ptr<std::thread> service_thread;
 
+        /** return the buffer of a completed send to the pool*/
+        void recycleSendBuffer(std::vector<char>&& buffer);
         void startService();
         void serviceLoop();
 
@@ -0,0 +1,209 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "ShmComms.h"
+
+#include "../../common/fmt_format.h"
+#include "../ActionMessage.hpp"
+#include "../NetworkCore_impl.hpp"
+#include "../helics_definitions.hpp"
+#include "ShmRingBuffer.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <thread>
+
+namespace helics {
+namespace shm {
+    ShmComms::ShmComms()
+    {
+        // override the default value for this comm system
+        maxMessageCount = 1024;
+    }
+    /** destructor*/
+    ShmComms::~ShmComms() { disconnect(); }
+
+    void ShmComms::loadNetworkInfo(const NetworkBrokerData& netInfo)
+    {
+        CommsInterface::loadNetworkInfo(netInfo);
+        if (!propertyLock()) {
+            return;
+        }
+        if (localTargetAddress.empty()) {
+            if (serverMode) {
+                // the same address the cores connect to by default
+                localTargetAddress = defBrokerInterface[static_cast<int>(interface_type::ipc)];
+            } else {
+                localTargetAddress = name;
+            }
+        }
+        propertyUnLock();
+    }
+
+    void ShmComms::queue_rx_function()
+    {
+        OwnedRing rxRing;
+        bool connected = rxRing.connect(localTargetAddress, maxMessageCount, maxMessageSize);
+        if (!connected) {
+            std::this_thread::sleep_for(connectionTimeout);
+            connected = rxRing.connect(localTargetAddress, maxMessageCount, maxMessageSize);
+            if (!connected) {
+                disconnecting = true;
+                ActionMessage err(CMD_ERROR);
+                err.messageID = defs::errors::connection_failure;
+                err.payload = rxRing.getError();
+                ActionCallback(std::move(err));
+                setRxStatus(connection_status::error); // the connection has failed
+                return;
+            }
+        }
+        setRxStatus(
+            connection_status::connected); // this is a atomic indicator that the rx queue is ready
+        ActionMessage cmd;
+        while (!closeRequested.load()) {
+            if (!rxRing.getMessage(cmd, std::chrono::milliseconds(500))) {
+                continue;
+            }
+            if (isProtocolCommand(cmd)) {
+                if (cmd.messageID == CLOSE_RECEIVER) {
+                    disconnecting = true;
+                    break;
+                }
+                continue;
+            }
+            ActionCallback(std::move(cmd));
+        }
+        closeRequested = false;
+        rxRing.close();
+        setRxStatus(connection_status::terminated);
+    }
+
+    void ShmComms::queue_tx_function()
+    {
+        SendToRing brokerRing; //!< the ring of the broker
+        SendToRing rxRing;
+        std::map<route_id, SendToRing> routes; //!< table of the routes to other brokers
+        bool hasBroker = false;
+
+        if (!brokerTargetAddress.empty()) {
+            bool conn = brokerRing.connect(brokerTargetAddress, 20);
+            if (!conn) {
+                std::this_thread::sleep_for(connectionTimeout);
+                conn = brokerRing.connect(brokerTargetAddress, 20);
+                if (!conn) {
+                    ActionMessage err(CMD_ERROR);
+                    err.payload = fmt::format(
+                        "Unable to open broker connection -> {}", brokerRing.getError());
+                    err.messageID = defs::errors::connection_failure;
+                    ActionCallback(std::move(err));
+                    setTxStatus(connection_status::error);
+                    return;
+                }
+            }
+            hasBroker = true;
+        }
+        // wait for the receiver to startup
+        if (!rxTrigger.wait_forActivation(connectionTimeout)) {
+            ActionMessage err(CMD_ERROR);
+            err.messageID = defs::errors::connection_failure;
+            err.payload = "Unable to link with receiver";
+            ActionCallback(std::move(err));
+            setTxStatus(connection_status::error);
+            return;
+        }
+        if (getRxStatus() == connection_status::error) {
+            setTxStatus(connection_status::error);
+            return;
+        }
+        if (!rxRing.connect(localTargetAddress, 0)) {
+            ActionMessage err(CMD_ERROR);
+            err.messageID = defs::errors::connection_failure;
+            err.payload = fmt::format("Unable to open receiver connection -> {}", rxRing.getError());
+            ActionCallback(std::move(err));
+            setTxStatus(connection_status::error);
+            return;
+        }
+
+        auto sendToRing = [this](SendToRing& ring, const ActionMessage& msg, route_id rid) {
+            if (!ring.sendMessage(msg)) {
+                // a full ring waits for space so a failure means the message is lost
+                logError(fmt::format(
+                    "unable to send {} on route {} -> {}",
+                    prettyPrintString(msg),
+                    rid.baseValue(),
+                    ring.getError()));
+            }
+        };
+        // large payloads are split into chunks that fit in the ring slots
+        maxChunkSize = static_cast<std::size_t>((std::max)(maxMessageSize - 128, 64));
+        setTxStatus(connection_status::connected);
+        bool continueLoop{true};
+        while (continueLoop) {
+            route_id rid;
+            ActionMessage cmd;
+            std::tie(rid, cmd) = getNextTransmission();
+            if (isProtocolCommand(cmd)) {
+                if (rid == control_route) {
+                    switch (cmd.messageID) {
+                        case NEW_ROUTE: {
+                            SendToRing newRing;
+                            if (newRing.connect(cmd.payload, 3)) {
+                                routes.emplace(route_id{cmd.getExtraData()}, std::move(newRing));
+                            }
+                            continue;
+                        }
+                        case REMOVE_ROUTE:
+                            routes.erase(route_id{cmd.getExtraData()});
+                            continue;
+                        case DISCONNECT:
+                            continueLoop = false;
+                            continue;
+                    }
+                }
+            }
+            if (rid == parent_route_id) {
+                if (hasBroker) {
+                    sendToRing(brokerRing, cmd, rid);
+                }
+            } else if (rid == control_route) {
+                sendToRing(rxRing, cmd, rid);
+            } else {
+                auto routeFnd = routes.find(rid);
+                if (routeFnd != routes.end()) {
+                    sendToRing(routeFnd->second, cmd, rid);
+                } else {
+                    if (hasBroker) {
+                        sendToRing(brokerRing, cmd, rid);
+                    }
+                }
+            }
+        }
+        setTxStatus(connection_status::terminated);
+    }
+
+    void ShmComms::closeReceiver()
+    {
+        if ((getRxStatus() == connection_status::error) ||
+            (getRxStatus() == connection_status::terminated)) {
+            return;
+        }
+        ActionMessage cmd(CMD_PROTOCOL);
+        cmd.messageID = CLOSE_RECEIVER;
+        if (getTxStatus() == connection_status::connected) {
+            transmit(control_route, cmd);
+        } else if (!disconnecting) {
+            SendToRing rxRing;
+            if (!rxRing.connect(localTargetAddress, 0) || !rxRing.sendMessage(cmd)) {
+                closeRequested.store(true);
+            }
+        }
+    }
+
+    std::string ShmComms::getAddress() const { return localTargetAddress; }
+
+} // namespace shm
+} // namespace helics
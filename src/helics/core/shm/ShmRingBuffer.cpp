@@ -0,0 +1,353 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "ShmRingBuffer.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <new>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+
+#ifdef __linux__
+#    include <linux/futex.h>
+#    include <sys/syscall.h>
+#    include <time.h>
+#endif
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "shared memory rings require lock free 64 bit atomics");
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "shared memory rings require lock free 32 bit atomics");
+static_assert(
+    sizeof(std::atomic<uint32_t>) == sizeof(uint32_t),
+    "the futex word must be a plain 32 bit integer");
+
+namespace helics {
+namespace shm {
+    constexpr uint32_t ringMagic{0x48525347U};
+    /** number of checks of an empty ring before the consumer starts yielding*/
+    constexpr int spinChecks{256};
+    /** number of yields before the consumer goes to sleep on the futex*/
+    constexpr int yieldChecks{64};
+
+    static std::size_t roundUp(std::size_t value, std::size_t multiple)
+    {
+        return ((value + multiple - 1) / multiple) * multiple;
+    }
+
+    static const std::size_t controlSize{roundUp(sizeof(RingControl), 64)};
+
+#ifdef __linux__
+    static void wakeWait(
+        std::atomic<uint32_t>* word,
+        uint32_t expected,
+        std::chrono::milliseconds timeout)
+    {
+        timespec wait;
+        wait.tv_sec = static_cast<time_t>(timeout.count() / 1000);
+        wait.tv_nsec = static_cast<long>((timeout.count() % 1000) * 1000000);
+        // not FUTEX_PRIVATE since the word is shared between processes
+        syscall(
+            SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAIT, expected, &wait, nullptr, 0);
+    }
+
+    static void wakeSignal(std::atomic<uint32_t>* word)
+    {
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAKE, 1, nullptr, nullptr, 0);
+    }
+#else
+    // no futex available so fall back to polling the word
+    static void wakeWait(
+        std::atomic<uint32_t>* word,
+        uint32_t expected,
+        std::chrono::milliseconds timeout)
+    {
+        auto stop = std::chrono::steady_clock::now() + timeout;
+        while (word->load(std::memory_order_acquire) == expected) {
+            if (std::chrono::steady_clock::now() >= stop) {
+                return;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    }
+
+    static void wakeSignal(std::atomic<uint32_t>* /*word*/) {}
+#endif
+
+    std::string ringSegmentName(const std::string& connection)
+    {
+        std::string segment = "/helics_shm_" + connection;
+        std::replace_if(
+            segment.begin() + 1,
+            segment.end(),
+            [](auto c) { return !(std::isalnum(c) || (c == '_')); },
+            '_');
+        return segment;
+    }
+
+    RingMapping::~RingMapping() { release(); }
+
+    RingMapping::RingMapping(RingMapping&& map) noexcept:
+        control(map.control), mappedSize(map.mappedSize)
+    {
+        map.control = nullptr;
+        map.mappedSize = 0;
+    }
+
+    RingMapping& RingMapping::operator=(RingMapping&& map) noexcept
+    {
+        release();
+        control = map.control;
+        mappedSize = map.mappedSize;
+        map.control = nullptr;
+        map.mappedSize = 0;
+        return *this;
+    }
+
+    bool RingMapping::create(const std::string& segment, int slots, int slotSize, std::string& error)
+    {
+        release();
+        uint32_t count{2};
+        while (count < static_cast<uint32_t>(slots)) {
+            count <<= 1U;
+        }
+        auto stride =
+            roundUp(sizeof(RingSlot) + static_cast<std::size_t>((std::max)(slotSize, 64)), 64);
+        auto totalSize = controlSize + stride * count;
+
+        shm_unlink(segment.c_str());
+        int fd = shm_open(segment.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+        if (fd < 0) {
+            error = std::string("unable to create shared memory ring:") + std::strerror(errno);
+            return false;
+        }
+        if (ftruncate(fd, static_cast<off_t>(totalSize)) != 0) {
+            error = std::string("unable to size shared memory ring:") + std::strerror(errno);
+            ::close(fd);
+            shm_unlink(segment.c_str());
+            return false;
+        }
+        void* mem = mmap(nullptr, totalSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (mem == MAP_FAILED) {
+            error = std::string("unable to map shared memory ring:") + std::strerror(errno);
+            shm_unlink(segment.c_str());
+            return false;
+        }
+        control = new (mem) RingControl;
+        mappedSize = totalSize;
+        control->slotCount = count;
+        control->slotSize = static_cast<uint32_t>(stride - sizeof(RingSlot));
+        control->slotStride = static_cast<uint32_t>(stride);
+        control->state.store(static_cast<int32_t>(ring_state::startup), std::memory_order_relaxed);
+        control->enqueuePos.store(0, std::memory_order_relaxed);
+        control->dequeuePos.store(0, std::memory_order_relaxed);
+        control->wakeSequence.store(0, std::memory_order_relaxed);
+        control->consumerWaiting.store(0, std::memory_order_relaxed);
+        for (uint32_t ii = 0; ii < count; ++ii) {
+            auto* slot = new (reinterpret_cast<char*>(control) + controlSize + stride * ii) RingSlot;
+            slot->sequence.store(ii, std::memory_order_relaxed);
+            slot->size = 0;
+        }
+        control->state.store(static_cast<int32_t>(ring_state::operating), std::memory_order_relaxed);
+        control->magic.store(ringMagic, std::memory_order_release);
+        return true;
+    }
+
+    bool RingMapping::open(const std::string& segment, std::string& error)
+    {
+        release();
+        int fd = shm_open(segment.c_str(), O_RDWR, 0);
+        if (fd < 0) {
+            error = std::string("unable to open shared memory ring:") + std::strerror(errno);
+            return false;
+        }
+        struct stat info;
+        if ((fstat(fd, &info) != 0) || (static_cast<std::size_t>(info.st_size) < controlSize)) {
+            error = "shared memory ring is not initialized";
+            ::close(fd);
+            return false;
+        }
+        auto totalSize = static_cast<std::size_t>(info.st_size);
+        void* mem = mmap(nullptr, totalSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (mem == MAP_FAILED) {
+            error = std::string("unable to map shared memory ring:") + std::strerror(errno);
+            return false;
+        }
+        control = static_cast<RingControl*>(mem);
+        mappedSize = totalSize;
+        if ((control->magic.load(std::memory_order_acquire) != ringMagic) ||
+            (controlSize + static_cast<std::size_t>(control->slotStride) * control->slotCount >
+             totalSize)) {
+            error = "shared memory ring is not initialized";
+            release();
+            return false;
+        }
+        return true;
+    }
+
+    void RingMapping::release()
+    {
+        if (control != nullptr) {
+            munmap(control, mappedSize);
+            control = nullptr;
+            mappedSize = 0;
+        }
+    }
+
+    RingSlot* RingMapping::slotAt(uint64_t position) const noexcept
+    {
+        auto index = static_cast<std::size_t>(position & (control->slotCount - 1));
+        return reinterpret_cast<RingSlot*>(
+            reinterpret_cast<char*>(control) + controlSize + index * control->slotStride);
+    }
+
+    OwnedRing::~OwnedRing() { close(); }
+
+    bool OwnedRing::connect(const std::string& connection, int maxMessages, int maxSize)
+    {
+        close();
+        segmentName = ringSegmentName(connection);
+        return ring.create(segmentName, maxMessages, maxSize, errorString);
+    }
+
+    bool OwnedRing::tryGetMessage(ActionMessage& cmd)
+    {
+        auto* ctl = ring.getControl();
+        while (true) {
+            auto pos = ctl->dequeuePos.load(std::memory_order_relaxed);
+            auto* slot = ring.slotAt(pos);
+            if (slot->sequence.load(std::memory_order_acquire) != pos + 1) {
+                return false;
+            }
+            auto size = (std::min)(slot->size, ctl->slotSize);
+            bool valid = (size > 0) &&
+                (cmd.fromByteArray(RingMapping::slotData(slot), static_cast<int>(size)) > 0) &&
+                isValidCommand(cmd);
+            // release the slot back to the producers one lap ahead
+            slot->sequence.store(pos + ctl->slotCount, std::memory_order_release);
+            ctl->dequeuePos.store(pos + 1, std::memory_order_relaxed);
+            if (valid) {
+                return true;
+            }
+        }
+    }
+
+    bool OwnedRing::getMessage(ActionMessage& cmd, std::chrono::milliseconds timeout)
+    {
+        if (!ring.isValid()) {
+            return false;
+        }
+        for (int ii = 0; ii < spinChecks + yieldChecks; ++ii) {
+            if (tryGetMessage(cmd)) {
+                return true;
+            }
+            if (ii >= spinChecks) {
+                std::this_thread::yield();
+            }
+        }
+        auto* ctl = ring.getControl();
+        ctl->consumerWaiting.store(1, std::memory_order_relaxed);
+        // pairs with the fence in SendToRing::sendMessage so either the producer sees the waiting flag or
+        // the consumer sees the published slot
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto wake = ctl->wakeSequence.load(std::memory_order_acquire);
+        if (!tryGetMessage(cmd)) {
+            wakeWait(&ctl->wakeSequence, wake, timeout);
+        } else {
+            ctl->consumerWaiting.store(0, std::memory_order_relaxed);
+            return true;
+        }
+        ctl->consumerWaiting.store(0, std::memory_order_relaxed);
+        return tryGetMessage(cmd);
+    }
+
+    void OwnedRing::close()
+    {
+        if (ring.isValid()) {
+            ring.getControl()->state.store(
+                static_cast<int32_t>(ring_state::closing), std::memory_order_release);
+            shm_unlink(segmentName.c_str());
+            ring.release();
+        }
+    }
+
+    bool SendToRing::connect(const std::string& connection, int retries)
+    {
+        auto segment = ringSegmentName(connection);
+        int tries = 0;
+        while (!ring.open(segment, errorString)) {
+            ++tries;
+            if (tries > retries) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        }
+        return true;
+    }
+
+    bool SendToRing::sendMessage(const ActionMessage& cmd)
+    {
+        if (!ring.isValid()) {
+            errorString = "ring is not connected";
+            return false;
+        }
+        auto* ctl = ring.getControl();
+        if (static_cast<std::size_t>(cmd.serializedByteCount()) > ctl->slotSize) {
+            errorString = "message is too large for the ring";
+            return false;
+        }
+        auto pos = ctl->enqueuePos.load(std::memory_order_relaxed);
+        RingSlot* slot{nullptr};
+        int waits{0};
+        while (true) {
+            if (ctl->state.load(std::memory_order_acquire) ==
+                static_cast<int32_t>(ring_state::closing)) {
+                errorString = "ring is closed";
+                return false;
+            }
+            slot = ring.slotAt(pos);
+            auto diff = static_cast<int64_t>(slot->sequence.load(std::memory_order_acquire) - pos);
+            if (diff == 0) {
+                if (ctl->enqueuePos.compare_exchange_weak(
+                        pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // the ring is full so wait for the consumer to catch up
+                if (++waits < yieldChecks) {
+                    std::this_thread::yield();
+                } else {
+                    std::this_thread::sleep_for(std::chrono::microseconds(100));
+                }
+                pos = ctl->enqueuePos.load(std::memory_order_relaxed);
+            } else {
+                pos = ctl->enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        auto size = cmd.toByteArray(RingMapping::slotData(slot), static_cast<int>(ctl->slotSize));
+        // the slot is claimed so it must be published even if the serialization failed
+        slot->size = (size > 0) ? static_cast<uint32_t>(size) : 0U;
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (ctl->consumerWaiting.load(std::memory_order_relaxed) != 0) {
+            ctl->wakeSequence.fetch_add(1, std::memory_order_release);
+            wakeSignal(&ctl->wakeSequence);
+        }
+        if (size <= 0) {
+            errorString = "unable to serialize the message into the ring";
+            return false;
+        }
+        return true;
+    }
+
+} // namespace shm
+} // namespace helics
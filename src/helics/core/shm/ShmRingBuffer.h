@@ -0,0 +1,136 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "../ActionMessage.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace helics {
+namespace shm {
+    /** generate the name of the shared memory segment used for a connection name*/
+    std::string ringSegmentName(const std::string& connection);
+
+    /** enumeration of the states of a ring*/
+    enum class ring_state : int32_t {
+        startup = 0,
+        operating = 1,
+        closing = 2,
+    };
+
+    /** control block placed at the start of a shared memory ring
+    @details the enqueue and dequeue positions and the wake word sit on separate cache lines so producers
+    and the consumer do not contend on the same line, the slots follow the control block*/
+    struct RingControl {
+        std::atomic<uint32_t> magic; //!< marker set once the ring is fully initialized
+        uint32_t slotCount; //!< the number of slots always a power of 2
+        uint32_t slotSize; //!< the maximum size of a serialized message in a slot
+        uint32_t slotStride; //!< the distance in bytes between slots
+        std::atomic<int32_t> state; //!< the ring_state of the ring
+        alignas(64) std::atomic<uint64_t> enqueuePos; //!< next position to be claimed by a producer
+        alignas(64) std::atomic<uint64_t> dequeuePos; //!< next position to be read by the consumer
+        alignas(64) std::atomic<uint32_t> wakeSequence; //!< word the consumer sleeps on
+        std::atomic<uint32_t> consumerWaiting; //!< set while the consumer is (about to be) asleep
+    };
+
+    /** header of a single slot in the ring*/
+    struct RingSlot {
+        std::atomic<uint64_t> sequence; //!< sequence number indicating whether the slot is free or full
+        uint32_t size; //!< the number of bytes of data in the slot
+        uint32_t reserved; //!< padding so the data is 8 byte aligned
+    };
+
+    /** a mapping of a shared memory ring
+    @details the ring is a bounded multi producer single consumer queue of fixed size slots, producers claim a
+    slot with a single compare and swap on the enqueue position and serialize the message directly into shared
+    memory, the consumer deserializes directly out of it so no locks and no intermediate copies are involved,
+    a consumer with nothing to read spins briefly then sleeps on a futex that producers only signal when the
+    consumer is actually waiting*/
+    class RingMapping {
+      public:
+        RingMapping() = default;
+        ~RingMapping();
+        RingMapping(RingMapping&& map) noexcept;
+        RingMapping& operator=(RingMapping&& map) noexcept;
+        RingMapping(const RingMapping&) = delete;
+        RingMapping& operator=(const RingMapping&) = delete;
+        /** create a new ring, an existing segment of the same name is removed first*/
+        bool create(const std::string& segment, int slots, int slotSize, std::string& error);
+        /** open an existing ring created by another process or thread*/
+        bool open(const std::string& segment, std::string& error);
+        /** unmap the ring*/
+        void release();
+        /** check if the mapping is valid*/
+        bool isValid() const noexcept { return (control != nullptr); }
+        /** get the ring control block*/
+        RingControl* getControl() const noexcept { return control; }
+        /** get a slot from a position*/
+        RingSlot* slotAt(uint64_t position) const noexcept;
+        /** get the data section of a slot*/
+        static char* slotData(RingSlot* slot) noexcept
+        {
+            return reinterpret_cast<char*>(slot) + sizeof(RingSlot);
+        }
+
+      private:
+        RingControl* control{nullptr}; //!< the start of the mapped memory
+        std::size_t mappedSize{0}; //!< the size of the mapped memory
+    };
+
+    /** class implementing a ring owned by a receiver*/
+    class OwnedRing {
+      public:
+        OwnedRing() = default;
+        ~OwnedRing();
+        /** create the ring for a connection
+        @param connection the name of the connection
+        @param maxMessages the number of message slots in the ring rounded up to a power of 2
+        @param maxSize the maximum serialized size of a message*/
+        bool connect(const std::string& connection, int maxMessages, int maxSize);
+        /** get the next message from the ring
+        @param cmd the message to load the data into
+        @param timeout the maximum time to wait for a message
+        @return true if a message was loaded*/
+        bool getMessage(ActionMessage& cmd, std::chrono::milliseconds timeout);
+        /** mark the ring as closing and remove the shared memory name*/
+        void close();
+
+        const std::string& getError() const { return errorString; }
+
+      private:
+        bool tryGetMessage(ActionMessage& cmd);
+        RingMapping ring; //!< the memory of the ring
+        std::string segmentName; //!< the name of the shared memory segment
+        std::string errorString; //!< storage for an error message
+    };
+
+    /** class implementing interactions with a ring to transmit data*/
+    class SendToRing {
+      public:
+        SendToRing() = default;
+        /** open the ring of a connection
+        @param connection the name of the connection
+        @param retries the number of times to retry if the ring does not exist yet*/
+        bool connect(const std::string& connection, int retries);
+        /** write a message into the ring
+        @details waits for space if the ring is full
+        @return false if the message could not be delivered because it is too large or the ring is closed*/
+        bool sendMessage(const ActionMessage& cmd);
+
+        const std::string& getError() const { return errorString; }
+
+      private:
+        RingMapping ring; //!< the memory of the ring
+        std::string errorString; //!< storage for an error message
+    };
+
+} // namespace shm
+} // namespace helics
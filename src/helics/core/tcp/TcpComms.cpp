@@ -13,6 +13,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "TcpCommsCommon.h"
 #include "TcpHelperClasses.h"
 
+#include <limits>
 #include <memory>
 
 namespace helics {
@@ -82,7 +83,9 @@ namespace tcp {
                 auto rep = generateReplyToIncomingMessage(m);
                 if (rep.action() != CMD_IGNORE) {
                     try {
-                        connection->send(rep.packetize());
+                        auto& buffer = threadSerializationBuffer();
+                        rep.packetize(buffer);
+                        connection->send(buffer);
                     }
                     catch (const std::system_error&) {
                     }
@@ -337,7 +340,7 @@ namespace tcp {
 
     void TcpComms::queue_tx_function()
     {
-        std::vector<char> buffer;
+        std::string buffer;
         auto ioctx = AsioContextManager::getContextPointer();
         auto contextLoop = ioctx->startContextLoop();
         TcpConnection::pointer brokerConnection;
@@ -364,12 +367,12 @@ namespace tcp {
         }
         setTxStatus(connection_status::connected);
 
-        //  std::vector<ActionMessage> txlist;
+        std::vector<ActionMessage> batch;
         while (true) {
             route_id rid;
             ActionMessage cmd;
 
-            std::tie(rid, cmd) = txQueue.pop();
+            std::tie(rid, cmd) = getNextTransmission();
             bool processed = false;
             if (isProtocolCommand(cmd)) {
                 if (rid == control_route) {
@@ -409,10 +412,15 @@ namespace tcp {
                 continue;
             }
 
+            if (rid != control_route) {
+                // tcp is a stream so messages for the same route can go out as one packet stream
+                collectTransmitBatch(rid, cmd, (std::numeric_limits<int>::max)(), batch);
+                packetizeBatch(cmd, batch, buffer);
+            }
             if (rid == parent_route_id) {
                 if (hasBroker) {
                     try {
-                        brokerConnection->send(cmd.packetize());
+                        brokerConnection->send(buffer);
                     }
                     catch (const std::system_error& se) {
                         if (se.code() != asio::error::connection_aborted) {
@@ -436,7 +444,7 @@ namespace tcp {
                 auto rt_find = routes.find(rid);
                 if (rt_find != routes.end()) {
                     try {
-                        rt_find->second->send(cmd.packetize());
+                        rt_find->second->send(buffer);
                     }
                     catch (const std::system_error& se) {
                         if (se.code() != asio::error::connection_aborted) {
@@ -450,7 +458,7 @@ namespace tcp {
                 } else {
                     if (hasBroker) {
                         try {
-                            brokerConnection->send(cmd.packetize());
+                            brokerConnection->send(buffer);
                         }
                         catch (const std::system_error& se) {
                             if (se.code() != asio::error::connection_aborted) {
@@ -197,7 +197,7 @@ namespace tcp {
             }
         }
         setRxStatus(connection_status::connected);
-        std::vector<char> buffer;
+        std::string buffer;
 
         TcpConnection::pointer brokerConnection;
 
@@ -253,7 +253,7 @@ namespace tcp {
             route_id rid;
             ActionMessage cmd;
 
-            std::tie(rid, cmd) = txQueue.pop();
+            std::tie(rid, cmd) = getNextTransmission();
             bool processed = false;
             if (isProtocolCommand(cmd)) {
                 if (rid == control_route) {
@@ -341,11 +341,11 @@ namespace tcp {
             if (processed) {
                 continue;
             }
-
+            cmd.packetize(buffer);
             if (rid == parent_route_id) {
                 if ((hasBroker) && (brokerConnection)) {
                     try {
-                        brokerConnection->send(cmd.packetize());
+                        brokerConnection->send(buffer);
                     }
                     catch (const std::system_error& se) {
                         if (se.code() != asio::error::connection_aborted) {
@@ -366,7 +366,7 @@ namespace tcp {
                 auto rt_find = routes.find(rid);
                 if (rt_find != routes.end()) {
                     try {
-                        rt_find->second->send(cmd.packetize());
+                        rt_find->second->send(buffer);
                     }
                     catch (const std::system_error& se) {
                         if (se.code() != asio::error::connection_aborted) {
@@ -380,7 +380,7 @@ namespace tcp {
                 } else {
                     if (hasBroker) {
                         try {
-                            brokerConnection->send(cmd.packetize());
+                            brokerConnection->send(buffer);
                         }
                         catch (const std::system_error& se) {
                             if (se.code() != asio::error::connection_aborted) {
@@ -18,6 +18,11 @@ SPDX-License-Identifier: BSD-3-Clause
 namespace helics {
 namespace udp {
     using asio::ip::udp;
+    /** size of the buffer used to receive datagrams*/
+    constexpr int udpReceiveBufferSize = 10192;
+    /** maximum size of the messages combined in a single datagram leaving room for the multi message header*/
+    constexpr int udpMaxBatchBytes = udpReceiveBufferSize - 128;
+
     UdpComms::UdpComms():
         NetworkCommsInterface(interface_type::udp), promisePort(std::promise<int>())
     {
@@ -118,10 +123,13 @@ namespace udp {
             }
         }
 
-        std::vector<char> data(10192);
+        std::vector<char> data(udpReceiveBufferSize);
         udp::endpoint remote_endp;
         std::error_code error;
         std::error_code ignored_error;
+        // the received command and the reply are recycled between datagrams
+        ActionMessage M;
+        std::string replyBuffer;
         setRxStatus(connection_status::connected);
         while (true) {
             auto len = socket.receive_from(asio::buffer(data), remote_endp, 0, error);
@@ -135,7 +143,7 @@ namespace udp {
                     goto CLOSE_RX_LOOP;
                 }
             }
-            ActionMessage M(data.data(), len);
+            M.fromByteArray(data.data(), static_cast<int>(len));
             if (!isValidCommand(M)) {
                 logWarning("invalid command received udp");
                 continue;
@@ -148,8 +156,8 @@ namespace udp {
                     if (reply.messageID == DISCONNECT) {
                         goto CLOSE_RX_LOOP;
                     } else if (reply.action() != CMD_IGNORE) {
-                        socket.send_to(
-                            asio::buffer(reply.to_string()), remote_endp, 0, ignored_error);
+                        reply.serializeInto(replyBuffer);
+                        socket.send_to(asio::buffer(replyBuffer), remote_endp, 0, ignored_error);
                     }
                 }
             } else {
@@ -163,7 +171,9 @@ namespace udp {
 
     void UdpComms::queue_tx_function()
     {
-        std::vector<char> buffer;
+        // large payloads are split into chunks that fit in a single datagram
+        maxChunkSize = udpMaxBatchBytes - 128;
+        std::string buffer;
         auto ioctx = AsioContextManager::getContextPointer();
         udp::resolver resolver(ioctx->getBaseContext());
         bool closingRx = false;
@@ -319,12 +329,12 @@ namespace udp {
         }
 
         setTxStatus(connection_status::connected);
-
+        std::vector<ActionMessage> batch;
         while (true) {
             route_id rid;
             ActionMessage cmd;
 
-            std::tie(rid, cmd) = txQueue.pop();
+            std::tie(rid, cmd) = getNextTransmission();
             bool processed = false;
             if (isProtocolCommand(cmd)) {
                 if (rid == control_route) {
@@ -351,8 +361,8 @@ namespace udp {
                             processed = true;
                             break;
                         case CLOSE_RECEIVER:
-                            transmitSocket.send_to(
-                                asio::buffer(cmd.to_string()), rxEndpoint, 0, error);
+                            cmd.serializeInto(buffer);
+                            transmitSocket.send_to(asio::buffer(buffer), rxEndpoint, 0, error);
                             if (error) {
                                 logError(fmt::format(
                                     "transmit failure on sending 'close' to receiver  {}",
@@ -369,11 +379,16 @@ namespace udp {
             if (processed) {
                 continue;
             }
-
+            if (rid != control_route) {
+                // a batch of messages for the same route is sent as a single datagram
+                collectTransmitBatch(rid, cmd, udpMaxBatchBytes, batch);
+                serializeBatch(cmd, batch, buffer);
+            } else {
+                cmd.serializeInto(buffer);
+            }
             if (rid == parent_route_id) {
                 if (hasBroker) {
-                    transmitSocket.send_to(
-                        asio::buffer(cmd.to_string()), broker_endpoint, 0, error);
+                    transmitSocket.send_to(asio::buffer(buffer), broker_endpoint, 0, error);
                     if (error) {
                         logWarning(
                             fmt::format("transmit failure sending to broker  {}", error.message()));
@@ -384,7 +399,7 @@ namespace udp {
                         prettyPrintString(cmd)));
                 }
             } else if (rid == control_route) { // send to rx thread loop
-                transmitSocket.send_to(asio::buffer(cmd.to_string()), rxEndpoint, 0, error);
+                transmitSocket.send_to(asio::buffer(buffer), rxEndpoint, 0, error);
                 if (error) {
                     logWarning(fmt::format(
                         "transmit failure sending control message to receiver  {}",
@@ -393,8 +408,7 @@ namespace udp {
             } else {
                 auto rt_find = routes.find(rid);
                 if (rt_find != routes.end()) {
-                    transmitSocket.send_to(
-                        asio::buffer(cmd.to_string()), rt_find->second, 0, error);
+                    transmitSocket.send_to(asio::buffer(buffer), rt_find->second, 0, error);
                     if (error) {
                         logWarning(fmt::format(
                             "transmit failure sending to route {}:{}",
@@ -403,8 +417,7 @@ namespace udp {
                     }
                 } else {
                     if (hasBroker) {
-                        transmitSocket.send_to(
-                            asio::buffer(cmd.to_string()), broker_endpoint, 0, error);
+                        transmitSocket.send_to(asio::buffer(buffer), broker_endpoint, 0, error);
                         if (error) {
                             logWarning(fmt::format(
                                 "transmit failure sending to broker  {}", error.message()));
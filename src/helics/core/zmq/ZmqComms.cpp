@@ -16,6 +16,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "ZmqCommsCommon.h"
 #include "ZmqRequestSets.h"
 //#include <csignal>
+#include <limits>
 #include <memory>
 
 using namespace std::chrono;
@@ -91,15 +92,17 @@ namespace zeromq {
                 return (-1);
             }
             auto reply = generateReplyToIncomingMessage(M);
-            auto str = reply.to_string();
-            sock.send(str);
+            auto& buffer = threadSerializationBuffer();
+            reply.serializeInto(buffer);
+            sock.send(zmq::const_buffer(buffer.data(), buffer.size()));
             return 0;
         }
 
         ActionCallback(std::move(M));
         ActionMessage resp(CMD_PRIORITY_ACK);
-        auto str = resp.to_string();
-        sock.send(str);
+        auto& buffer = threadSerializationBuffer();
+        resp.serializeInto(buffer);
+        sock.send(zmq::const_buffer(buffer.data(), buffer.size()));
         return 0;
     }
 
@@ -396,7 +399,8 @@ namespace zeromq {
 
     void ZmqComms::queue_tx_function()
     {
-        std::vector<char> buffer;
+        std::string buffer;
+        std::vector<ActionMessage> batch;
         if (!brokerTargetAddress.empty()) {
             hasBroker = true;
         }
@@ -435,7 +439,7 @@ namespace zeromq {
             route_id rid;
             ActionMessage cmd;
 
-            std::tie(rid, cmd) = txQueue.pop();
+            std::tie(rid, cmd) = getNextTransmission();
             bool processed = false;
             if (isProtocolCommand(cmd)) {
                 if (control_route == rid) {
@@ -482,7 +486,9 @@ namespace zeromq {
             if (processed) {
                 continue;
             }
-            cmd.to_vector(buffer);
+            // a batch of messages for the same route is sent as a single multi message
+            collectTransmitBatch(rid, cmd, (std::numeric_limits<int>::max)(), batch);
+            serializeBatch(cmd, batch, buffer);
             if (rid == parent_route_id) {
                 if (hasBroker) {
                     brokerPushSocket.send(
@@ -163,14 +163,16 @@ namespace zeromq {
                 return (-1);
             }
             auto reply = generateReplyToIncomingMessage(M);
-            auto str = reply.to_string();
-            sock.send(str);
+            auto& buffer = threadSerializationBuffer();
+            reply.serializeInto(buffer);
+            sock.send(zmq::const_buffer(buffer.data(), buffer.size()));
             return 0;
         }
         ActionCallback(std::move(M));
         ActionMessage resp(CMD_PRIORITY_ACK);
-        auto str = resp.to_string();
-        sock.send(str);
+        auto& buffer = threadSerializationBuffer();
+        resp.serializeInto(buffer);
+        sock.send(zmq::const_buffer(buffer.data(), buffer.size()));
         return 0;
     }
 
@@ -360,7 +362,7 @@ namespace zeromq {
             int count = 0;
 
             // Handle Tx messages first
-            auto tx_msg = txQueue.try_pop();
+            auto tx_msg = tryGetNextTransmission();
             int rc = zmq::poll(poller, 0l);
             if (!tx_msg || (rc <= 0)) {
                 std::this_thread::yield();
@@ -383,8 +385,7 @@ namespace zeromq {
                     }
                 }
                 if (!processed) {
-                    buffer.clear();
-                    cmd.to_vector(buffer);
+                    cmd.serializeInto(buffer);
                     if (rid == parent_route_id) {
                         if (hasBroker) {
                             std::string empty;
@@ -431,7 +432,7 @@ namespace zeromq {
                 }
                 tx_count++;
                 if (tx_count < TX_RX_MSG_COUNT) {
-                    tx_msg = txQueue.try_pop();
+                    tx_msg = tryGetNextTransmission();
                 }
             }
 
@@ -42,7 +42,9 @@ namespace zeromq {
             return true;
         }
         routes_waiting[routeNumber] = true;
-        routes[routeNumber]->send(command.to_string());
+        auto& buffer = threadSerializationBuffer();
+        command.serializeInto(buffer);
+        routes[routeNumber]->send(zmq::const_buffer(buffer.data(), buffer.size()));
         active_routes.emplace_back(zmq::pollitem_t());
         active_routes.back().events = ZMQ_POLLIN;
         active_routes.back().socket = static_cast<void*>(*routes[routeNumber]);
@@ -18,6 +18,7 @@ set(helics_shared_public_headers
     ${HELICS_LIBRARY_SOURCE_DIR}/application_api/Federate.hpp
     ${HELICS_LIBRARY_SOURCE_DIR}/application_api/helicsTypes.hpp
     ${HELICS_LIBRARY_SOURCE_DIR}/application_api/data_view.hpp
+    ${HELICS_LIBRARY_SOURCE_DIR}/application_api/vector_view.hpp
     ${HELICS_LIBRARY_SOURCE_DIR}/application_api/MessageFederate.hpp
     ${HELICS_LIBRARY_SOURCE_DIR}/application_api/MessageOperators.hpp
     ${HELICS_LIBRARY_SOURCE_DIR}/application_api/ValueConverter.hpp
@@ -39,6 +40,7 @@ set(helics_shared_private_headers
     ${HELICS_LIBRARY_SOURCE_DIR}/application_api/AsyncFedCallInfo.hpp
     ${HELICS_LIBRARY_SOURCE_DIR}/application_api/FilterOperations.hpp
     ${HELICS_LIBRARY_SOURCE_DIR}/application_api/FilterFederateManager.hpp
+    ${HELICS_LIBRARY_SOURCE_DIR}/application_api/textCodec.hpp
     ${HELICS_LIBRARY_SOURCE_DIR}/cxx_shared_library/BrokerFactory.hpp
     ${HELICS_LIBRARY_SOURCE_DIR}/cxx_shared_library/CoreFactory.hpp
 )
@@ -75,6 +77,7 @@ set(utilities_include_files
 set(helics_apps_public_headers
     ${HELICS_LIBRARY_SOURCE_DIR}/apps/Player.hpp
     ${HELICS_LIBRARY_SOURCE_DIR}/apps/Recorder.hpp
+    ${HELICS_LIBRARY_SOURCE_DIR}/apps/RecordLog.hpp
     ${HELICS_LIBRARY_SOURCE_DIR}/apps/Echo.hpp
     ${HELICS_LIBRARY_SOURCE_DIR}/apps/Source.hpp
     ${HELICS_LIBRARY_SOURCE_DIR}/apps/Tracer.hpp
@@ -40,6 +40,8 @@ typedef enum {
         11, /*!< a single socket version of the TCP core for more easily handling firewalls*/
     helics_core_type_http = 12, /*!< a core type using http for communication*/
     helics_core_type_websocket = 14, /*!< a core using websockets for communication*/
+    helics_core_type_shm =
+        15, /*!< a core using lock free rings in shared memory for federates on the same machine*/
     helics_core_type_inproc =
         18 /*!< an in process core type for handling communications in shared memory
                                    it is pretty similar to the test core but stripped from the "test" components*/
@@ -216,7 +218,13 @@ typedef enum {
     /** specify that an interface will only update if the value has actually changed*/
     helics_handle_option_only_update_on_change = 8,
     /** specify that an interface does not participate in determining time interrupts*/
-    helics_handle_option_ignore_interrupts = 475
+    helics_handle_option_ignore_interrupts = 475,
+    /** specify that a publication will only transmit the changed portions of a value after the first full
+       value (only applicable to publications)*/
+    helics_handle_option_delta_transmission = 482,
+    /** specify the operation used to combine the values of an input with multiple sources see \ref
+       helics_multi_input_mode*/
+    helics_handle_option_multi_input_handling_method = 507
 } helics_handle_options;
 
 /** enumeration of the predefined filter types*/
@@ -239,6 +247,22 @@ typedef enum {
 
 } helics_filter_type;
 
+/** enumeration of the operations used to combine the values of an input with multiple sources*/
+typedef enum {
+    /** no combination, the most recent value from any source is used*/
+    helics_multi_input_no_op = 0,
+    /** the values of all the sources are concatenated into a vector*/
+    helics_multi_input_vectorize_operation = 1,
+    /** the values of the sources are summed,  vectors are summed element by element*/
+    helics_multi_input_sum_operation = 4,
+    /** the maximum of the values of the sources,  vectors are compared element by element*/
+    helics_multi_input_max_operation = 6,
+    /** the minimum of the values of the sources,  vectors are compared element by element*/
+    helics_multi_input_min_operation = 7,
+    /** the average of the values of the sources,  vectors are averaged element by element*/
+    helics_multi_input_average_operation = 8
+} helics_multi_input_mode;
+
 #ifdef __cplusplus
 } /* end of extern "C" { */
 #endif
@@ -170,6 +170,24 @@ HELICS_EXPORT helics_message helicsEndpointGetMessage(helics_endpoint endpoint);
     @return a message object*/
 HELICS_EXPORT helics_message_object helicsEndpointGetMessageObject(helics_endpoint endpoint);
 
+/** receive all the pending messages of an endpoint
+    @details the message objects stay valid until they are freed with helicsMessageFree or the messages of the endpoint are
+    cleared
+    @param[in] endpoint the identifier for the endpoint
+    @param[out] messages the location to store the message objects
+    @param maxMessages the maximum number of messages to retrieve,  any others are left pending
+    @param[out] actualCount location to place the number of messages retrieved
+    @forcpponly
+    @param[in,out] err an error object to fill out in case of an error
+    @endforcpponly
+    */
+HELICS_EXPORT void helicsEndpointGetMessageObjects(
+    helics_endpoint endpoint,
+    helics_message_object messages[],
+    int maxMessages,
+    int* actualCount,
+    helics_error* err);
+
 /** receive a communication message for any endpoint in the federate
     @details the return order will be in order of endpoint creation.
     So all messages that are available for the first endpoint, then all for the second, and so on
@@ -184,8 +202,27 @@ HELICS_EXPORT helics_message helicsFederateGetMessage(helics_federate fed);
     @return a helics_message_object which references the data in the message*/
 HELICS_EXPORT helics_message_object helicsFederateGetMessageObject(helics_federate fed);
 
+/** receive all the pending messages of the federate
+    @details the messages are returned in the same order as helicsFederateGetMessageObject,  the message objects stay valid until
+    they are freed with helicsMessageFree or the messages of the federate are cleared
+    @param fed the federate to get the messages for
+    @param[out] messages the location to store the message objects
+    @param maxMessages the maximum number of messages to retrieve,  any others are left pending
+    @param[out] actualCount location to place the number of messages retrieved
+    @forcpponly
+    @param[in,out] err an error object to fill out in case of an error
+    @endforcpponly
+    */
+HELICS_EXPORT void helicsFederateGetMessageObjects(
+    helics_federate fed,
+    helics_message_object messages[],
+    int maxMessages,
+    int* actualCount,
+    helics_error* err);
+
 /** create a new empty message object
     @details, the message is empty and isValid will return false since there is no data associated with the message yet.
+    The storage of a freed message is reused if one is available.
     @return a helics_message_object containing the message data*/
 HELICS_EXPORT helics_message_object helicsFederateCreateMessageObject(helics_federate fed, helics_error* err);
 
@@ -198,6 +235,12 @@ HELICS_EXPORT void helicsFederateClearMessages(helics_federate fed);
     @param endpoint  the endpoint object to operate on
     */
 HELICS_EXPORT void helicsEndpointClearMessages(helics_endpoint endpoint);
+/** free a message object
+    @details the message is returned to the federate or endpoint it came from and its storage is reused for later messages,  the
+    message object and any pointers to its source, destination, or data are no longer valid after this call
+    @param message the message object to free
+    */
+HELICS_EXPORT void helicsMessageFree(helics_message_object message);
 
 /** get the type specified for an endpoint
     @param endpoint  the endpoint object in question
@@ -311,7 +354,8 @@ HELICS_EXPORT void
 
 /** get a pointer to the raw data of a message
     @param message a message object to get the data for
-    @return a pointer to the raw data in memory, the pointer may be NULL if the message is not a valid message
+    @return a pointer to the raw data in memory, the pointer may be NULL if the message is not a valid message,  it is valid
+    until the message is freed or cleared
     */
 HELICS_EXPORT void* helicsMessageGetRawDataPointer(helics_message_object message);
 /** a check if the message contains a valid payload
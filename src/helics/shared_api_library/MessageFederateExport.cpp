@@ -369,8 +369,90 @@ static helics_message emptyMessage()
     return empty;
 }
 
+/** fill a message structure from a message stored in a message holder
+@details the pointers refer to the stored message so they remain valid until it is freed or the holder is cleared*/
+static helics_message fillMessage(const helics::Message* message)
+{
+    if (message == nullptr) {
+        return emptyMessage();
+    }
+    helics_message mess;
+    mess.data = message->data.data();
+    mess.dest = message->dest.c_str();
+    mess.length = message->data.size();
+    mess.original_source = message->original_source.c_str();
+    mess.source = message->source.c_str();
+    mess.original_dest = message->original_dest.c_str();
+    mess.time = static_cast<helics_time>(message->time);
+    mess.flags = message->flags;
+    mess.messageID = message->messageID;
+    return mess;
+}
+
 static constexpr uint16_t messageKeyCode = 0xB3;
 
+namespace helics {
+Message* MessageHolder::addMessage(std::unique_ptr<Message> mess)
+{
+    if (!mess) {
+        return nullptr;
+    }
+    if (freeMessageSlots.empty()) {
+        mess->messageValidation = messageKeyCode;
+        mess->backReference = this;
+        mess->counter = static_cast<int32_t>(messages.size());
+        messages.push_back(std::move(mess));
+        return messages.back().get();
+    }
+    // move the contents into the pooled message so the message object in the slot is reused
+    auto* ptr = newMessage();
+    ptr->swap(*mess);
+    return ptr;
+}
+
+Message* MessageHolder::newMessage()
+{
+    if (freeMessageSlots.empty()) {
+        return addMessage(std::make_unique<Message>());
+    }
+    auto index = freeMessageSlots.back();
+    freeMessageSlots.pop_back();
+    auto* mess = messages[index].get();
+    mess->messageValidation = messageKeyCode;
+    mess->backReference = this;
+    mess->counter = index;
+    return mess;
+}
+
+void MessageHolder::freeMessage(int index)
+{
+    if (index < 0 || index >= static_cast<int>(messages.size())) {
+        return;
+    }
+    auto& mess = messages[index];
+    if (!mess || mess->messageValidation != messageKeyCode) {
+        return;
+    }
+    // the strings and data are cleared but keep their storage for the next message in the slot
+    mess->messageValidation = 0;
+    mess->time = timeZero;
+    mess->flags = 0;
+    mess->messageID = 0;
+    mess->data.resize(0);
+    mess->dest.clear();
+    mess->source.clear();
+    mess->original_source.clear();
+    mess->original_dest.clear();
+    freeMessageSlots.push_back(index);
+}
+
+void MessageHolder::clear()
+{
+    messages.clear();
+    freeMessageSlots.clear();
+}
+} // namespace helics
+
 helics_message helicsEndpointGetMessage(helics_endpoint endpoint)
 {
     auto endObj = verifyEndpoint(endpoint, nullptr);
@@ -378,22 +460,8 @@ helics_message helicsEndpointGetMessage(helics_endpoint endpoint)
         return emptyMessage();
     }
 
-    auto message = endObj->endPtr->getMessage();
-    if (message) {
-        helics_message mess;
-        mess.data = message->data.data();
-        mess.dest = message->dest.c_str();
-        mess.length = message->data.size();
-        mess.original_source = message->original_source.c_str();
-        mess.source = message->source.c_str();
-        mess.original_dest = message->original_dest.c_str();
-        mess.time = static_cast<helics_time>(message->time);
-        mess.flags = message->flags;
-        mess.messageID = message->messageID;
-        endObj->messages.push_back(std::move(message));
-        return mess;
-    }
-    return emptyMessage();
+    // the message may be moved into a pooled slot so the pointers must come from the stored message
+    return fillMessage(endObj->messages.addMessage(endObj->endPtr->getMessage()));
 }
 
 helics_message_object helicsEndpointGetMessageObject(helics_endpoint endpoint)
@@ -403,15 +471,44 @@ helics_message_object helicsEndpointGetMessageObject(helics_endpoint endpoint)
         return nullptr;
     }
 
-    auto message = endObj->endPtr->getMessage();
+    return endObj->messages.addMessage(endObj->endPtr->getMessage());
+}
 
-    if (message) {
-        message->messageValidation = messageKeyCode;
-        helics_message_object mess = message.get();
-        endObj->messages.push_back(std::move(message));
-        return mess;
+void helicsEndpointGetMessageObjects(
+    helics_endpoint endpoint,
+    helics_message_object messages[],
+    int maxMessages,
+    int* actualCount,
+    helics_error* err)
+{
+    if (actualCount != nullptr) {
+        *actualCount = 0;
+    }
+    auto endObj = verifyEndpoint(endpoint, err);
+    if (endObj == nullptr) {
+        return;
+    }
+    if ((messages == nullptr) || (maxMessages <= 0)) {
+        return;
+    }
+    int count = 0;
+    try {
+        while (count < maxMessages) {
+            auto mess = endObj->messages.addMessage(endObj->endPtr->getMessage());
+            if (mess == nullptr) {
+                break;
+            }
+            messages[count++] = mess;
+        }
+    }
+    // LCOV_EXCL_START
+    catch (...) {
+        helicsErrorHandler(err);
+    }
+    // LCOV_EXCL_STOP
+    if (actualCount != nullptr) {
+        *actualCount = count;
     }
-    return nullptr;
 }
 
 helics_message helicsFederateGetMessage(helics_federate fed)
@@ -423,23 +520,7 @@ helics_message helicsFederateGetMessage(helics_federate fed)
 
     auto fedObj = helics::getFedObject(fed, nullptr);
 
-    auto message = mFed->getMessage();
-
-    if (message) {
-        helics_message mess;
-        mess.data = message->data.data();
-        mess.dest = message->dest.c_str();
-        mess.length = message->data.size();
-        mess.original_source = message->original_source.c_str();
-        mess.source = message->source.c_str();
-        mess.original_dest = message->original_dest.c_str();
-        mess.time = static_cast<helics_time>(message->time);
-        mess.messageID = message->messageID;
-        mess.flags = message->flags;
-        fedObj->messages.push_back(std::move(message));
-        return mess;
-    }
-    return emptyMessage();
+    return fillMessage(fedObj->messages.addMessage(mFed->getMessage()));
 }
 
 helics_message_object helicsFederateGetMessageObject(helics_federate fed)
@@ -450,16 +531,45 @@ helics_message_object helicsFederateGetMessageObject(helics_federate fed)
     }
 
     auto fedObj = helics::getFedObject(fed, nullptr);
+    return fedObj->messages.addMessage(mFed->getMessage());
+}
 
-    auto message = mFed->getMessage();
-
-    if (message) {
-        message->messageValidation = messageKeyCode;
-        helics_message_object mess = message.get();
-        fedObj->messages.push_back(std::move(message));
-        return mess;
+void helicsFederateGetMessageObjects(
+    helics_federate fed,
+    helics_message_object messages[],
+    int maxMessages,
+    int* actualCount,
+    helics_error* err)
+{
+    if (actualCount != nullptr) {
+        *actualCount = 0;
+    }
+    auto mFed = getMessageFed(fed, err);
+    if (mFed == nullptr) {
+        return;
+    }
+    if ((messages == nullptr) || (maxMessages <= 0)) {
+        return;
+    }
+    auto fedObj = helics::getFedObject(fed, nullptr);
+    int count = 0;
+    try {
+        while (count < maxMessages) {
+            auto mess = fedObj->messages.addMessage(mFed->getMessage());
+            if (mess == nullptr) {
+                break;
+            }
+            messages[count++] = mess;
+        }
+    }
+    // LCOV_EXCL_START
+    catch (...) {
+        helicsErrorHandler(err);
+    }
+    // LCOV_EXCL_STOP
+    if (actualCount != nullptr) {
+        *actualCount = count;
     }
-    return nullptr;
 }
 
 helics_message_object helicsFederateCreateMessageObject(helics_federate fed, helics_error* err)
@@ -468,11 +578,7 @@ helics_message_object helicsFederateCreateMessageObject(helics_federate fed, hel
     if (fedObj == nullptr) {
         return nullptr;
     }
-    auto messptr = std::make_unique<helics::Message>();
-    messptr->messageValidation = messageKeyCode;
-    helics_message_object mess = messptr.get();
-    fedObj->messages.push_back(std::move(messptr));
-    return mess;
+    return fedObj->messages.newMessage();
 }
 
 void helicsFederateClearMessages(helics_federate fed)
@@ -496,6 +602,18 @@ void helicsEndpointClearMessages(helics_endpoint endpoint)
     endObj->messages.clear();
 }
 
+void helicsMessageFree(helics_message_object message)
+{
+    auto mess = getMessageObj(message, nullptr);
+    if (mess == nullptr) {
+        return;
+    }
+    auto holder = reinterpret_cast<helics::MessageHolder*>(mess->backReference);
+    if (holder != nullptr) {
+        holder->freeMessage(mess->counter);
+    }
+}
+
 /* this function has been removed but may be added back in the future
 helics_message_object helicsFederateGetLastMessage (helics_federate fed)
 {
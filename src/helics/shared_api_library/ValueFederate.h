@@ -667,20 +667,35 @@ HELICS_EXPORT const char* helicsPublicationGetInfo(helics_publication pub);
     @endforcpponly
     */
 HELICS_EXPORT void helicsPublicationSetInfo(helics_publication pub, const char* info, helics_error* err);
-/** get the data in the info field of an input
+/** get the current value of a flag option for an input
     @param inp the input to query
     @param option integer representation of the option in question see /ref helics_handle_options
-    @return a string with the info field string*/
+    @return helics_true if the option is set,  use /ref helicsInputGetOptionValue for options with other values*/
 HELICS_EXPORT helics_bool helicsInputGetOption(helics_input inp, int option);
-/** set the data in the info field for an input
-    @param inp the input to query
+/** set a flag option for an input
+    @param inp the input to modify
     @param option the option to set for the input /ref helics_handle_options
-    @param value the value to set the option to
+    @param value the value to set the option to,  use /ref helicsInputSetOptionValue for options with other values
     @forcpponly
     @param[in,out] err an error object to fill out in case of an error
     @endforcpponly
     */
 HELICS_EXPORT void helicsInputSetOption(helics_input inp, int option, helics_bool value, helics_error* err);
+/** get the integer value of an option for an input
+    @param inp the input to query
+    @param option integer representation of the option in question see /ref helics_handle_options
+    @return the value of the option,  for flag options this is 0 or 1*/
+HELICS_EXPORT int helicsInputGetOptionValue(helics_input inp, int option);
+/** set an option that takes an integer value for an input
+    @param inp the input to modify
+    @param option the option to set for the input /ref helics_handle_options
+    @param value the value to set the option to,  for helics_handle_option_multi_input_handling_method use a value
+    from /ref helics_multi_input_mode
+    @forcpponly
+    @param[in,out] err an error object to fill out in case of an error
+    @endforcpponly
+    */
+HELICS_EXPORT void helicsInputSetOptionValue(helics_input inp, int option, int value, helics_error* err);
 
 /** get the data in the info field of an publication
     @param pub the publication to query
@@ -734,6 +749,70 @@ HELICS_EXPORT int helicsFederateGetPublicationCount(helics_federate fed);
     @return (-1) if fed was not a valid federate otherwise returns the number of subscriptions*/
 HELICS_EXPORT int helicsFederateGetInputCount(helics_federate fed);
 
+/**
+     * \defgroup bulk Bulk value functions
+     @details functions operating on many inputs or publications of a federate in a single call,  inputs and
+     publications are identified by the same index used in helicsFederateGetInputByIndex and
+     helicsFederateGetPublicationByIndex
+     * @{
+     */
+
+/** get the indices of the inputs that have been updated since their values were last retrieved
+    @param fed the federate to query
+    @param[out] indices the location to store the input indices
+    @param maxIndices the maximum number of indices to store
+    @param[out] actualCount location to place the number of indices stored
+    @forcpponly
+    @param[in,out] err an error object that will contain an error code and string if any error occurred during the execution of the function
+    @endforcpponly
+    */
+HELICS_EXPORT void helicsFederateGetUpdatedInputIndices(
+    helics_federate fed,
+    int indices[],
+    int maxIndices,
+    int* actualCount,
+    helics_error* err);
+
+/** get the values of the updated inputs as doubles
+    @details the update flag of each input that is read is cleared,  if there are more updated inputs than maxValues
+    the remaining inputs are left as updated for the next call
+    @param fed the federate to query
+    @param[out] indices the location to store the index of each input read
+    @param[out] values the location to store the value of each input read
+    @param maxValues the maximum number of inputs to read,  both indices and values must have space for this many
+    @param[out] actualCount location to place the number of inputs read
+    @forcpponly
+    @param[in,out] err an error object that will contain an error code and string if any error occurred during the execution of the function
+    @endforcpponly
+    */
+HELICS_EXPORT void helicsFederateGetUpdatedInputDoubles(
+    helics_federate fed,
+    int indices[],
+    double values[],
+    int maxValues,
+    int* actualCount,
+    helics_error* err);
+
+/** publish a double value on each of a set of publications
+    @param fed the federate containing the publications
+    @param publicationIndices the indices of the publications to publish on
+    @param indexCount the number of publication indices
+    @param vectorInput the values to publish,  one for each publication index
+    @param vectorLength the number of values,  must match indexCount
+    @forcpponly
+    @param[in,out] err an error object that will contain an error code and string if any error occurred during the execution of the function
+    @endforcpponly
+    */
+HELICS_EXPORT void helicsFederatePublishDoubles(
+    helics_federate fed,
+    const int* publicationIndices,
+    int indexCount,
+    const double* vectorInput,
+    int vectorLength,
+    helics_error* err);
+
+/**@}*/
+
 #ifdef __cplusplus
 } /* end of extern "C" { */
 #endif
@@ -9,6 +9,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "ValueFederate.h"
 #include "internal/api_objects.h"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -1401,6 +1402,38 @@ void helicsInputSetOption(helics_input inp, int option, helics_bool value, helic
     // LCOV_EXCL_STOP
 }
 
+int helicsInputGetOptionValue(helics_input inp, int option)
+{
+    auto inpObj = verifyInput(inp, nullptr);
+    if (inpObj == nullptr) {
+        return 0;
+    }
+    try {
+        return inpObj->inputPtr->getOptionValue(option);
+    }
+    // LCOV_EXCL_START
+    catch (...) {
+        return 0;
+    }
+    // LCOV_EXCL_STOP
+}
+
+void helicsInputSetOptionValue(helics_input inp, int option, int value, helics_error* err)
+{
+    auto inpObj = verifyInput(inp, err);
+    if (inpObj == nullptr) {
+        return;
+    }
+    try {
+        inpObj->inputPtr->setOptionValue(option, value);
+    }
+    // LCOV_EXCL_START
+    catch (...) {
+        helicsErrorHandler(err);
+    }
+    // LCOV_EXCL_STOP
+}
+
 helics_bool helicsPublicationGetOption(helics_publication pub, int option)
 {
     auto pubObj = verifyPublication(pub, nullptr);
@@ -1513,3 +1546,147 @@ int helicsFederateGetInputCount(helics_federate fed)
     }
     return static_cast<int>(vfedObj->getInputCount());
 }
+
+static constexpr char nullUpdateIndexArray[] = "the update index array must not be null";
+static constexpr char nullUpdateArrays[] = "the update index and value arrays must not be null";
+static constexpr char invalidUpdateCount[] = "the maximum update count must be greater than 0";
+
+void helicsFederateGetUpdatedInputIndices(helics_federate fed, int indices[], int maxIndices, int* actualCount, helics_error* err)
+{
+    if (actualCount != nullptr) {
+        *actualCount = 0;
+    }
+    auto vfedObj = getValueFed(fed, err);
+    if (vfedObj == nullptr) {
+        return;
+    }
+    if (indices == nullptr) {
+        if (err != nullptr) {
+            err->error_code = helics_error_invalid_argument;
+            err->message = nullUpdateIndexArray;
+        }
+        return;
+    }
+    if (maxIndices <= 0) {
+        if (err != nullptr) {
+            err->error_code = helics_error_invalid_argument;
+            err->message = invalidUpdateCount;
+        }
+        return;
+    }
+    try {
+        auto updates = vfedObj->queryUpdates();
+        auto count = std::min(static_cast<int>(updates.size()), maxIndices);
+        std::copy(updates.begin(), updates.begin() + count, indices);
+        if (actualCount != nullptr) {
+            *actualCount = count;
+        }
+    }
+    // LCOV_EXCL_START
+    catch (...) {
+        helicsErrorHandler(err);
+    }
+    // LCOV_EXCL_STOP
+}
+
+void helicsFederateGetUpdatedInputDoubles(
+    helics_federate fed,
+    int indices[],
+    double values[],
+    int maxValues,
+    int* actualCount,
+    helics_error* err)
+{
+    if (actualCount != nullptr) {
+        *actualCount = 0;
+    }
+    auto vfedObj = getValueFed(fed, err);
+    if (vfedObj == nullptr) {
+        return;
+    }
+    if ((indices == nullptr) || (values == nullptr)) {
+        if (err != nullptr) {
+            err->error_code = helics_error_invalid_argument;
+            err->message = nullUpdateArrays;
+        }
+        return;
+    }
+    if (maxValues <= 0) {
+        if (err != nullptr) {
+            err->error_code = helics_error_invalid_argument;
+            err->message = invalidUpdateCount;
+        }
+        return;
+    }
+    int count = 0;
+    try {
+        auto updates = vfedObj->queryUpdates();
+        for (auto index : updates) {
+            if (count >= maxValues) {
+                break;
+            }
+            values[count] = vfedObj->getInput(index).getValue<double>();
+            indices[count] = index;
+            ++count;
+        }
+    }
+    catch (...) {
+        helicsErrorHandler(err);
+    }
+    if (actualCount != nullptr) {
+        *actualCount = count;
+    }
+}
+
+static constexpr char mismatchedValueCount[] = "the number of values must match the number of publication indices";
+static constexpr char nullPublishArrays[] = "the publication index and value arrays must not be null";
+
+void helicsFederatePublishDoubles(
+    helics_federate fed,
+    const int* publicationIndices,
+    int indexCount,
+    const double* vectorInput,
+    int vectorLength,
+    helics_error* err)
+{
+    auto vfedObj = getValueFed(fed, err);
+    if (vfedObj == nullptr) {
+        return;
+    }
+    if (indexCount != vectorLength) {
+        if (err != nullptr) {
+            err->error_code = helics_error_invalid_argument;
+            err->message = mismatchedValueCount;
+        }
+        return;
+    }
+    if (indexCount > 0 && (publicationIndices == nullptr || vectorInput == nullptr)) {
+        if (err != nullptr) {
+            err->error_code = helics_error_invalid_argument;
+            err->message = nullPublishArrays;
+        }
+        return;
+    }
+    try {
+        // resolve every index before publishing so a bad index publishes nothing
+        std::vector<helics::Publication*> pubs;
+        pubs.reserve(static_cast<size_t>(indexCount));
+        for (int ii = 0; ii < indexCount; ++ii) {
+            auto& pub = vfedObj->getPublication(publicationIndices[ii]);
+            if (!pub.isValid()) {
+                if (err != nullptr) {
+                    err->error_code = helics_error_invalid_argument;
+                    err->message = invalidPubIndex;
+                }
+                return;
+            }
+            pubs.push_back(&pub);
+        }
+        for (int ii = 0; ii < indexCount; ++ii) {
+            pubs[ii]->publish(vectorInput[ii]);
+        }
+    }
+    catch (...) {
+        helicsErrorHandler(err);
+    }
+}
@@ -15,6 +15,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <deque>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 /** this is a random identifier put in place when the federate or core or broker gets created*/
 static const int coreValidationIdentifier = 0x378424EC;
@@ -64,6 +65,26 @@ class InputObject;
 class PublicationObject;
 class EndpointObject;
 
+/** pool of the message objects handed out through the c-api
+@details each message is kept in a slot until it is freed,  freed slots are reused for later messages and a freed
+message created by the federate is reused along with its buffers so creating messages does not allocate*/
+class MessageHolder {
+  private:
+    std::vector<std::unique_ptr<Message>> messages; //!< the message slots
+    std::vector<int> freeMessageSlots; //!< the indices of the free slots
+  public:
+    /** store a message in the pool
+    @return a pointer to the stored message*/
+    Message* addMessage(std::unique_ptr<Message> mess);
+    /** get an empty message from the pool*/
+    Message* newMessage();
+    /** return a message to the pool
+    @param index the slot of the message*/
+    void freeMessage(int index);
+    /** free all the messages*/
+    void clear();
+};
+
 /** object wrapping a federate for the c-api*/
 class FedObject {
   public:
@@ -71,7 +92,7 @@ class FedObject {
     int index = -2;
     int valid = 0;
     std::shared_ptr<Federate> fedptr;
-    std::vector<std::unique_ptr<Message>> messages;
+    MessageHolder messages;
     std::vector<std::unique_ptr<InputObject>> inputs;
     std::vector<std::unique_ptr<PublicationObject>> pubs;
     std::vector<std::unique_ptr<EndpointObject>> epts;
@@ -103,7 +124,7 @@ class EndpointObject {
   public:
     Endpoint* endPtr = nullptr;
     std::shared_ptr<MessageFederate> fedptr;
-    std::vector<std::unique_ptr<Message>> messages;
+    MessageHolder messages;
     int valid = 0;
 };
 
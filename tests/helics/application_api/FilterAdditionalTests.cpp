@@ -9,6 +9,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/application_api/Filters.hpp"
 #include "helics/application_api/MessageFederate.hpp"
 #include "helics/application_api/MessageOperators.hpp"
+#include "helics/core/core-exceptions.hpp"
 #include "testFixtures.hpp"
 
 #include <future>
@@ -595,3 +596,63 @@ TEST_P(filter_type_tests, test_filter_info_field_ci_skip)
 }
 
 INSTANTIATE_TEST_SUITE_P(filter_tests, filter_type_tests, ::testing::ValuesIn(core_types));
+
+static std::unique_ptr<helics::Message> makeTestMessage(
+    const std::string& source,
+    const std::string& dest,
+    std::size_t size,
+    helics::Time time)
+{
+    auto mess = std::make_unique<helics::Message>();
+    mess->source = source;
+    mess->dest = dest;
+    mess->data = helics::data_block(size, 'a');
+    mess->time = time;
+    return mess;
+}
+
+TEST(filter_operation_tests, firewall_rules)
+{
+    helics::FirewallFilterOperation firewall;
+    auto op = firewall.getOperator();
+    // with no rules everything passes
+    EXPECT_TRUE((*op)(makeTestMessage("src", "dest", 5, 1.0)));
+
+    firewall.setString("block", "source=bad*");
+    firewall.setString("block", "dest=regex:^sec.*t$ maxtime=5");
+    firewall.setString("block", "source=src1 dest=dest1 minsize=10");
+
+    EXPECT_FALSE((*op)(makeTestMessage("badsource", "dest", 5, 1.0)));
+    EXPECT_TRUE((*op)(makeTestMessage("ba", "dest", 5, 1.0)));
+    EXPECT_FALSE((*op)(makeTestMessage("src", "secret", 5, 1.0)));
+    EXPECT_TRUE((*op)(makeTestMessage("src", "secret", 5, 6.0)));
+    EXPECT_FALSE((*op)(makeTestMessage("src1", "dest1", 15, 6.0)));
+    EXPECT_TRUE((*op)(makeTestMessage("src1", "dest1", 5, 6.0)));
+
+    // once there is an allow rule only matching messages pass
+    firewall.setString("allow", "dest=ok*");
+    EXPECT_TRUE((*op)(makeTestMessage("src1", "ok1", 5, 6.0)));
+    EXPECT_FALSE((*op)(makeTestMessage("src1", "notok", 5, 6.0)));
+    EXPECT_FALSE((*op)(makeTestMessage("badsource", "ok1", 5, 6.0)));
+
+    EXPECT_THROW(firewall.setString("allow", "dest=regex:(("), helics::InvalidParameter);
+    EXPECT_THROW(firewall.setString("allow", "unknown"), helics::InvalidParameter);
+    EXPECT_THROW(firewall.setString("allow", "minsize=1x"), helics::InvalidParameter);
+
+    firewall.setString("clear", std::string{});
+    EXPECT_TRUE((*op)(makeTestMessage("badsource", "notok", 5, 1.0)));
+}
+
+TEST(filter_operation_tests, reroute_destination_template)
+{
+    helics::RerouteFilterOperation reroute;
+    reroute.setString("newdestination", "${source}_${dest}_${dest}");
+    reroute.setString("condition", "end");
+    auto op = reroute.getOperator();
+
+    auto mess = (*op)(makeTestMessage("port1", "endpt2", 5, 1.0));
+    EXPECT_EQ(mess->dest, "port1_endpt2_endpt2");
+    mess = (*op)(makeTestMessage("port1", "other", 5, 1.0));
+    EXPECT_EQ(mess->dest, "other");
+    EXPECT_THROW(reroute.setString("condition", "(("), helics::InvalidParameter);
+}
@@ -84,7 +84,7 @@ TEST(type_conversion_tests, double_conversion_tests)
 {
     double val = 45.786;
     EXPECT_TRUE(checkTypeConversion1(val, val));
-    EXPECT_TRUE(checkTypeConversion1(val, std::to_string(val)));
+    EXPECT_TRUE(checkTypeConversion1(val, "45.786"s));
     EXPECT_TRUE(checkTypeConversion1(val, static_cast<int64_t>(val)));
     EXPECT_TRUE(checkTypeConversion1(val, static_cast<float>(val)));
     EXPECT_TRUE(checkTypeConversion1(val, std::complex<double>(val, 0)));
@@ -175,7 +175,7 @@ TEST(type_conversion_tests, namedpoint_conversion_tests)
     EXPECT_TRUE(checkTypeConversion1(
         vp, std::vector<std::complex<double>>{std::complex<double>(val, 0.0)}));
     EXPECT_TRUE(checkTypeConversion1(vp, true));
-    EXPECT_TRUE(checkTypeConversion1(vp, std::string("{\"point\":" + std::to_string(val) + "}")));
+    EXPECT_TRUE(checkTypeConversion1(vp, "{\"point\":45.786}"s));
 
     NamedPoint vp2{"v2[3.0,-4.0]", std::nan("0")};
     double v2 = 5.0;
@@ -196,3 +196,42 @@ TEST(type_conversion_tests, namedpoint_conversion_tests)
     EXPECT_EQ(t1.name, t2.name);
     EXPECT_NEAR(t1.value, t2.value, 0.00001);
 }
+
+TEST(type_conversion_tests, string_round_trip)
+{
+    std::vector<double> vals{
+        0.1, -1.0 / 3.0, 2.0, 6.02214076e23, -1.602176634e-19, 123456.789012345678};
+    for (auto val : vals) {
+        EXPECT_EQ(
+            getDoubleFromString(typeConvert(data_type::helics_string, val).to_string()),
+            std::abs(val));
+    }
+    EXPECT_EQ(helicsGetVector(helicsVectorString(vals)), vals);
+
+    std::vector<std::complex<double>> cvals{{0.1, -0.2}, {1.0 / 3.0, 2.0 / 3.0}, {-5.5, 0.0}};
+    EXPECT_EQ(helicsGetComplexVector(helicsComplexVectorString(cvals)), cvals);
+    for (const auto& cval : cvals) {
+        EXPECT_EQ(helicsGetComplex(helicsComplexString(cval)), cval);
+    }
+
+    NamedPoint np{"point", 1.0 / 7.0};
+    EXPECT_EQ(helicsGetNamedPoint(helicsNamedPointString(np)).value, np.value);
+}
+
+TEST(type_conversion_tests, string_formats)
+{
+    EXPECT_EQ(helicsVectorString(std::vector<double>{3.1, -2.0, 1e-7}), "v3[3.1; -2; 1e-07]");
+    EXPECT_EQ(helicsVectorString(std::vector<double>()), "v0[]");
+    EXPECT_EQ(helicsComplexString(1.5, -2.0), "1.5 -2j");
+    EXPECT_EQ(helicsComplexString(1.5, 0.25), "1.5+0.25j");
+    EXPECT_EQ(helicsComplexString(1.5, 0.0), "1.5");
+    EXPECT_EQ(helicsNamedPointString("pt", 0.125), "{\"pt\":0.125}");
+
+    EXPECT_EQ(helicsGetComplex("2.5j"), std::complex<double>(0.0, 2.5));
+    EXPECT_EQ(helicsGetComplex(" -1.25e2 - 3i"), std::complex<double>(-125.0, -3.0));
+    EXPECT_LT(helicsGetComplex("not a number").real(), invalidDouble);
+    EXPECT_EQ(helicsGetVector("v3[1, 2.5;-3e1]"), (std::vector<double>{1.0, 2.5, -30.0}));
+    EXPECT_EQ(
+        helicsGetComplexVector("v4[1,2,3,4]"),
+        (std::vector<std::complex<double>>{{1.0, 2.0}, {3.0, 4.0}}));
+}
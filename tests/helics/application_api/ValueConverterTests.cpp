@@ -5,6 +5,7 @@ the top-level NOTICE for additional details. All rights reserved.
 SPDX-License-Identifier: BSD-3-Clause
 */
 
+#include <algorithm>
 #include <complex>
 #include <gtest/gtest.h>
 #include <list>
@@ -15,6 +16,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/application_api/ValueConverter.hpp"
 #include "helics/application_api/ValueConverter_impl.hpp"
 #include "helics/application_api/data_view.hpp"
+#include "helics/core/NativeVectorLayout.hpp"
 #include "helics/core/core-data.hpp"
 
 using namespace std::string_literals;
@@ -197,6 +199,74 @@ TEST(valueConverter_tests, block_vectors)
     EXPECT_EQ(9999, helics::ValueConverter<int>::interpret(res2[3]));
 }
 
+TEST(valueConverter_tests, native_vectors)
+{
+    using vecd = std::vector<double>;
+    using vecc = std::vector<std::complex<double>>;
+    vecd vec1 = {45.4, 23.4, -45.2, 34.2234234};
+    converterTests<vecd>(vec1, vecd{}, 8 + 4 * sizeof(double), 8, "double_vector");
+    vecc cvec{{1.0, -2.0}, {3.5, 0.25}};
+    converterTests<vecc>(cvec, vecc{}, 8 + 2 * sizeof(std::complex<double>), 8);
+
+    // a pointer to doubles generates the same layout as a vector
+    auto db1 = helics::ValueConverter<double>::convert(vec1.data(), vec1.size());
+    auto db2 = helics::ValueConverter<vecd>::convert(vec1);
+    EXPECT_EQ(db1.to_string(), db2.to_string());
+
+    // a double vector is not a valid complex vector
+    EXPECT_THROW(helics::ValueConverter<vecc>::interpret(db2), std::invalid_argument);
+}
+
+TEST(valueConverter_tests, native_vector_byte_order)
+{
+    std::vector<double> vec1 = {45.4, 23.4, -45.2, 34.2234234};
+    auto db = helics::ValueConverter<std::vector<double>>::convert(vec1);
+    // convert the block to the opposite byte order
+    db[1] = (db[1] == 0) ? 1 : 0;
+    std::reverse(db.data() + 4, db.data() + 8);
+    for (size_t ii = 8; ii < db.size(); ii += sizeof(double)) {
+        std::reverse(db.data() + ii, db.data() + ii + sizeof(double));
+    }
+    EXPECT_EQ(helics::ValueConverter<std::vector<double>>::interpret(db), vec1);
+
+    auto view = helics::data_view(db).doubleVector();
+    EXPECT_NE(reinterpret_cast<const char*>(view.data()), db.data() + 8);
+    EXPECT_EQ(view.to_vector(), vec1);
+}
+
+TEST(valueConverter_tests, native_vector_count_limit)
+{
+    char header[helics::native_vector::headerSize];
+    helics::native_vector::writeHeader(header, 0xFFFFFFFFU, sizeof(double));
+    size_t count{0};
+    bool swap{true};
+    EXPECT_FALSE(
+        helics::native_vector::readHeader(header, sizeof(header), sizeof(double), count, swap));
+    EXPECT_EQ(count, 0xFFFFFFFFU);
+    EXPECT_FALSE(swap);
+    if (sizeof(size_t) > sizeof(std::uint32_t)) {
+        // the count is not truncated into a corrupt header
+        EXPECT_THROW(
+            helics::native_vector::writeHeader(
+                header, static_cast<size_t>(0xFFFFFFFFU) + 1U, sizeof(double)),
+            std::invalid_argument);
+    }
+}
+
+TEST(valueConverter_tests, archive_vector_compatibility)
+{
+    // vectors written by the portable binary archive are still readable
+    std::vector<double> vec1 = {45.4, 23.4, -45.2};
+    helics::detail::ostringbufstream s;
+    archiver oa(s);
+    oa(vec1);
+    s.flush();
+    helics::data_block db(s.extractString());
+    EXPECT_EQ(db.size(), 9 + 3 * sizeof(double));
+    EXPECT_EQ(helics::ValueConverter<std::vector<double>>::interpret(db), vec1);
+    EXPECT_EQ(helics::data_view(db).doubleVector().to_vector(), vec1);
+}
+
 /** check that the converters do actually throw on invalid sizes*/
 TEST(valueConverter_tests, errors)
 {
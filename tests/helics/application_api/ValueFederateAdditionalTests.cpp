@@ -293,6 +293,34 @@ TEST_P(valuefed_add_single_type_tests_ci_skip, single_transfer)
     EXPECT_EQ(s, "string2");
 }
 
+TEST_P(valuefed_add_single_type_tests_ci_skip, fan_out_transfer)
+{
+    SetupTest<helics::ValueFederate>(GetParam(), 1);
+    auto vFed1 = GetFederateAs<helics::ValueFederate>(0);
+
+    auto pubid = vFed1->registerGlobalPublication<std::string>("pub1");
+    auto sub1 = vFed1->registerSubscription("pub1");
+    auto sub2 = vFed1->registerSubscription("pub1");
+    auto sub3 = vFed1->registerSubscription("pub1");
+    vFed1->setProperty(helics_property_time_delta, 1.0);
+    vFed1->enterExecutingMode();
+    // small values are copied to each subscriber, large ones share a buffer
+    const std::string smallValue = "small";
+    const std::string largeValue(500, 'L');
+    vFed1->publish(pubid, smallValue);
+    vFed1->requestTime(1.0);
+    EXPECT_EQ(vFed1->getString(sub1), smallValue);
+    EXPECT_EQ(vFed1->getString(sub2), smallValue);
+    EXPECT_EQ(vFed1->getString(sub3), smallValue);
+
+    vFed1->publish(pubid, largeValue);
+    vFed1->requestTime(2.0);
+    EXPECT_EQ(vFed1->getString(sub1), largeValue);
+    EXPECT_EQ(vFed1->getString(sub2), largeValue);
+    EXPECT_EQ(vFed1->getString(sub3), largeValue);
+    vFed1->finalize();
+}
+
 TEST_P(valuefed_add_all_type_tests_ci_skip, dual_transfer_string)
 {
     // this one is going to test really ugly strings
@@ -358,6 +386,136 @@ TEST_P(valuefed_add_type_tests_ci_skip, dual_transfer_types_obj11)
     runDualFederateTestObj<bool>(GetParam(), true, false, true);
 }
 
+TEST_P(valuefed_add_type_tests_ci_skip, delta_vector_transfer)
+{
+    SetupTest<helics::ValueFederate>(GetParam(), 2, 1.0);
+    auto vFed1 = GetFederateAs<helics::ValueFederate>(0);
+    auto vFed2 = GetFederateAs<helics::ValueFederate>(1);
+
+    auto& pub = vFed1->registerGlobalPublication<std::vector<double>>("pub1");
+    pub.setOption(helics_handle_option_delta_transmission);
+    auto& sub = vFed2->registerSubscription("pub1");
+
+    vFed1->enterExecutingModeAsync();
+    vFed2->enterExecutingMode();
+    vFed1->enterExecutingModeComplete();
+
+    std::vector<double> value(10000, 1.0);
+    for (int ii = 1; ii <= 10; ++ii) {
+        // only a few elements change each step so most transmissions are deltas
+        value[ii * 37] = static_cast<double>(ii);
+        value[9999 - ii] = -static_cast<double>(ii);
+        pub.publish(value);
+        vFed1->requestTimeAsync(ii);
+        vFed2->requestTime(ii);
+        vFed1->requestTimeComplete();
+        EXPECT_TRUE(sub.isUpdated());
+        EXPECT_EQ(sub.getValue<std::vector<double>>(), value);
+    }
+    vFed1->finalizeAsync();
+    vFed2->finalize();
+    vFed1->finalizeComplete();
+}
+
+TEST_P(valuefed_add_type_tests_ci_skip, vector_view_transfer)
+{
+    SetupTest<helics::ValueFederate>(GetParam(), 2, 1.0);
+    auto vFed1 = GetFederateAs<helics::ValueFederate>(0);
+    auto vFed2 = GetFederateAs<helics::ValueFederate>(1);
+
+    auto& pub = vFed1->registerGlobalPublication<std::vector<double>>("pub1");
+    auto& sub = vFed2->registerSubscription("pub1");
+
+    vFed1->enterExecutingModeAsync();
+    vFed2->enterExecutingMode();
+    vFed1->enterExecutingModeComplete();
+
+    std::vector<double> value(1000, 2.5);
+    value[45] = -1.0;
+    pub.publish(value);
+    vFed1->requestTimeAsync(1.0);
+    vFed2->requestTime(1.0);
+    vFed1->requestTimeComplete();
+    EXPECT_TRUE(sub.isUpdated());
+    auto view = sub.getVectorView();
+    EXPECT_FALSE(sub.isUpdated());
+    ASSERT_EQ(view.size(), value.size());
+    EXPECT_EQ(view.to_vector(), value);
+    // the view references the received data
+    auto raw = sub.getRawValue();
+    EXPECT_EQ(reinterpret_cast<const char*>(view.data()), raw.data() + 8);
+    // a value read after the view still reflects the latest update
+    EXPECT_EQ(sub.getValue<std::vector<double>>(), value);
+    EXPECT_EQ(sub.getVectorSize(), value.size());
+
+    value[45] = 3.0;
+    pub.publish(value);
+    vFed1->requestTimeAsync(2.0);
+    vFed2->requestTime(2.0);
+    vFed1->requestTimeComplete();
+    auto view2 = sub.getVectorView();
+    EXPECT_EQ(view2[45], 3.0);
+    // the earlier view still holds the earlier value
+    EXPECT_EQ(view[45], -1.0);
+    EXPECT_EQ(sub.getValue<std::vector<double>>(), value);
+
+    vFed1->finalizeAsync();
+    vFed2->finalize();
+    vFed1->finalizeComplete();
+}
+
+TEST_P(valuefed_add_type_tests_ci_skip, multi_input_sum)
+{
+    SetupTest<helics::ValueFederate>(GetParam(), 2, 1.0);
+    auto vFed1 = GetFederateAs<helics::ValueFederate>(0);
+    auto vFed2 = GetFederateAs<helics::ValueFederate>(1);
+
+    auto& pub1 = vFed1->registerGlobalPublication<double>("pub1");
+    auto& pub2 = vFed1->registerGlobalPublication<double>("pub2");
+    auto& pub3 = vFed1->registerGlobalPublication<int64_t>("pub3");
+    auto& inp = vFed2->registerInput<double>("sum");
+    inp.addTarget("pub1");
+    inp.addTarget("pub2");
+    inp.addTarget("pub3");
+    inp.setOptionValue(
+        helics_handle_option_multi_input_handling_method, helics_multi_input_sum_operation);
+    EXPECT_EQ(
+        inp.getOptionValue(helics_handle_option_multi_input_handling_method),
+        helics_multi_input_sum_operation);
+    // the flag form of the getter only reports whether the option is set
+    EXPECT_TRUE(inp.getOption(helics_handle_option_multi_input_handling_method));
+    EXPECT_THROW(
+        inp.setOptionValue(helics_handle_option_multi_input_handling_method, 3),
+        helics::InvalidParameter);
+    EXPECT_EQ(
+        inp.getOptionValue(helics_handle_option_multi_input_handling_method),
+        helics_multi_input_sum_operation);
+
+    vFed1->enterExecutingModeAsync();
+    vFed2->enterExecutingMode();
+    vFed1->enterExecutingModeComplete();
+
+    pub1.publish(1.5);
+    pub2.publish(2.0);
+    pub3.publish(int64_t(4));
+    vFed1->requestTimeAsync(1.0);
+    vFed2->requestTime(1.0);
+    vFed1->requestTimeComplete();
+    EXPECT_TRUE(inp.isUpdated());
+    EXPECT_DOUBLE_EQ(inp.getValue<double>(), 7.5);
+
+    // a single source update is combined with the previous values of the others
+    pub2.publish(-3.0);
+    vFed1->requestTimeAsync(2.0);
+    vFed2->requestTime(2.0);
+    vFed1->requestTimeComplete();
+    EXPECT_TRUE(inp.isUpdated());
+    EXPECT_DOUBLE_EQ(inp.getValue<double>(), 2.5);
+    vFed1->finalizeAsync();
+    vFed2->finalize();
+    vFed1->finalizeComplete();
+}
+
 /** test the callback specification with a vector list*/
 
 TEST_P(valuefed_add_single_type_tests_ci_skip, vector_callback_lists)
@@ -9,6 +9,7 @@ SPDX-License-Identifier: BSD-3-Clause
 /** these test cases test data_block and data_view objects
  */
 
+#include "helics/application_api/ValueConverter.hpp"
 #include "helics/application_api/data_view.hpp"
 
 using namespace helics;
@@ -119,3 +120,30 @@ TEST(data_view_tests, shared_ptr)
     EXPECT_EQ(dv1.size(), sz1);
     EXPECT_EQ(dv1[67], checkel);
 }
+
+/** test viewing a vector in place*/
+TEST(data_view_tests, vector_view)
+{
+    std::vector<double> vals(1000, 3.5);
+    vals[10] = -2.0;
+    auto db = std::make_shared<data_block>(ValueConverter<std::vector<double>>::convert(vals));
+    data_view dv1(db);
+    auto view = dv1.doubleVector();
+    ASSERT_EQ(view.size(), vals.size());
+    EXPECT_EQ(view[10], -2.0);
+    EXPECT_EQ(view.back(), 3.5);
+    // no copy was made
+    EXPECT_EQ(reinterpret_cast<const char*>(view.data()), db->data() + 8);
+
+    db = nullptr;
+    dv1 = data_view();
+    // the view keeps the data alive
+    EXPECT_EQ(view[10], -2.0);
+    EXPECT_EQ(view.to_vector(), vals);
+
+    std::vector<std::complex<double>> cvals{{1.0, 2.0}, {-3.0, 4.5}};
+    auto cblock = ValueConverter<std::vector<std::complex<double>>>::convert(cvals);
+    auto cview = data_view(cblock).complexVector();
+    ASSERT_EQ(cview.size(), 2u);
+    EXPECT_EQ(cview[1], std::complex<double>(-3.0, 4.5));
+}
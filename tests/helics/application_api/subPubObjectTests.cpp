@@ -149,7 +149,7 @@ void runPubSubThroughTypeTests(const TX& valtx, const RX& valrx)
 TEST(subscriptionObject, type_tests)
 {
     runPubSubTypeTests<std::string, double>("3.14159", 3.14159);
-    runPubSubTypeTests<double, std::string>(3.14159, std::to_string(3.141590));
+    runPubSubTypeTests<double, std::string>(3.14159, "3.14159");
 }
 
 TEST(subscriptionObject, type_tests_ci_skip)
@@ -9,10 +9,18 @@ SPDX-License-Identifier: BSD-3-Clause
 #ifndef DISABLE_SYSTEM_CALL_TESTS
 #    include "exeTestHelper.h"
 #endif
+#ifdef _MSC_VER
+#    pragma warning(push, 0)
+#    include "helics/external/filesystem.hpp"
+#    pragma warning(pop)
+#else
+#    include "helics/external/filesystem.hpp"
+#endif
 #include "helics/application_api/Subscriptions.hpp"
 #include "helics/apps/BrokerApp.hpp"
 #include "helics/apps/Player.hpp"
 
+#include <fstream>
 #include <future>
 
 TEST(player_tests, simple_player_test)
@@ -289,6 +297,163 @@ TEST(player_tests, simple_player_mlinecomment)
     EXPECT_EQ(play1.publicationCount(), 2u);
 }
 
+TEST(player_tests, simple_player_stream)
+{
+    helics::FederateInfo fi(helics::core_type::TEST);
+    fi.coreName = "pcore6-stream";
+    fi.coreInitString = " -f 2 --autobroker";
+    helics::apps::Player play1("player1", fi);
+    play1.enableStreamingInput();
+    play1.loadFile(std::string(TEST_DIR) + "/example_sorted.player");
+
+    EXPECT_EQ(play1.pointCount(), 7u);
+    EXPECT_EQ(play1.messageCount(), 2u);
+    helics::CombinationFederate cfed("block1", fi);
+    auto& sub1 = cfed.registerSubscription("pub1");
+    auto& sub2 = cfed.registerSubscription("pub2");
+    helics::Endpoint e1(helics::GLOBAL, &cfed, "dest");
+    auto fut = std::async(std::launch::async, [&play1]() { play1.run(); });
+    cfed.enterExecutingMode();
+    auto val = sub1.getValue<double>();
+    EXPECT_EQ(val, 0.3);
+
+    auto retTime = cfed.requestTime(5);
+    EXPECT_EQ(retTime, 1.0);
+    val = sub1.getValue<double>();
+    EXPECT_EQ(val, 0.5);
+    val = sub2.getValue<double>();
+    EXPECT_DOUBLE_EQ(val, 0.4);
+    auto mess = e1.getMessage();
+    EXPECT_TRUE(mess);
+    if (mess) {
+        EXPECT_EQ(mess->data.to_string(), "this is a test message");
+    }
+
+    retTime = cfed.requestTime(5);
+    EXPECT_EQ(retTime, 2.0);
+    val = sub1.getValue<double>();
+    EXPECT_EQ(val, 0.7);
+    val = sub2.getValue<double>();
+    EXPECT_EQ(val, 0.6);
+    mess = e1.getMessage();
+    EXPECT_TRUE(mess);
+    if (mess) {
+        EXPECT_EQ(mess->data.to_string(), "this is test message2");
+    }
+
+    retTime = cfed.requestTime(5);
+    EXPECT_EQ(retTime, 3.0);
+    val = sub1.getValue<double>();
+    EXPECT_EQ(val, 0.8);
+    val = sub2.getValue<double>();
+    EXPECT_EQ(val, 0.9);
+
+    retTime = cfed.requestTime(5);
+    EXPECT_EQ(retTime, 5.0);
+    cfed.finalize();
+    fut.get();
+    EXPECT_EQ(play1.publicationCount(), 2u);
+    EXPECT_EQ(play1.endpointCount(), 1u);
+}
+
+// a streamed file read in small blocks is played in order across the blocks and a resumed runTo
+TEST(player_tests, player_stream_blocks)
+{
+    auto filename = ghc::filesystem::temp_directory_path() / "stream_blocks.player";
+    {
+        std::ofstream out(filename.string());
+        out << "#second    topic    type    value\n";
+        for (int ii = 1; ii <= 60; ++ii) {
+            out << ii << " pub1 d " << ii * 2 << '\n';
+            if (ii % 10 == 0) {
+                out << "m " << ii << " src dest \"message " << ii << "\"\n";
+            }
+        }
+    }
+    helics::FederateInfo fi(helics::core_type::TEST);
+    fi.coreName = "pcore7-stream";
+    fi.coreInitString = " -f 2 --autobroker";
+    helics::apps::Player play1("player1", fi);
+    play1.enableStreamingInput();
+    play1.setStreamingBlockSize(7);
+    play1.loadFile(filename.string());
+
+    EXPECT_EQ(play1.pointCount(), 60u);
+    EXPECT_EQ(play1.messageCount(), 6u);
+    helics::CombinationFederate cfed("block1", fi);
+    auto& sub1 = cfed.registerSubscription("pub1");
+    helics::Endpoint e1(helics::GLOBAL, &cfed, "dest");
+    auto fut = std::async(std::launch::async, [&play1]() { play1.runTo(25); });
+    cfed.enterExecutingMode();
+    for (int ii = 1; ii <= 60; ++ii) {
+        if (ii == 26) {
+            fut.get();
+            // run resumes from the time reached by the first runTo
+            fut = std::async(std::launch::async, [&play1]() { play1.run(); });
+        }
+        auto retTime = cfed.requestTime(100);
+        EXPECT_EQ(retTime, static_cast<double>(ii));
+        EXPECT_EQ(sub1.getValue<double>(), ii * 2.0);
+        if (ii % 10 == 0) {
+            auto mess = e1.getMessage();
+            ASSERT_TRUE(mess);
+            EXPECT_EQ(mess->data.to_string(), "message " + std::to_string(ii));
+        }
+        EXPECT_FALSE(e1.hasMessage());
+    }
+    auto retTime = cfed.requestTime(100);
+    EXPECT_EQ(retTime, 100.0);
+    cfed.finalize();
+    fut.get();
+    ghc::filesystem::remove(filename);
+}
+
+// a file that is not sorted by time is loaded into memory instead of streamed
+TEST(player_tests, player_stream_unsorted)
+{
+    auto filename = ghc::filesystem::temp_directory_path() / "stream_unsorted.player";
+    {
+        std::ofstream out(filename.string());
+        out << "3 pub1 d 0.8\n";
+        out << "1 pub1 d 0.5\n";
+        out << "m 2.0 src dest \"this is a test message\"\n";
+        out << "2 pub1 d 0.7\n";
+    }
+    helics::FederateInfo fi(helics::core_type::TEST);
+    fi.coreName = "pcore8-stream";
+    fi.coreInitString = " -f 2 --autobroker";
+    helics::apps::Player play1("player1", fi);
+    play1.enableStreamingInput();
+    play1.setStreamingBlockSize(1);
+    play1.loadFile(filename.string());
+
+    EXPECT_EQ(play1.pointCount(), 3u);
+    EXPECT_EQ(play1.messageCount(), 1u);
+    helics::CombinationFederate cfed("block1", fi);
+    auto& sub1 = cfed.registerSubscription("pub1");
+    helics::Endpoint e1(helics::GLOBAL, &cfed, "dest");
+    auto fut = std::async(std::launch::async, [&play1]() { play1.run(); });
+    cfed.enterExecutingMode();
+    auto retTime = cfed.requestTime(5);
+    EXPECT_EQ(retTime, 1.0);
+    EXPECT_EQ(sub1.getValue<double>(), 0.5);
+
+    retTime = cfed.requestTime(5);
+    EXPECT_EQ(retTime, 2.0);
+    EXPECT_EQ(sub1.getValue<double>(), 0.7);
+    EXPECT_TRUE(e1.hasMessage());
+
+    retTime = cfed.requestTime(5);
+    EXPECT_EQ(retTime, 3.0);
+    EXPECT_EQ(sub1.getValue<double>(), 0.8);
+
+    retTime = cfed.requestTime(5);
+    EXPECT_EQ(retTime, 5.0);
+    cfed.finalize();
+    fut.get();
+    ghc::filesystem::remove(filename);
+}
+
 #ifdef ENABLE_IPC_CORE
 TEST_P(player_file_tests, test_files_cmd)
 {
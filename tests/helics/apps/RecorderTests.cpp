@@ -20,6 +20,7 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "helics/application_api/Publications.hpp"
 #include "helics/apps/BrokerApp.hpp"
+#include "helics/apps/RecordLog.hpp"
 #include "helics/apps/Recorder.hpp"
 
 #include <cstdio>
@@ -83,11 +84,11 @@ TEST(recorder_tests, simple_recorder_test2)
     rec1.finalize();
     auto v1 = rec1.getValue(0);
     EXPECT_EQ(v1.first, "pub1");
-    EXPECT_EQ(v1.second, std::to_string(3.4));
+    EXPECT_EQ(v1.second, "3.4");
 
     v1 = rec1.getValue(1);
     EXPECT_EQ(v1.first, "pub1");
-    EXPECT_EQ(v1.second, std::to_string(4.7));
+    EXPECT_EQ(v1.second, "4.7");
 
     v1 = rec1.getValue(2);
     EXPECT_EQ(v1.first, std::string());
@@ -97,6 +98,46 @@ TEST(recorder_tests, simple_recorder_test2)
     EXPECT_TRUE(!m2);
 }
 
+TEST(recorder_tests, recorder_test_sparse_updates)
+{
+    helics::FederateInfo fi(helics::core_type::TEST);
+    fi.coreName = "rcore1-sparse";
+    fi.coreInitString = "-f 2 --autobroker";
+    helics::apps::Recorder rec1("rec1", fi);
+    rec1.addSubscription("pub1");
+    rec1.addSubscription("pub2");
+    rec1.addSubscription("pub3");
+
+    helics::ValueFederate vfed("block1", fi);
+    helics::Publication pub1(helics::GLOBAL, &vfed, "pub1", helics::data_type::helics_double);
+    helics::Publication pub2(helics::GLOBAL, &vfed, "pub2", helics::data_type::helics_int);
+    helics::Publication pub3(helics::GLOBAL, &vfed, "pub3", helics::data_type::helics_string);
+    auto fut = std::async(std::launch::async, [&rec1]() { rec1.runTo(4); });
+    vfed.enterExecutingMode();
+    auto retTime = vfed.requestTime(1);
+    EXPECT_EQ(retTime, 1.0);
+    pub2.publish(int64_t(7));
+
+    retTime = vfed.requestTime(2.0);
+    EXPECT_EQ(retTime, 2.0);
+    pub3.publish("hello");
+
+    retTime = vfed.requestTime(5);
+    EXPECT_EQ(retTime, 5.0);
+
+    vfed.finalize();
+    fut.get();
+    rec1.finalize();
+    EXPECT_EQ(rec1.pointCount(), 2u);
+    auto v1 = rec1.getValue(0);
+    EXPECT_EQ(v1.first, "pub2");
+    EXPECT_EQ(v1.second, "7");
+
+    v1 = rec1.getValue(1);
+    EXPECT_EQ(v1.first, "pub3");
+    EXPECT_EQ(v1.second, "hello");
+}
+
 TEST(recorder_tests, recorder_test_message)
 {
     helics::FederateInfo fi(helics::core_type::TEST);
@@ -170,18 +211,18 @@ TEST_P(recorder_file_tests, test_files)
     EXPECT_EQ(rec1.pointCount(), 4u);
     auto v1 = rec1.getValue(0);
     EXPECT_EQ(v1.first, "pub1");
-    EXPECT_EQ(v1.second, std::to_string(3.4));
+    EXPECT_EQ(v1.second, "3.4");
     v1 = rec1.getValue(1);
     EXPECT_EQ(v1.first, "pub2");
-    EXPECT_EQ(v1.second, std::to_string(5.7));
+    EXPECT_EQ(v1.second, "5.7");
 
     v1 = rec1.getValue(2);
     EXPECT_EQ(v1.first, "pub1");
-    EXPECT_EQ(v1.second, std::to_string(4.7));
+    EXPECT_EQ(v1.second, "4.7");
 
     v1 = rec1.getValue(3);
     EXPECT_EQ(v1.first, "pub2");
-    EXPECT_EQ(v1.second, std::to_string(3.9));
+    EXPECT_EQ(v1.second, "3.9");
 }
 
 static constexpr const char* simple_files[] = {"example1.recorder",
@@ -245,18 +286,18 @@ TEST_P(recorder_message_file_tests, test_message_files)
 
     auto v1 = rec1.getValue(0);
     EXPECT_EQ(v1.first, "pub1");
-    EXPECT_EQ(v1.second, std::to_string(3.4));
+    EXPECT_EQ(v1.second, "3.4");
     v1 = rec1.getValue(1);
     EXPECT_EQ(v1.first, "pub2");
-    EXPECT_EQ(v1.second, std::to_string(5.7));
+    EXPECT_EQ(v1.second, "5.7");
 
     v1 = rec1.getValue(2);
     EXPECT_EQ(v1.first, "pub1");
-    EXPECT_EQ(v1.second, std::to_string(4.7));
+    EXPECT_EQ(v1.second, "4.7");
 
     v1 = rec1.getValue(3);
     EXPECT_EQ(v1.first, "pub2");
-    EXPECT_EQ(v1.second, std::to_string(3.9));
+    EXPECT_EQ(v1.second, "3.9");
 
     auto m = rec1.getMessage(1);
     ASSERT_TRUE(m);
@@ -321,18 +362,18 @@ TEST_P(recorder_message_file_tests, test_message_files_cmd)
 
     auto v1 = rec1.getValue(0);
     EXPECT_EQ(v1.first, "pub1");
-    EXPECT_EQ(v1.second, std::to_string(3.4));
+    EXPECT_EQ(v1.second, "3.4");
     v1 = rec1.getValue(1);
     EXPECT_EQ(v1.first, "pub2");
-    EXPECT_EQ(v1.second, std::to_string(5.7));
+    EXPECT_EQ(v1.second, "5.7");
 
     v1 = rec1.getValue(2);
     EXPECT_EQ(v1.first, "pub1");
-    EXPECT_EQ(v1.second, std::to_string(4.7));
+    EXPECT_EQ(v1.second, "4.7");
 
     v1 = rec1.getValue(3);
     EXPECT_EQ(v1.first, "pub2");
-    EXPECT_EQ(v1.second, std::to_string(3.9));
+    EXPECT_EQ(v1.second, "3.9");
 
     auto m = rec1.getMessage(1);
     ASSERT_TRUE(m);
@@ -707,6 +748,140 @@ TEST(recorder_tests, recorder_test_saveFile3)
     ghc::filesystem::remove(filename2);
 }
 
+TEST(recorder_tests, recorder_test_stream_file)
+{
+    helics::FederateInfo fi(helics::core_type::TEST);
+    fi.coreName = "rcore8";
+    fi.coreInitString = "-f 3 --autobroker";
+    helics::apps::Recorder rec1("rec1", fi);
+    fi.setProperty(helics_property_time_period, 1);
+
+    helics::CombinationFederate mfed("block1", fi);
+
+    helics::MessageFederate mfed2("block2", fi);
+    helics::Endpoint e1(helics::GLOBAL, &mfed, "d1");
+    helics::Endpoint e2(helics::GLOBAL, &mfed2, "d2");
+
+    rec1.addDestEndpointClone("d1");
+    rec1.addSourceEndpointClone("d1");
+    rec1.addSubscription("pub1");
+
+    auto logfile = ghc::filesystem::temp_directory_path() / "streamfile.hlog";
+    // start a new log file for every second of simulation time
+    rec1.streamToFile(logfile.string(), 0, 1.0);
+
+    helics::Publication pub1(helics::GLOBAL, &mfed, "pub1", helics::data_type::helics_double);
+
+    auto fut = std::async(std::launch::async, [&rec1]() { rec1.runTo(5.0); });
+    mfed2.enterExecutingModeAsync();
+    mfed.enterExecutingMode();
+    mfed2.enterExecutingModeComplete();
+    pub1.publish(3.4);
+
+    mfed2.requestTimeAsync(1.0);
+    auto retTime = mfed.requestTime(1.0);
+    mfed2.requestTimeComplete();
+
+    e1.send("d2", "this is a test message");
+    pub1.publish(4.7);
+    EXPECT_EQ(retTime, 1.0);
+
+    e2.send("d1", "this is a test message2");
+
+    mfed2.requestTimeAsync(2.0);
+    retTime = mfed.requestTime(2.0);
+    EXPECT_EQ(retTime, 2.0);
+
+    mfed2.requestTimeComplete();
+    pub1.publish(4.7);
+
+    mfed.finalize();
+    mfed2.finalize();
+    fut.get();
+    EXPECT_EQ(rec1.messageCount(), 2u);
+    EXPECT_EQ(rec1.pointCount(), 3u);
+    // streamed points are not kept in memory
+    EXPECT_TRUE(rec1.getValue(0).first.empty());
+
+    auto filename = ghc::filesystem::temp_directory_path() / "streamfile.json";
+    rec1.saveFile(filename.string());
+    EXPECT_TRUE(ghc::filesystem::exists(filename));
+
+    helics::apps::RecordLogReader reader(logfile.string());
+    EXPECT_GT(reader.getFiles().size(), 1u);
+    helics::apps::RecordLogEntry entry;
+    int points{0};
+    int messages{0};
+    while (reader.next(entry)) {
+        if (entry.isMessage) {
+            ++messages;
+        } else {
+            EXPECT_EQ(entry.key, "pub1");
+            if (points == 0) {
+                EXPECT_TRUE(entry.first);
+                EXPECT_EQ(entry.type, "double");
+            }
+            ++points;
+        }
+    }
+    EXPECT_EQ(points, 3);
+    EXPECT_EQ(messages, 2);
+
+    auto files = reader.getFiles();
+    rec1.finalize();
+    ghc::filesystem::remove(filename);
+    for (auto& file : files) {
+        ghc::filesystem::remove(file);
+    }
+}
+
+#ifdef __linux__
+// writes to /dev/full fail so the failure must be reported rather than dropping the data
+TEST(recorder_tests, record_log_write_failure)
+{
+    helics::apps::RecordLogWriter writer("/dev/full");
+    for (int ii = 0; ii < 10; ++ii) {
+        writer.addValue(
+            helics::Time(ii), 0, 0, "pub1", "double", std::to_string(ii * 1.5), ii == 0);
+    }
+    EXPECT_THROW(writer.flush(), std::runtime_error);
+    // nothing further is accepted once the log failed
+    writer.addValue(helics::Time(20), 0, 0, "pub1", "double", std::string("2.5"), false);
+    EXPECT_NO_THROW(writer.close());
+}
+#endif
+
+// a string length larger than the rest of the file ends the log instead of allocating the length
+TEST(recorder_tests, record_log_corrupt_length)
+{
+    auto logfile = ghc::filesystem::temp_directory_path() / "corruptfile.hlog";
+    {
+        helics::apps::RecordLogWriter writer(logfile.string());
+        writer.addValue(helics::Time(1), 0, 0, "pub1", "double", std::string("2.5"), true);
+        writer.close();
+    }
+    {
+        std::ofstream out(logfile.string(), std::ios::binary | std::ios::app);
+        // a value record for index 0 at time 0 with a string length of 2^40
+        const char corrupt[] = {'V', 0, 0, 0, 0, '\x80', '\x80', '\x80', '\x80', '\x80', 0x20};
+        out.write(corrupt, sizeof(corrupt));
+    }
+    helics::apps::RecordLogReader reader(logfile.string());
+    helics::apps::RecordLogEntry entry;
+    ASSERT_TRUE(reader.next(entry));
+    EXPECT_EQ(entry.key, "pub1");
+    EXPECT_TRUE(reader.getError().empty());
+    EXPECT_FALSE(reader.next(entry));
+    EXPECT_FALSE(reader.getError().empty());
+
+    auto filename = ghc::filesystem::temp_directory_path() / "corruptfile.json";
+    EXPECT_THROW(
+        helics::apps::exportRecordLog(logfile.string(), filename.string()), std::runtime_error);
+    EXPECT_TRUE(ghc::filesystem::exists(filename));
+    ghc::filesystem::remove(filename);
+    ghc::filesystem::remove(logfile);
+}
+
 TEST(recorder_tests, recorder_test_help)
 {
     std::vector<std::string> args{"--quiet", "--version"};
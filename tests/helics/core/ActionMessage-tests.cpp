@@ -5,9 +5,11 @@ the top-level NOTICE for additional details. All rights reserved.
 SPDX-License-Identifier: BSD-3-Clause
 */
 #include "helics/core/ActionMessage.hpp"
+#include "helics/core/ChunkedTransfer.hpp"
 #include "helics/core/flagOperations.hpp"
 
 #include "gtest/gtest.h"
+#include <algorithm>
 #include <cstdio>
 #include <set>
 
@@ -165,6 +167,7 @@ TEST(ActionMessage_tests, copy_constructor_test)
     cmd.dest_id = global_federate_id{3};
     cmd.dest_handle = interface_handle{4};
     cmd.flags = 0x1a2F; // this has no significance
+    cmd.sequenceID = 27;
     cmd.actionTime = helics::Time::maxVal();
     cmd.payload = "hello world";
 
@@ -180,6 +183,7 @@ TEST(ActionMessage_tests, copy_constructor_test)
     EXPECT_EQ(cmd_copy.dest_id.baseValue(), 3);
     EXPECT_EQ(cmd_copy.dest_handle.baseValue(), 4);
     EXPECT_EQ(cmd_copy.flags, 0x1a2F);
+    EXPECT_EQ(cmd_copy.sequenceID, 27U);
     EXPECT_EQ(cmd_copy.actionTime, helics::Time::maxVal());
     EXPECT_EQ(cmd_copy.payload, "hello world");
     EXPECT_EQ(cmd_copy.name, "hello world"); // aliased to payload
@@ -406,3 +410,294 @@ TEST(ActionMessage_tests, check_packetization)
     EXPECT_EQ(cmd.flags, cmd2.flags);
     EXPECT_TRUE(cmd.getStringData() == cmd2.getStringData());
 }
+
+// check that several packets appended to a single buffer can be read back in order
+TEST(ActionMessage_tests, check_packet_stream)
+{
+    helics::ActionMessage cmd1(helics::CMD_PUB);
+    cmd1.source_id = global_federate_id(1);
+    cmd1.payload = "first payload";
+    helics::ActionMessage cmd2(helics::CMD_TIME_REQUEST);
+    cmd2.source_id = global_federate_id(2);
+    cmd2.actionTime = 12.5;
+    helics::ActionMessage cmd3(helics::CMD_SEND_MESSAGE);
+    cmd3.setStringData("target", "source");
+    cmd3.payload = std::string(400, 'a');
+
+    std::string buffer;
+    cmd1.appendPacketized(buffer);
+    cmd2.appendPacketized(buffer);
+    cmd3.appendPacketized(buffer);
+    EXPECT_EQ(buffer.size(),
+              cmd1.packetize().size() + cmd2.packetize().size() + cmd3.packetize().size());
+
+    int offset = 0;
+    std::vector<helics::ActionMessage> results;
+    while (offset < static_cast<int>(buffer.size())) {
+        helics::ActionMessage rx;
+        auto res = rx.depacketize(buffer.data() + offset,
+                                  static_cast<int>(buffer.size()) - offset);
+        ASSERT_GT(res, 0);
+        offset += res;
+        results.push_back(std::move(rx));
+    }
+    ASSERT_EQ(results.size(), 3U);
+    EXPECT_EQ(results[0].action(), helics::CMD_PUB);
+    EXPECT_EQ(results[0].payload, cmd1.payload);
+    EXPECT_EQ(results[1].action(), helics::CMD_TIME_REQUEST);
+    EXPECT_EQ(results[1].actionTime, cmd2.actionTime);
+    EXPECT_EQ(results[2].payload, cmd3.payload);
+    EXPECT_TRUE(results[2].getStringData() == cmd3.getStringData());
+}
+
+// check that a reused buffer and a recycled message do not need to grow again
+TEST(ActionMessage_tests, serialize_into_reuse)
+{
+    helics::ActionMessage cmd(helics::CMD_SEND_MESSAGE);
+    cmd.setStringData("a long destination string for the test", "a long source string for the test");
+    cmd.payload = std::string(300, 'b');
+
+    std::string buffer;
+    auto sz = cmd.serializeInto(buffer);
+    EXPECT_EQ(sz, static_cast<int>(buffer.size()));
+    EXPECT_EQ(buffer, cmd.to_string());
+
+    helics::ActionMessage rx;
+    rx.fromByteArray(buffer.data(), static_cast<int>(buffer.size()));
+    EXPECT_EQ(rx.payload, cmd.payload);
+    EXPECT_TRUE(rx.getStringData() == cmd.getStringData());
+
+    const auto* bufferData = buffer.data();
+    const auto* payloadData = rx.payload.data();
+    const auto* stringData = rx.getString(helics::targetStringLoc).data();
+
+    helics::ActionMessage cmd2(helics::CMD_SEND_MESSAGE);
+    cmd2.setStringData("another destination for the test", "another source for the test");
+    cmd2.payload = std::string(250, 'c');
+    cmd2.serializeInto(buffer);
+    EXPECT_EQ(buffer.data(), bufferData);
+    rx.fromByteArray(buffer.data(), static_cast<int>(buffer.size()));
+    EXPECT_EQ(rx.payload, cmd2.payload);
+    EXPECT_TRUE(rx.getStringData() == cmd2.getStringData());
+    EXPECT_EQ(rx.payload.data(), payloadData);
+    EXPECT_EQ(rx.getString(helics::targetStringLoc).data(), stringData);
+
+    std::vector<char> vbuffer;
+    EXPECT_EQ(cmd2.serializeInto(vbuffer), static_cast<int>(buffer.size()));
+    EXPECT_TRUE(std::equal(vbuffer.begin(), vbuffer.end(), buffer.begin()));
+}
+
+// check that a payload larger than the serialization limit survives a chunked transfer
+TEST(ActionMessage_tests, chunked_transfer)
+{
+    helics::ActionMessage cmd(helics::CMD_PUB);
+    cmd.source_id = global_federate_id(131072);
+    cmd.source_handle = interface_handle(5);
+    cmd.actionTime = 2.5;
+    cmd.setStringData("type", "units");
+    // larger than the 24 bits available for the payload size in a single message
+    cmd.payload.resize(20 * 1024 * 1024 + 17);
+    for (std::size_t ii = 0; ii < cmd.payload.size(); ii += 4096) {
+        cmd.payload[ii] = static_cast<char>(ii / 4096);
+    }
+    auto original = cmd;
+
+    helics::MessageChunker chunker(std::move(cmd), 45, 1024 * 1024);
+    helics::MessageAssembler assembler;
+    int chunks{0};
+    bool complete{false};
+    while (!chunker.done()) {
+        auto chunk = chunker.nextChunk();
+        EXPECT_EQ(chunk.action(), helics::CMD_MESSAGE_CHUNK);
+        EXPECT_LE(chunk.payload.size(), 1024U * 1024U);
+        ++chunks;
+        // send each chunk through the serialization used by the comms
+        helics::ActionMessage rx(chunk.to_string());
+        EXPECT_FALSE(complete);
+        complete = assembler.addChunk(rx);
+        if (complete) {
+            EXPECT_EQ(rx.action(), helics::CMD_PUB);
+            EXPECT_EQ(rx.source_id, original.source_id);
+            EXPECT_EQ(rx.source_handle, original.source_handle);
+            EXPECT_EQ(rx.actionTime, original.actionTime);
+            EXPECT_TRUE(rx.getStringData() == original.getStringData());
+            EXPECT_TRUE(rx.payload == original.payload);
+        }
+    }
+    EXPECT_TRUE(complete);
+    EXPECT_EQ(chunks, 22);
+    EXPECT_EQ(assembler.pendingTransfers(), 0U);
+}
+
+// a transfer missing a chunk is dropped and does not affect other transfers
+TEST(ActionMessage_tests, chunked_transfer_missing_chunk)
+{
+    helics::ActionMessage cmd(helics::CMD_SEND_MESSAGE);
+    cmd.source_id = global_federate_id(131072);
+    cmd.payload = std::string(1000, 'a');
+    helics::ActionMessage cmd2(cmd);
+    cmd2.payload = std::string(1000, 'b');
+
+    helics::MessageChunker chunker1(std::move(cmd), 1, 300);
+    helics::MessageChunker chunker2(std::move(cmd2), 2, 300);
+    helics::MessageAssembler assembler;
+    int completed{0};
+    int index{0};
+    while (!chunker1.done() || !chunker2.done()) {
+        if (!chunker1.done()) {
+            auto chunk = chunker1.nextChunk();
+            // skip the second data chunk of the first transfer
+            if (index != 2) {
+                EXPECT_FALSE(assembler.addChunk(chunk));
+            }
+        }
+        if (!chunker2.done()) {
+            auto chunk = chunker2.nextChunk();
+            if (assembler.addChunk(chunk)) {
+                ++completed;
+                EXPECT_EQ(chunk.payload, std::string(1000, 'b'));
+            }
+        }
+        ++index;
+    }
+    EXPECT_EQ(completed, 1);
+    EXPECT_EQ(assembler.pendingTransfers(), 0U);
+}
+
+TEST(ActionMessage_tests, oversize_payload)
+{
+    helics::ActionMessage cmd(helics::CMD_PUB);
+    cmd.payload = std::string(helics::maxSerializedPayloadSize, 'a');
+    auto str = cmd.to_string();
+    helics::ActionMessage rx(str);
+    EXPECT_EQ(rx.payload.size(), helics::maxSerializedPayloadSize);
+
+    // a payload that does not fit in the size field is not silently truncated
+    cmd.payload.push_back('b');
+    EXPECT_THROW(cmd.to_string(), std::invalid_argument);
+    std::string buffer;
+    EXPECT_THROW(cmd.serializeInto(buffer), std::invalid_argument);
+}
+
+TEST(ActionMessage_tests, shared_payload)
+{
+    helics::ActionMessage cmd(helics::CMD_PUB);
+    cmd.source_id = global_federate_id(1);
+    cmd.source_handle = interface_handle(2);
+    cmd.dest_id = global_federate_id(3);
+    cmd.dest_handle = interface_handle(4);
+    cmd.actionTime = 45.7;
+    std::string pdata(5000, 'a');
+    helics::shared_data_block buffer(pdata.data(), pdata.size());
+    cmd.setSharedPayload(buffer);
+    EXPECT_TRUE(cmd.hasSharedPayload());
+    EXPECT_TRUE(cmd.payload.empty());
+    EXPECT_EQ(cmd.payloadSize(), pdata.size());
+
+    // copies should share the buffer
+    helics::ActionMessage cmd2(cmd);
+    EXPECT_EQ(cmd2.payloadData(), buffer.data());
+    EXPECT_EQ(buffer.use_count(), 3);
+
+    // serialization should produce the data in the payload
+    helics::ActionMessage cmd3(cmd.to_string());
+    EXPECT_FALSE(cmd3.hasSharedPayload());
+    EXPECT_EQ(cmd3.payload, pdata);
+    EXPECT_EQ(cmd3.actionTime, cmd.actionTime);
+    EXPECT_EQ(cmd3.dest_handle, cmd.dest_handle);
+
+    auto extracted = cmd2.extractSharedPayload();
+    EXPECT_EQ(extracted.data(), buffer.data());
+    EXPECT_FALSE(cmd2.hasSharedPayload());
+
+    auto extracted2 = cmd3.extractSharedPayload();
+    EXPECT_EQ(std::string(extracted2.data(), extracted2.size()), pdata);
+    EXPECT_TRUE(cmd3.payload.empty());
+}
+
+TEST(ActionMessage_tests, string_data_reuse)
+{
+    helics::ActionMessage cmd(helics::CMD_SEND_MESSAGE);
+    cmd.setStringData("target", "source", "original_source", "original_dest");
+    EXPECT_EQ(cmd.getStringData().size(), 4U);
+    auto str = cmd.to_string();
+
+    helics::ActionMessage cmd2(helics::CMD_REG_FED);
+    cmd2.setStringData("a string that is too long for the small string buffer");
+    auto* firstString = &cmd2.getString(0);
+    cmd2.setString(5, "extra");
+    EXPECT_EQ(cmd2.getStringData().size(), 6U);
+    EXPECT_EQ(cmd2.getString(0), "a string that is too long for the small string buffer");
+    EXPECT_TRUE(cmd2.getString(3).empty());
+    EXPECT_NE(firstString, &cmd2.getString(0));
+
+    // deserializing into a message with enough string storage should reuse it
+    firstString = &cmd2.getString(0);
+    cmd2.from_string(str);
+    EXPECT_EQ(&cmd2.getString(0), firstString);
+    EXPECT_TRUE(cmd2.getStringData() == cmd.getStringData());
+    EXPECT_EQ(cmd2.getString(origDestStringLoc), "original_dest");
+
+    helics::ActionMessage cmd3(std::move(cmd2));
+    EXPECT_TRUE(cmd2.getStringData().empty());
+    EXPECT_EQ(cmd3.getString(targetStringLoc), "target");
+    cmd2 = cmd3;
+    EXPECT_TRUE(cmd2.getStringData() == cmd3.getStringData());
+    cmd3.clearStringData();
+    EXPECT_TRUE(cmd3.getStringData().empty());
+    EXPECT_EQ(cmd3.getString(0), "");
+}
+
+TEST(ActionMessage_tests, compact_message_names)
+{
+    helics::ActionMessage cmd(helics::CMD_SEND_MESSAGE);
+    cmd.setStringData("dest_endpoint", "source_endpoint", "source_endpoint");
+    cmd.dest_id = helics::global_federate_id(23);
+    cmd.dest_handle = helics::interface_handle(4);
+    cmd.payload = "message data";
+    auto fullSize = cmd.serializedByteCount();
+    cmd.compactMessageNames();
+    EXPECT_TRUE(cmd.hasCompactNames());
+    EXPECT_EQ(cmd.getStringData().size(), 2U);
+    EXPECT_LT(cmd.serializedByteCount(), fullSize);
+
+    helics::ActionMessage rx(cmd.to_string());
+    EXPECT_TRUE(rx.hasCompactNames());
+    rx.expandMessageNames("dest_endpoint");
+    EXPECT_FALSE(rx.hasCompactNames());
+    auto msg = helics::createMessageFromCommand(std::move(rx));
+    EXPECT_EQ(msg->dest, "dest_endpoint");
+    EXPECT_EQ(msg->source, "source_endpoint");
+    EXPECT_EQ(msg->original_source, "source_endpoint");
+    EXPECT_EQ(msg->data.to_string(), "message data");
+
+    // a message renamed by a filter keeps all its names
+    helics::ActionMessage filtered(helics::CMD_SEND_MESSAGE);
+    filtered.setStringData("dest_endpoint", "filter", "source_endpoint");
+    filtered.compactMessageNames();
+    EXPECT_FALSE(filtered.hasCompactNames());
+    EXPECT_EQ(filtered.getString(targetStringLoc), "dest_endpoint");
+}
+
+TEST(ActionMessage_tests, user_flags_keep_message_names)
+{
+    // flags users can set on a message must not be mistaken for compacted names
+    helics::ActionMessage cmd(helics::CMD_SEND_MESSAGE);
+    cmd.setStringData("dest_endpoint", "source_endpoint", "orig_source", "orig_dest");
+    for (uint16_t flag = 0; flag < 16; ++flag) {
+        setActionFlag(cmd, flag);
+    }
+    cmd.payload = "message data";
+
+    helics::ActionMessage rx(cmd.to_string());
+    EXPECT_FALSE(rx.hasCompactNames());
+    rx.expandMessageNames("other_endpoint");
+    EXPECT_TRUE(checkActionFlag(rx, extra_flag3));
+    EXPECT_EQ(rx.flags, 0xFFFF);
+    auto msg = helics::createMessageFromCommand(std::move(rx));
+    EXPECT_EQ(msg->dest, "dest_endpoint");
+    EXPECT_EQ(msg->source, "source_endpoint");
+    EXPECT_EQ(msg->original_source, "orig_source");
+    EXPECT_EQ(msg->original_dest, "orig_dest");
+    EXPECT_EQ(msg->data.to_string(), "message data");
+}
@@ -0,0 +1,92 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/core/ActionQueue.hpp"
+
+#include "gtest/gtest.h"
+#include <thread>
+#include <vector>
+
+using namespace helics;
+
+TEST(ActionQueue_tests, lockfree_priority)
+{
+    LockFreePriorityQueue<ActionMessage> queue;
+    EXPECT_TRUE(queue.empty());
+    queue.push(ActionMessage(CMD_PUB));
+    queue.emplace(CMD_TIME_REQUEST);
+    queue.pushPriority(ActionMessage(CMD_REG_FED));
+    queue.emplacePriority(CMD_REG_PUB);
+    EXPECT_FALSE(queue.empty());
+
+    // priority actions come out first and each channel is in order
+    EXPECT_EQ(queue.pop().action(), CMD_REG_FED);
+    EXPECT_EQ(queue.pop().action(), CMD_REG_PUB);
+    EXPECT_EQ(queue.pop().action(), CMD_PUB);
+    auto res = queue.try_pop();
+    ASSERT_TRUE(res);
+    EXPECT_EQ(res->action(), CMD_TIME_REQUEST);
+    EXPECT_FALSE(queue.try_pop());
+    EXPECT_TRUE(queue.empty());
+    // anything left in the queue is cleaned up on destruction
+    queue.push(ActionMessage(CMD_PUB));
+}
+
+TEST(ActionQueue_tests, lockfree_multiple_producers)
+{
+    constexpr int producers{4};
+    constexpr int messageCount{20000};
+    LockFreePriorityQueue<ActionMessage> queue;
+    std::vector<std::thread> threads;
+    for (int ii = 0; ii < producers; ++ii) {
+        threads.emplace_back([&queue, ii]() {
+            for (int jj = 0; jj < messageCount; ++jj) {
+                ActionMessage cmd(CMD_PUB);
+                cmd.source_id = global_federate_id(ii);
+                cmd.messageID = jj;
+                queue.push(std::move(cmd));
+                if (jj % 1000 == 0) {
+                    // give the consumer a chance to go to sleep
+                    std::this_thread::sleep_for(std::chrono::microseconds(50));
+                }
+            }
+        });
+    }
+    std::vector<int> next(producers, 0);
+    bool ordered{true};
+    for (int ii = 0; ii < producers * messageCount; ++ii) {
+        auto cmd = queue.pop();
+        auto& expected = next[cmd.source_id.baseValue()];
+        if (cmd.messageID != expected) {
+            ordered = false;
+        }
+        expected = cmd.messageID + 1;
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_TRUE(ordered);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(ActionQueue_tests, switch_queue_type)
+{
+    ActionQueue queue;
+    EXPECT_FALSE(queue.isLockFree());
+    queue.push(ActionMessage(CMD_PUB));
+    queue.pushPriority(ActionMessage(CMD_REG_FED));
+    queue.setLockFree(true);
+    EXPECT_TRUE(queue.isLockFree());
+    // the queued actions are transferred with their priority
+    queue.emplace(CMD_TIME_REQUEST);
+    EXPECT_EQ(queue.pop().action(), CMD_REG_FED);
+    EXPECT_EQ(queue.pop().action(), CMD_PUB);
+    queue.setLockFree(false);
+    EXPECT_FALSE(queue.isLockFree());
+    EXPECT_EQ(queue.pop().action(), CMD_TIME_REQUEST);
+    EXPECT_FALSE(queue.try_pop());
+}
@@ -4,11 +4,17 @@ Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
 the top-level NOTICE for additional details. All rights reserved.
 SPDX-License-Identifier: BSD-3-Clause
 */
+#include "helics/core/ActionMessage.hpp"
+#include "helics/core/BrokerBase.hpp"
 #include "helics/core/BrokerFactory.hpp"
+#include "helics/core/CommsInterface.hpp"
 #include "helics/core/CoreBroker.hpp"
 #include "helics/helics-config.h"
 
 #include "gtest/gtest.h"
+#include <mutex>
+#include <string>
+#include <vector>
 
 /** test the assignment and retrieval of global value from a broker object*/
 TEST(broker_tests, global_value_test)
@@ -28,3 +34,103 @@ TEST(broker_tests, global_value_test)
     brk->disconnect();
     EXPECT_FALSE(brk->isConnected());
 }
+
+/** comms object that only exposes the transmit queue and batch collection*/
+class BatchComms: public helics::CommsInterface {
+  public:
+    explicit BatchComms(int batchSize) { maxBatchSize = batchSize; }
+    using CommsInterface::collectTransmitBatch;
+    using CommsInterface::getNextTransmission;
+
+  private:
+    virtual void queue_rx_function() override {}
+    virtual void queue_tx_function() override {}
+};
+
+/** broker object that records the commands passed on by the command processor*/
+class RecordingBroker: public helics::BrokerBase {
+  public:
+    std::vector<helics::ActionMessage> commands()
+    {
+        std::lock_guard<std::mutex> lock(commandLock);
+        return processed;
+    }
+
+  protected:
+    virtual void processDisconnect(bool /*skipUnregister*/) override {}
+    virtual bool tryReconnect() override { return false; }
+    virtual void processCommand(helics::ActionMessage&& cmd) override
+    {
+        if (cmd.action() != helics::CMD_TICK) {
+            std::lock_guard<std::mutex> lock(commandLock);
+            processed.push_back(std::move(cmd));
+        }
+    }
+    virtual void processPriorityCommand(helics::ActionMessage&& command) override
+    {
+        processCommand(std::move(command));
+    }
+    virtual std::string generateLocalAddressString() const override { return "recorder"; }
+
+  private:
+    std::mutex commandLock;
+    std::vector<helics::ActionMessage> processed;
+};
+
+static helics::ActionMessage numberedPub(int index)
+{
+    helics::ActionMessage pub(helics::CMD_PUB);
+    pub.messageID = index;
+    pub.payload = "value " + std::to_string(index);
+    return pub;
+}
+
+/** messages batched by the comms are all unpacked in order by the broker command processor*/
+TEST(broker_tests, batched_transmission)
+{
+    BatchComms comms(10);
+    const helics::route_id rid(1);
+    comms.transmit(rid, numberedPub(0));
+    comms.transmit(rid, numberedPub(1));
+    comms.transmit(rid, numberedPub(2));
+    helics::ActionMessage ping(helics::CMD_PING);
+    ping.messageID = 3;
+    comms.transmit(rid, ping);
+    comms.transmit(rid, numberedPub(4));
+    comms.transmit(rid, numberedPub(5));
+
+    std::vector<std::string> sent;
+    std::vector<helics::ActionMessage> batch;
+    std::string buffer;
+    while (sent.size() < 3) {
+        auto tx = comms.getNextTransmission();
+        comms.collectTransmitBatch(tx.first, tx.second, 64 * 1024, batch);
+        helics::serializeBatch(tx.second, batch, buffer);
+        sent.push_back(buffer);
+    }
+    // the ping closes the first batch and is sent on its own
+    EXPECT_EQ(helics::ActionMessage(sent[0]).action(), helics::CMD_MULTI_MESSAGE);
+    EXPECT_EQ(helics::ActionMessage(sent[1]).action(), helics::CMD_PING);
+    EXPECT_EQ(helics::ActionMessage(sent[2]).action(), helics::CMD_MULTI_MESSAGE);
+
+    RecordingBroker brk;
+    brk.configureBase();
+    for (const auto& msg : sent) {
+        brk.addActionMessage(helics::ActionMessage(msg));
+    }
+    brk.addActionMessage(helics::ActionMessage(helics::CMD_STOP));
+    brk.joinAllThreads();
+
+    auto cmds = brk.commands();
+    ASSERT_EQ(cmds.size(), 7U);
+    for (int ii = 0; ii < 6; ++ii) {
+        EXPECT_EQ(cmds[ii].messageID, ii);
+        if (ii == 3) {
+            EXPECT_EQ(cmds[ii].action(), helics::CMD_PING);
+        } else {
+            EXPECT_EQ(cmds[ii].action(), helics::CMD_PUB);
+            EXPECT_EQ(cmds[ii].payload, "value " + std::to_string(ii));
+        }
+    }
+    EXPECT_EQ(cmds[6].action(), helics::CMD_STOP);
+}
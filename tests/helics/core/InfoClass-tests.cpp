@@ -5,9 +5,13 @@ the top-level NOTICE for additional details. All rights reserved.
 SPDX-License-Identifier: BSD-3-Clause
 */
 #include "helics/core/BasicHandleInfo.hpp"
+#include "helics/core/DeltaEncoding.hpp"
 #include "helics/core/EndpointInfo.hpp"
 #include "helics/core/FilterInfo.hpp"
+#include "helics/core/InputAggregation.hpp"
 #include "helics/core/NamedInputInfo.hpp"
+#include "helics/core/PublicationInfo.hpp"
+#include "helics/helics_enums.h"
 
 #include "gtest/gtest.h"
 
@@ -234,6 +238,45 @@ TEST(InfoClass_tests, endpointinfo_test)
     EXPECT_TRUE(endPI.getMessage(maxT) == nullptr);
 }
 
+TEST(InfoClass_tests, endpointinfo_order_test)
+{
+    helics::EndpointInfo endPI(
+        {helics::global_federate_id(5), helics::interface_handle(13)}, "name", "type");
+    // add messages in reverse time order with several messages from the same source at each time
+    for (int ii = 9; ii >= 0; --ii) {
+        for (int jj = 0; jj < 3; ++jj) {
+            auto msg = std::make_unique<helics::Message>();
+            msg->data = std::to_string(jj);
+            msg->original_source = (ii % 2 == 0) ? "bFed" : "aFed";
+            msg->time = helics::Time(ii);
+            endPI.addMessage(std::move(msg));
+        }
+        auto msg = std::make_unique<helics::Message>();
+        msg->data = "a";
+        msg->original_source = "Fed";
+        msg->time = helics::Time(ii);
+        endPI.addMessage(std::move(msg));
+    }
+    EXPECT_EQ(endPI.queueSize(helics::Time::maxVal()), 40);
+    EXPECT_EQ(endPI.queueSize(helics::Time(4)), 20);
+    EXPECT_EQ(endPI.firstMessageTime(), helics::timeZero);
+    for (int ii = 0; ii < 10; ++ii) {
+        // the earlier source name comes first
+        auto msg = endPI.getMessage(helics::Time(ii));
+        ASSERT_TRUE(msg);
+        EXPECT_EQ(msg->data.to_string(), "a");
+        // messages from the same source at the same time stay in arrival order
+        for (int jj = 0; jj < 3; ++jj) {
+            msg = endPI.getMessage(helics::Time(ii));
+            ASSERT_TRUE(msg);
+            EXPECT_EQ(msg->time, helics::Time(ii));
+            EXPECT_EQ(msg->data.to_string(), std::to_string(jj));
+        }
+        EXPECT_TRUE(endPI.getMessage(helics::Time(ii)) == nullptr);
+    }
+    EXPECT_EQ(endPI.queueSize(helics::Time::maxVal()), 0);
+}
+
 TEST(InfoClass_tests, filterinfo_test)
 {
     // Mostly testing ordering of message sorting and maxTime function arguments
@@ -329,3 +372,271 @@ TEST(InfoClass_tests, inputinfo_test)
     ret_data = subI.getData(0);
     EXPECT_TRUE(ret_data->to_string() == "time one");
 }
+
+TEST(InfoClass_tests, value_delta_test)
+{
+    std::string previous(8000, 'a');
+    std::string next = previous;
+    next[5] = 'b';
+    next[3000] = 'c';
+    next[3004] = 'd';
+    next[7999] = 'e';
+    std::string delta;
+    ASSERT_TRUE(helics::encodeValueDelta(previous, next.data(), next.size(), delta));
+    EXPECT_LT(delta.size(), 40u);
+    std::string result;
+    ASSERT_TRUE(helics::applyValueDelta(previous, delta.data(), delta.size(), result));
+    EXPECT_EQ(result, next);
+
+    // an identical value produces a delta with no changes
+    ASSERT_TRUE(helics::encodeValueDelta(previous, previous.data(), previous.size(), delta));
+    ASSERT_TRUE(helics::applyValueDelta(next, delta.data(), delta.size(), result));
+    EXPECT_EQ(result, next);
+
+    // a different size or a large change requires the full value
+    EXPECT_FALSE(helics::encodeValueDelta(previous, next.data(), next.size() - 1, delta));
+    std::string changed(8000, 'z');
+    EXPECT_FALSE(helics::encodeValueDelta(previous, changed.data(), changed.size(), delta));
+
+    // deltas that do not match the base are rejected
+    ASSERT_TRUE(helics::encodeValueDelta(previous, next.data(), next.size(), delta));
+    EXPECT_FALSE(
+        helics::applyValueDelta(std::string(100, 'a'), delta.data(), delta.size(), result));
+    EXPECT_FALSE(helics::applyValueDelta(previous, delta.data(), delta.size() - 1, result));
+}
+
+TEST(InfoClass_tests, publication_delta_test)
+{
+    helics::PublicationInfo pubI(
+        helics::global_handle(helics::global_federate_id(5), helics::interface_handle(13)),
+        "key",
+        "vector",
+        std::string());
+    pubI.delta_transmission = true;
+    std::string value(1000, 'a');
+    std::string delta;
+    // the first value is always sent in full
+    EXPECT_FALSE(pubI.generateDelta(value.data(), value.size(), delta));
+    value[10] = 'b';
+    EXPECT_TRUE(pubI.generateDelta(value.data(), value.size(), delta));
+    // after a subscriber is added the base is cleared
+    pubI.lastTransmission.clear();
+    value[20] = 'b';
+    EXPECT_FALSE(pubI.generateDelta(value.data(), value.size(), delta));
+    int fullCount{0};
+    for (int ii = 0; ii < 2 * helics::PublicationInfo::deltaSnapshotInterval + 2; ++ii) {
+        value[ii % 1000] = static_cast<char>('c' + ii % 20);
+        if (!pubI.generateDelta(value.data(), value.size(), delta)) {
+            ++fullCount;
+        }
+    }
+    // periodic full values are sent
+    EXPECT_EQ(fullCount, 2);
+}
+
+TEST(InfoClass_tests, inputinfo_delta_test)
+{
+    helics::NamedInputInfo subI(
+        helics::global_handle(helics::global_federate_id(5), helics::interface_handle(13)),
+        "key",
+        "type",
+        "units");
+    helics::global_handle testHandle(helics::global_federate_id(5), helics::interface_handle(45));
+    subI.addSource(testHandle, "", "vector", std::string());
+
+    std::string base(200, 'a');
+    std::string next = base;
+    next[100] = 'x';
+    std::string delta;
+    ASSERT_TRUE(helics::encodeValueDelta(base, next.data(), next.size(), delta));
+    // there is no base value yet so the delta cannot be applied
+    EXPECT_FALSE(subI.addDeltaData(testHandle, helics::timeZero, 0, delta.data(), delta.size()));
+
+    subI.addData(testHandle, helics::timeZero, 0, std::make_shared<helics::data_block>(base));
+    EXPECT_TRUE(subI.addDeltaData(testHandle, 1.0, 0, delta.data(), delta.size()));
+    subI.updateTimeInclusive(1.0);
+    auto ret_data = subI.getData(0);
+    ASSERT_TRUE(ret_data);
+    EXPECT_EQ(ret_data->to_string(), next);
+}
+
+TEST(InfoClass_tests, inputinfo_lost_base_test)
+{
+    helics::NamedInputInfo subI(
+        helics::global_handle(helics::global_federate_id(5), helics::interface_handle(13)),
+        "key",
+        "type",
+        "units");
+    helics::global_handle testHandle(helics::global_federate_id(5), helics::interface_handle(45));
+    subI.addSource(testHandle, "", "vector", std::string());
+
+    std::string base(200, 'a');
+    std::string next = base;
+    next[100] = 'x';
+    std::string delta;
+    ASSERT_TRUE(helics::encodeValueDelta(base, next.data(), next.size(), delta));
+    // the base value was lost so a full value is requested once
+    EXPECT_FALSE(subI.addDeltaData(testHandle, 1.0, 0, delta.data(), delta.size()));
+    EXPECT_TRUE(subI.requestFullValue(testHandle));
+    EXPECT_FALSE(subI.addDeltaData(testHandle, 2.0, 0, delta.data(), delta.size()));
+    EXPECT_FALSE(subI.requestFullValue(testHandle));
+    EXPECT_FALSE(subI.requestFullValue(
+        helics::global_handle(helics::global_federate_id(7), helics::interface_handle(45))));
+
+    // the full value sent in response restores the deltas
+    subI.addData(testHandle, 3.0, 0, std::make_shared<helics::data_block>(base));
+    EXPECT_TRUE(subI.addDeltaData(testHandle, 4.0, 0, delta.data(), delta.size()));
+    subI.updateTimeInclusive(4.0);
+    auto ret_data = subI.getData(0);
+    ASSERT_TRUE(ret_data);
+    EXPECT_EQ(ret_data->to_string(), next);
+    // a later loss asks again
+    EXPECT_TRUE(subI.requestFullValue(testHandle));
+
+    // a value past the deactivation time is not used but is still the base for the next delta
+    subI.removeSource(testHandle, 5.0);
+    subI.addData(testHandle, 6.0, 0, std::make_shared<helics::data_block>(base));
+    EXPECT_TRUE(subI.addDeltaData(testHandle, 7.0, 0, delta.data(), delta.size()));
+    subI.updateTimeInclusive(7.0);
+    ret_data = subI.getData(0);
+    ASSERT_TRUE(ret_data);
+    EXPECT_EQ(ret_data->to_string(), next);
+    EXPECT_EQ(subI.nextValueTime(), helics::Time::maxVal());
+}
+
+TEST(InfoClass_tests, numeric_aggregation_test)
+{
+    std::vector<double> result;
+    std::vector<std::vector<double>> vals{{1.0, 2.0, 3.0}, {4.0}, {}, {-1.0, 5.0}};
+    helics::aggregateNumericValues(helics_multi_input_sum_operation, vals, result);
+    EXPECT_EQ(result, std::vector<double>({4.0, 7.0, 3.0}));
+    helics::aggregateNumericValues(helics_multi_input_max_operation, vals, result);
+    EXPECT_EQ(result, std::vector<double>({4.0, 5.0, 3.0}));
+    helics::aggregateNumericValues(helics_multi_input_min_operation, vals, result);
+    EXPECT_EQ(result, std::vector<double>({-1.0, 2.0, 3.0}));
+    helics::aggregateNumericValues(helics_multi_input_average_operation, vals, result);
+    EXPECT_EQ(result, std::vector<double>({4.0 / 3.0, 3.5, 3.0}));
+    helics::aggregateNumericValues(helics_multi_input_vectorize_operation, vals, result);
+    EXPECT_EQ(result, std::vector<double>({1.0, 2.0, 3.0, 4.0, -1.0, 5.0}));
+
+    std::vector<double> decoded;
+    auto block = helics::encodeNumericValue({1.0, 2.5}, true);
+    ASSERT_TRUE(helics::decodeNumericValue("double_vector", block, decoded));
+    EXPECT_EQ(decoded, std::vector<double>({1.0, 2.5}));
+    block = helics::encodeNumericValue({2.5}, false);
+    ASSERT_TRUE(helics::decodeNumericValue("double", block, decoded));
+    EXPECT_EQ(decoded, std::vector<double>({2.5}));
+    ASSERT_TRUE(helics::decodeNumericValue("string", helics::data_block("-3.25"), decoded));
+    EXPECT_EQ(decoded, std::vector<double>({-3.25}));
+    EXPECT_FALSE(helics::decodeNumericValue("string", helics::data_block("abc"), decoded));
+    EXPECT_FALSE(helics::decodeNumericValue("double", helics::data_block("abc"), decoded));
+}
+
+TEST(InfoClass_tests, inputinfo_aggregation_test)
+{
+    helics::NamedInputInfo subI(
+        helics::global_handle(helics::global_federate_id(5), helics::interface_handle(13)),
+        "key",
+        "double",
+        "units");
+    helics::global_handle src1(helics::global_federate_id(5), helics::interface_handle(45));
+    helics::global_handle src2(helics::global_federate_id(7), helics::interface_handle(46));
+    helics::global_handle src3(helics::global_federate_id(8), helics::interface_handle(47));
+    subI.addSource(src1, "pub1", "double", std::string());
+    subI.addSource(src2, "pub2", "double", std::string());
+    subI.addSource(src3, "pub3", "string", std::string());
+    subI.setMultiInputMethod(helics_multi_input_sum_operation);
+    EXPECT_EQ(subI.getInjectionType(), "double");
+    EXPECT_FALSE(subI.getData());
+
+    auto makeDouble = [](double val) {
+        return std::make_shared<helics::data_block>(helics::encodeNumericValue({val}, false));
+    };
+    std::vector<double> decoded;
+
+    subI.addData(src1, helics::timeZero, 0, makeDouble(2.0));
+    subI.addData(src2, helics::timeZero, 0, makeDouble(3.5));
+    subI.addData(src3, helics::timeZero, 0, std::make_shared<helics::data_block>("4"));
+    EXPECT_TRUE(subI.updateTimeInclusive(helics::timeZero));
+    auto res = subI.getData();
+    ASSERT_TRUE(res);
+    ASSERT_TRUE(helics::decodeNumericValue("double", *res, decoded));
+    EXPECT_EQ(decoded[0], 9.5);
+
+    // only one source updates and the others keep their values
+    subI.addData(src2, 1.0, 0, makeDouble(-1.5));
+    EXPECT_TRUE(subI.updateTimeInclusive(1.0));
+    res = subI.getData();
+    ASSERT_TRUE(helics::decodeNumericValue("double", *res, decoded));
+    EXPECT_EQ(decoded[0], 4.5);
+
+    // an update on a later source is applied even if earlier sources have no new data
+    subI.addData(src3, 2.0, 0, std::make_shared<helics::data_block>("10"));
+    EXPECT_TRUE(subI.updateTimeInclusive(2.0));
+    res = subI.getData();
+    ASSERT_TRUE(helics::decodeNumericValue("double", *res, decoded));
+    EXPECT_EQ(decoded[0], 10.5);
+
+    subI.setMultiInputMethod(helics_multi_input_max_operation);
+    res = subI.getData();
+    ASSERT_TRUE(helics::decodeNumericValue("double", *res, decoded));
+    EXPECT_EQ(decoded[0], 10.0);
+
+    subI.setMultiInputMethod(helics_multi_input_vectorize_operation);
+    EXPECT_EQ(subI.getInjectionType(), "double_vector");
+    res = subI.getData();
+    ASSERT_TRUE(helics::decodeNumericValue("double_vector", *res, decoded));
+    EXPECT_EQ(decoded, std::vector<double>({2.0, -1.5, 10.0}));
+
+    subI.setMultiInputMethod(helics_multi_input_no_op);
+    EXPECT_EQ(subI.getInjectionType(), "double");
+    res = subI.getData();
+    ASSERT_TRUE(res);
+    EXPECT_EQ(res->to_string(), "10");
+
+    // an unsupported method is treated as no_op
+    subI.setMultiInputMethod(42);
+    EXPECT_EQ(subI.getInjectionType(), "double");
+    res = subI.getData();
+    ASSERT_TRUE(res);
+    EXPECT_EQ(res->to_string(), "10");
+}
+
+TEST(InfoClass_tests, inputinfo_source_index_test)
+{
+    helics::NamedInputInfo subI(
+        helics::global_handle(helics::global_federate_id(5), helics::interface_handle(13)),
+        "key",
+        "type",
+        "units");
+    std::vector<helics::global_handle> sources;
+    for (int ii = 0; ii < 50; ++ii) {
+        sources.emplace_back(helics::global_federate_id(ii + 10), helics::interface_handle(ii));
+        subI.addSource(sources.back(), "pub" + std::to_string(ii), "string", std::string());
+    }
+    EXPECT_EQ(subI.getSourceIndex(sources[0]), 0);
+    EXPECT_EQ(subI.getSourceIndex(sources[37]), 37);
+    EXPECT_EQ(
+        subI.getSourceIndex(
+            helics::global_handle(helics::global_federate_id(5), helics::interface_handle(99))),
+        -1);
+
+    subI.removeSource(sources[20], helics::timeZero);
+    subI.removeSource("pub30", helics::timeZero);
+    for (int ii = 0; ii < 50; ++ii) {
+        subI.addData(
+            sources[ii], 1.0, 0, std::make_shared<helics::data_block>(std::to_string(ii)));
+    }
+    EXPECT_TRUE(subI.updateTimeInclusive(1.0));
+    EXPECT_EQ(subI.getData(49)->to_string(), "49");
+    EXPECT_FALSE(subI.getData(20));
+    EXPECT_FALSE(subI.getData(30));
+
+    // a duplicate handle still delivers to the first entry and removal applies to both
+    subI.addSource(sources[5], "pub5", "string", std::string());
+    EXPECT_EQ(subI.getSourceIndex(sources[5]), 5);
+    subI.removeSource(sources[5], 1.0);
+    subI.addData(sources[5], 2.0, 0, std::make_shared<helics::data_block>("new"));
+    subI.updateTimeInclusive(2.0);
+    EXPECT_EQ(subI.getData(5)->to_string(), "5");
+}
@@ -13,6 +13,8 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/core/inproc/InprocCore.h"
 
 #include "gtest/gtest.h"
+#include <future>
+#include <string>
 
 using helics::Core;
 using namespace helics::CoreFactory;
@@ -42,6 +44,35 @@ TEST(InprocCore_tests, initialization_test)
     broker = nullptr;
 }
 
+TEST(InprocCore_tests, lock_free_queue_test)
+{
+    auto broker =
+        helics::BrokerFactory::create(helics::core_type::INPROC, std::string{"--lock_free_queue"});
+    ASSERT_TRUE(broker);
+    EXPECT_TRUE(broker->isConnected());
+    std::string configureString =
+        std::string("-f 1 --lock_free_queue") + " --broker=" + broker->getIdentifier();
+    auto core = create(helics::core_type::INPROC, configureString);
+    ASSERT_TRUE(core);
+    EXPECT_TRUE(core->isConfigured());
+
+    core->connect();
+    EXPECT_TRUE(core->isConnected());
+    auto fedId = core->registerFederate("fed1", helics::CoreFederateInfo());
+    core->enterInitializingMode(fedId);
+    core->enterExecutingMode(fedId);
+    auto granted = core->timeRequest(fedId, 1.0);
+    EXPECT_EQ(granted, helics::Time(1.0));
+    core->finalize(fedId);
+
+    core->disconnect();
+    broker->disconnect();
+    EXPECT_EQ(core->isConnected(), false);
+    EXPECT_EQ(broker->isConnected(), false);
+    core = nullptr;
+    broker = nullptr;
+}
+
 TEST(InprocCore_tests, initialization_test_with_test_broker)
 {
     auto broker = helics::BrokerFactory::create(helics::core_type::TEST, std::string{});
@@ -137,6 +168,56 @@ TEST(InprocCore_tests, pubsub_value_test)
     helics::CoreFactory::cleanUpCores();
 }
 
+TEST(InprocCore_tests, routing_threads_pubsub_test)
+{
+    const char* configureString = "-f 2 --autobroker --routing_threads=2";
+    auto core = create(helics::core_type::INPROC, configureString);
+    ASSERT_TRUE(core != nullptr);
+    core->connect();
+    ASSERT_TRUE(core->isConnected());
+
+    auto id1 = core->registerFederate("sim1", helics::CoreFederateInfo());
+    auto id2 = core->registerFederate("sim2", helics::CoreFederateInfo());
+    auto pub1 = core->registerPublication(id1, "sim1_pub", "string", "");
+    auto sub1 = core->registerInput(id2, "", "string", "");
+    core->addSourceTarget(sub1, "sim1_pub");
+
+    auto init2 = std::async(std::launch::async, [&]() { core->enterInitializingMode(id2); });
+    core->enterInitializingMode(id1);
+    init2.wait();
+    auto exec2 = std::async(std::launch::async, [&]() { core->enterExecutingMode(id2); });
+    core->enterExecutingMode(id1);
+    exec2.wait();
+
+    constexpr int steps{20};
+    // the publication and the following time request from sim1 must reach sim2 in order
+    auto fed2 = std::async(std::launch::async, [&]() {
+        int matched{0};
+        for (int ii = 1; ii <= steps; ++ii) {
+            core->timeRequest(id2, static_cast<double>(ii));
+            auto data = core->getValue(sub1);
+            // sim1 may already be further ahead but the value it set before requesting this time must be here
+            if (data && std::stoi(data->to_string()) >= ii - 1) {
+                ++matched;
+            }
+        }
+        return matched;
+    });
+    for (int ii = 0; ii <= steps; ++ii) {
+        if (ii > 0) {
+            core->timeRequest(id1, static_cast<double>(ii));
+        }
+        auto val = std::to_string(ii);
+        core->setValue(pub1, val.data(), val.size());
+    }
+    EXPECT_EQ(fed2.get(), steps);
+    core->finalize(id1);
+    core->finalize(id2);
+    core->disconnect();
+    core = nullptr;
+    helics::CoreFactory::cleanUpCores();
+}
+
 TEST(InprocCore_tests, send_receive_test)
 {
     const char* initializationString =
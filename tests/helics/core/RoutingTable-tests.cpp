@@ -0,0 +1,63 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/core/RoutingTable.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace helics;
+
+TEST(RoutingTable_tests, federates_and_brokers)
+{
+    RoutingTable table;
+    EXPECT_TRUE(table.empty());
+    global_federate_id fed1(global_federate_id_shift + 3);
+    global_federate_id brk1(global_broker_id_shift + 1);
+    EXPECT_TRUE(table.emplace(fed1, route_id(4)));
+    EXPECT_TRUE(table.emplace(brk1, route_id(2)));
+    EXPECT_EQ(table.size(), 2U);
+    EXPECT_EQ(table.find(fed1, parent_route_id), route_id(4));
+    EXPECT_EQ(table.find(brk1, parent_route_id), route_id(2));
+    // federates and brokers with the same local index are separate entries
+    EXPECT_EQ(
+        table.find(global_federate_id(global_federate_id_shift + 1), parent_route_id),
+        parent_route_id);
+    EXPECT_EQ(
+        table.find(global_federate_id(global_broker_id_shift + 3), parent_route_id),
+        parent_route_id);
+
+    // emplace does not replace an existing route but set does
+    EXPECT_FALSE(table.emplace(fed1, route_id(5)));
+    EXPECT_EQ(table.find(fed1, parent_route_id), route_id(4));
+    table.set(fed1, route_id(5));
+    EXPECT_EQ(table.find(fed1, parent_route_id), route_id(5));
+    EXPECT_EQ(table.size(), 2U);
+
+    table.erase(fed1);
+    EXPECT_FALSE(table.contains(fed1));
+    EXPECT_TRUE(table.contains(brk1));
+    EXPECT_EQ(table.size(), 1U);
+}
+
+TEST(RoutingTable_tests, sparse_ids)
+{
+    RoutingTable table;
+    global_federate_id farFed(global_federate_id_shift + RoutingTable::maxDirectIndex + 10);
+    global_federate_id localId(7);
+    EXPECT_TRUE(table.emplace(farFed, route_id(3)));
+    EXPECT_TRUE(table.emplace(localId, route_id(6)));
+    EXPECT_EQ(table.find(farFed, parent_route_id), route_id(3));
+    EXPECT_EQ(table.find(localId, parent_route_id), route_id(6));
+    EXPECT_EQ(table.size(), 2U);
+    table.set(farFed, route_id(8));
+    EXPECT_EQ(table.find(farFed, parent_route_id), route_id(8));
+    table.erase(localId);
+    EXPECT_EQ(table.find(localId, parent_route_id), parent_route_id);
+    table.clear();
+    EXPECT_TRUE(table.empty());
+    EXPECT_FALSE(table.contains(farFed));
+}
@@ -0,0 +1,208 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/common/GuardedTypes.hpp"
+#include "helics/core/ActionMessage.hpp"
+#include "helics/core/BrokerFactory.hpp"
+#include "helics/core/ChunkedTransfer.hpp"
+#include "helics/core/Core.hpp"
+#include "helics/core/CoreBroker.hpp"
+#include "helics/core/CoreFactory.hpp"
+#include "helics/core/core-types.hpp"
+#include "helics/core/shm/ShmComms.h"
+#include "helics/core/shm/ShmCore.h"
+#include "helics/core/shm/ShmRingBuffer.h"
+
+#include <future>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace std::literals::chrono_literals;
+
+TEST(ShmCore_tests, ring_send_receive)
+{
+    helics::shm::OwnedRing ring;
+    ASSERT_TRUE(ring.connect("shmRingTest", 8, 1024));
+    helics::shm::SendToRing sender;
+    ASSERT_TRUE(sender.connect("shmRingTest", 0));
+
+    helics::ActionMessage cmd(helics::CMD_TIME_REQUEST);
+    cmd.source_id = helics::global_federate_id(23);
+    cmd.actionTime = 47.5;
+    EXPECT_TRUE(sender.sendMessage(cmd));
+
+    helics::ActionMessage rx;
+    ASSERT_TRUE(ring.getMessage(rx, 100ms));
+    EXPECT_EQ(rx.action(), helics::CMD_TIME_REQUEST);
+    EXPECT_EQ(rx.source_id, helics::global_federate_id(23));
+    EXPECT_EQ(rx.actionTime, helics::Time(47.5));
+    // nothing else should be available
+    EXPECT_FALSE(ring.getMessage(rx, 10ms));
+
+    helics::ActionMessage big(helics::CMD_SEND_MESSAGE);
+    big.payload.assign(2048, 'a');
+    EXPECT_FALSE(sender.sendMessage(big));
+    ring.close();
+    EXPECT_FALSE(sender.sendMessage(cmd));
+}
+
+TEST(ShmCore_tests, ring_multiple_producers)
+{
+    constexpr int producers{4};
+    constexpr int messageCount{5000};
+    helics::shm::OwnedRing ring;
+    // the ring is much smaller than the number of messages so it wraps and fills repeatedly
+    ASSERT_TRUE(ring.connect("shmRingMulti", 16, 256));
+
+    std::vector<std::thread> threads;
+    for (int ii = 0; ii < producers; ++ii) {
+        threads.emplace_back([ii]() {
+            helics::shm::SendToRing sender;
+            sender.connect("shmRingMulti", 0);
+            helics::ActionMessage cmd(helics::CMD_PUB);
+            cmd.source_id = helics::global_federate_id(ii);
+            for (int jj = 0; jj < messageCount; ++jj) {
+                cmd.messageID = jj;
+                sender.sendMessage(cmd);
+            }
+        });
+    }
+    std::vector<int> next(producers, 0);
+    bool ordered{true};
+    helics::ActionMessage rx;
+    int received{0};
+    while (received < producers * messageCount) {
+        if (!ring.getMessage(rx, 1000ms)) {
+            break;
+        }
+        auto& expected = next[rx.source_id.baseValue()];
+        if (rx.messageID != expected) {
+            ordered = false;
+        }
+        expected = rx.messageID + 1;
+        ++received;
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(received, producers * messageCount);
+    // each producer's messages are delivered in order
+    EXPECT_TRUE(ordered);
+}
+
+TEST(ShmCore_tests, shmComm_transmit_through)
+{
+    std::atomic<int> counter{0};
+    std::string brokerLoc = "brokerSHM";
+    std::string localLoc = "localSHM";
+    std::atomic<int> counter2{0};
+    guarded<helics::ActionMessage> act;
+    guarded<helics::ActionMessage> act2;
+
+    helics::shm::ShmComms comm;
+    comm.loadTargetInfo(localLoc, brokerLoc);
+    helics::shm::ShmComms comm2;
+    comm2.loadTargetInfo(brokerLoc, std::string());
+
+    comm.setCallback([&counter, &act](helics::ActionMessage m) {
+        ++counter;
+        act = m;
+    });
+    comm2.setCallback([&counter2, &act2](helics::ActionMessage m) {
+        ++counter2;
+        act2 = m;
+    });
+
+    bool connected = comm2.connect();
+    ASSERT_TRUE(connected);
+    connected = comm.connect();
+    ASSERT_TRUE(connected);
+
+    comm.transmit(helics::parent_route_id, helics::CMD_ACK);
+
+    std::this_thread::sleep_for(100ms);
+    ASSERT_EQ(counter2, 1);
+    EXPECT_TRUE(act2.lock()->action() == helics::action_message_def::action_t::cmd_ack);
+
+    comm2.addRoute(helics::route_id(3), localLoc);
+    comm2.transmit(helics::route_id(3), helics::CMD_ACK);
+    std::this_thread::sleep_for(100ms);
+    if (counter != 1) {
+        std::this_thread::sleep_for(350ms);
+    }
+    ASSERT_EQ(counter, 1);
+    EXPECT_TRUE(act.lock()->action() == helics::action_message_def::action_t::cmd_ack);
+
+    comm.disconnect();
+    comm2.disconnect();
+    std::this_thread::sleep_for(100ms);
+}
+
+TEST(ShmCore_tests, shmComm_large_payload)
+{
+    std::string brokerLoc = "brokerSHMlarge";
+    std::string localLoc = "localSHMlarge";
+    std::promise<helics::ActionMessage> received;
+    auto result = received.get_future();
+
+    helics::shm::ShmComms comm;
+    comm.loadTargetInfo(localLoc, brokerLoc);
+    helics::shm::ShmComms comm2;
+    comm2.loadTargetInfo(brokerLoc, std::string());
+
+    comm.setCallback([](helics::ActionMessage /*m*/) {});
+    // the comms object only delivers chunks, the reassembly happens in the broker
+    helics::MessageAssembler assembler;
+    comm2.setCallback([&received, &assembler](helics::ActionMessage m) {
+        if (m.action() == helics::CMD_MESSAGE_CHUNK) {
+            if (assembler.addChunk(m)) {
+                received.set_value(std::move(m));
+            }
+        }
+    });
+
+    ASSERT_TRUE(comm2.connect());
+    ASSERT_TRUE(comm.connect());
+
+    helics::ActionMessage big(helics::CMD_SEND_MESSAGE);
+    big.payload.resize(100000);
+    for (std::size_t ii = 0; ii < big.payload.size(); ++ii) {
+        big.payload[ii] = static_cast<char>(ii % 251);
+    }
+    auto original = big.payload;
+    comm.transmit(helics::parent_route_id, std::move(big));
+
+    ASSERT_EQ(result.wait_for(2s), std::future_status::ready);
+    auto msg = result.get();
+    EXPECT_EQ(msg.action(), helics::CMD_SEND_MESSAGE);
+    EXPECT_EQ(msg.payload, original);
+
+    comm.disconnect();
+    comm2.disconnect();
+    std::this_thread::sleep_for(100ms);
+}
+
+TEST(ShmCore_tests, shmCore_core_broker_default_test)
+{
+    std::string initializationString = "-f 1";
+
+    auto broker = helics::BrokerFactory::create(helics::core_type::SHM, initializationString);
+
+    auto core = helics::CoreFactory::create(helics::core_type::SHM, initializationString);
+    bool connected = broker->isConnected();
+    EXPECT_TRUE(connected);
+    connected = core->connect();
+    EXPECT_TRUE(connected);
+
+    core->disconnect();
+    broker->disconnect();
+    core = nullptr;
+    broker = nullptr;
+    helics::CoreFactory::cleanUpCores(100ms);
+    helics::BrokerFactory::cleanUpBrokers(100ms);
+}
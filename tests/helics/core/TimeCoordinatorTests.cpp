@@ -6,8 +6,11 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #include "helics/core/ActionMessage.hpp"
 #include "helics/core/TimeCoordinator.hpp"
+#include "helics/core/flagOperations.hpp"
 
 #include "gtest/gtest.h"
+#include <algorithm>
+#include <random>
 
 using namespace helics;
 
@@ -138,3 +141,78 @@ TEST(timeCoord_tests, dependent_test_message)
     EXPECT_TRUE(deps.size() == 1);
     EXPECT_TRUE(deps[0] == fed3);
 }
+
+TEST(timeCoord_tests, dependency_time_summary)
+{
+    TimeDependencies deps;
+    for (int ii = 0; ii < 40; ++ii) {
+        deps.addDependency(global_federate_id(ii * 3 + 2));
+    }
+    std::mt19937 gen(4512);
+    std::uniform_int_distribution<int> fedDist(0, 39);
+    std::uniform_int_distribution<int> timeDist(0, 6);
+    std::uniform_int_distribution<int> actionDist(0, 3);
+    auto randomTime = [&gen, &timeDist]() { return Time(static_cast<double>(timeDist(gen))); };
+    for (int step = 0; step < 2000; ++step) {
+        ActionMessage msg(CMD_TIME_REQUEST);
+        msg.source_id = global_federate_id(fedDist(gen) * 3 + 2);
+        msg.actionTime = randomTime();
+        switch (actionDist(gen)) {
+            case 0:
+                msg.setAction(CMD_TIME_GRANT);
+                break;
+            case 1:
+                setActionFlag(msg, iteration_requested_flag);
+                msg.Te = msg.actionTime + randomTime();
+                msg.Tdemin = msg.actionTime + randomTime();
+                break;
+            default:
+                msg.Te = msg.actionTime + randomTime();
+                msg.Tdemin = msg.actionTime + randomTime();
+                break;
+        }
+        deps.updateTime(msg);
+        if (step % 500 == 250) {
+            deps.resetDependentEvents(msg.actionTime);
+        }
+        // compare against a search of all the dependencies
+        Time minNext = Time::maxVal();
+        Time minminDe = Time::maxVal();
+        Time minDe = Time::maxVal();
+        global_federate_id minFed;
+        auto tState = DependencyInfo::time_state_t::time_requested;
+        for (const auto& dep : deps) {
+            if (dep.Tnext < minNext) {
+                minNext = dep.Tnext;
+                tState = dep.time_state;
+            } else if (dep.Tnext == minNext) {
+                if (dep.time_state == DependencyInfo::time_state_t::time_granted) {
+                    tState = dep.time_state;
+                }
+            }
+            if (dep.Tdemin < minminDe) {
+                minminDe = dep.Tdemin;
+                minFed = dep.fedID;
+            } else if (dep.Tdemin == minminDe) {
+                minFed = global_federate_id();
+            }
+            minDe = std::min(minDe, dep.Te);
+        }
+        auto summary = deps.getTimeSummary();
+        ASSERT_EQ(summary.invalidDemin, 0);
+        EXPECT_EQ(summary.minNext, minNext);
+        EXPECT_EQ(summary.minminDe, minminDe);
+        EXPECT_EQ(summary.minDe, minDe);
+        EXPECT_EQ(summary.minFed, minFed);
+        EXPECT_EQ(summary.tState, tState);
+        for (int ii = 0; ii < 7; ++ii) {
+            Time testTime(static_cast<double>(ii));
+            bool ready = std::none_of(deps.begin(), deps.end(), [testTime](const auto& dep) {
+                return (dep.Tnext < testTime) ||
+                    (dep.Tnext == testTime &&
+                     dep.time_state == DependencyInfo::time_state_t::time_granted);
+            });
+            EXPECT_EQ(deps.checkIfReadyForTimeGrant(false, testTime), ready);
+        }
+    }
+}
@@ -135,3 +135,26 @@ TEST(data_block_tests, data_block_swap)
     EXPECT_EQ(test1.size(), 100u);
     EXPECT_EQ(test2.size(), 300u);
 }
+
+/** test the shared data block*/
+TEST(data_block_tests, shared_data_block)
+{
+    std::string str(400, 'r');
+    shared_data_block sdb(str.data(), str.size());
+    EXPECT_EQ(sdb.size(), 400u);
+    EXPECT_EQ(sdb.use_count(), 1);
+
+    shared_data_block sdb2(sdb);
+    EXPECT_EQ(sdb2.use_count(), 2);
+    // copies share the same data
+    EXPECT_EQ(sdb.data(), sdb2.data());
+    EXPECT_EQ(std::string(sdb2.data(), sdb2.size()), str);
+
+    sdb.reset();
+    EXPECT_TRUE(sdb.empty());
+    EXPECT_FALSE(sdb.isValid());
+    EXPECT_EQ(sdb2.use_count(), 1);
+
+    shared_data_block sdb3(std::string("test string"));
+    EXPECT_EQ(sdb3.share()->to_string(), "test string");
+}
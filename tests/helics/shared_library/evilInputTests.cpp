@@ -2074,6 +2074,59 @@ TEST(evil_value_federate_test, helicsFederateGetInputCount)
     EXPECT_EQ(res2, 0);
 }
 
+TEST(evil_value_federate_test, helicsFederateGetUpdatedInputIndices)
+{
+    //void helicsFederateGetUpdatedInputIndices(helics_federate fed, int indices[], int maxIndices, int* actualCount, helics_error* err);
+    char rdata[256];
+    helics_federate evil_federate = reinterpret_cast<helics_federate>(rdata);
+    auto err = helicsErrorInitialize();
+    err.error_code = 45;
+    int indices[5];
+    int actCount = 7;
+    helicsFederateGetUpdatedInputIndices(nullptr, indices, 5, &actCount, &err);
+    EXPECT_EQ(err.error_code, 45);
+    EXPECT_EQ(actCount, 0);
+    helicsErrorClear(&err);
+    helicsFederateGetUpdatedInputIndices(evil_federate, indices, 5, &actCount, &err);
+    EXPECT_NE(err.error_code, 0);
+    EXPECT_EQ(actCount, 0);
+}
+
+TEST(evil_value_federate_test, helicsFederateGetUpdatedInputDoubles)
+{
+    //void helicsFederateGetUpdatedInputDoubles(helics_federate fed, int indices[], double values[], int maxValues, int* actualCount, helics_error* err);
+    char rdata[256];
+    helics_federate evil_federate = reinterpret_cast<helics_federate>(rdata);
+    auto err = helicsErrorInitialize();
+    err.error_code = 45;
+    int indices[5];
+    double values[5];
+    int actCount = 7;
+    helicsFederateGetUpdatedInputDoubles(nullptr, indices, values, 5, &actCount, &err);
+    EXPECT_EQ(err.error_code, 45);
+    EXPECT_EQ(actCount, 0);
+    helicsErrorClear(&err);
+    helicsFederateGetUpdatedInputDoubles(evil_federate, indices, values, 5, &actCount, &err);
+    EXPECT_NE(err.error_code, 0);
+    EXPECT_EQ(actCount, 0);
+}
+
+TEST(evil_value_federate_test, helicsFederatePublishDoubles)
+{
+    //void helicsFederatePublishDoubles(helics_federate fed, const int* publicationIndices, int indexCount, const double* vectorInput, int vectorLength, helics_error* err);
+    char rdata[256];
+    helics_federate evil_federate = reinterpret_cast<helics_federate>(rdata);
+    auto err = helicsErrorInitialize();
+    err.error_code = 45;
+    int indices[] = {0, 1};
+    double values[] = {1.0, 2.0};
+    helicsFederatePublishDoubles(nullptr, indices, 2, values, 2, &err);
+    EXPECT_EQ(err.error_code, 45);
+    helicsErrorClear(&err);
+    helicsFederatePublishDoubles(evil_federate, indices, 2, values, 2, &err);
+    EXPECT_NE(err.error_code, 0);
+}
+
 //section Publication interface Functions
 //functions applying to a \ref helics_publication object
 TEST(evil_pub_test, helicsPublicationPublishRaw)
@@ -2897,6 +2950,34 @@ TEST(evil_input_test, helicsInputSetOption)
     EXPECT_NE(err.error_code, 0);
 }
 
+TEST(evil_input_test, helicsInputGetOptionValue)
+{
+    //int helicsInputGetOptionValue(helics_input inp, int option);
+    char rdata[256];
+    helics_input evil_input = reinterpret_cast<helics_input>(rdata);
+    auto res1 = helicsInputGetOptionValue(nullptr, 99);
+    EXPECT_EQ(res1, 0);
+    auto res2 = helicsInputGetOptionValue(evil_input, 5);
+    EXPECT_EQ(res2, 0);
+}
+
+TEST(evil_input_test, helicsInputSetOptionValue)
+{
+    //void helicsInputSetOptionValue(helics_input inp, int option, int value, helics_error* err);
+    char rdata[256];
+    helics_input evil_input = reinterpret_cast<helics_input>(rdata);
+    auto err = helicsErrorInitialize();
+    err.error_code = 45;
+    helicsInputSetOptionValue(nullptr, 0, 1, &err);
+    EXPECT_EQ(err.error_code, 45);
+    helicsErrorClear(&err);
+    helicsInputSetOptionValue(evil_input, 45, 1, &err);
+    EXPECT_NE(err.error_code, 0);
+    helicsErrorClear(&err);
+    helicsInputSetOptionValue(nullptr, 45, 1, &err);
+    EXPECT_NE(err.error_code, 0);
+}
+
 TEST(evil_input_test, helicsInputIsUpdated)
 {
     //helics_bool helicsInputIsUpdated(helics_input ipt);
@@ -218,6 +218,92 @@ TEST_F(mfed_tests, message_object_tests)
     EXPECT_TRUE(helicsMessageCheckFlag(M, 7) == helics_false);
 }
 
+TEST_F(mfed_tests, message_pool_tests)
+{
+    SetupTest(helicsCreateMessageFederate, "test", 1);
+    auto mFed1 = GetFederateAt(0);
+
+    auto epid = helicsFederateRegisterGlobalEndpoint(mFed1, "ep1", NULL, &err);
+    helicsFederateRegisterGlobalEndpoint(mFed1, "ep2", NULL, &err);
+    EXPECT_EQ(err.error_code, helics_ok);
+    CE(helicsFederateEnterExecutingMode(mFed1, &err));
+
+    CE(helicsEndpointSendMessageRaw(epid, "ep2", "data1", 5, &err));
+    CE(helicsEndpointSendMessageRaw(epid, "ep2", "data2", 5, &err));
+    CE(helicsEndpointSendMessageRaw(epid, "ep2", "data3", 5, &err));
+    CE(helicsFederateRequestTime(mFed1, 1.0, &err));
+
+    helics_message_object messages[2] = {nullptr, nullptr};
+    int count = 0;
+    CE(helicsFederateGetMessageObjects(mFed1, messages, 2, &count, &err));
+    ASSERT_EQ(count, 2);
+    EXPECT_EQ(helicsFederatePendingMessages(mFed1), 1);
+    EXPECT_STREQ(helicsMessageGetSource(messages[0]), "ep1");
+    EXPECT_STREQ(helicsMessageGetDestination(messages[0]), "ep2");
+    ASSERT_EQ(helicsMessageGetRawDataSize(messages[1]), 5);
+    auto rdata = static_cast<const char*>(helicsMessageGetRawDataPointer(messages[1]));
+    EXPECT_EQ(std::string(rdata, rdata + 5), "data2");
+
+    auto freed = messages[0];
+    helicsMessageFree(freed);
+    EXPECT_EQ(helicsMessageIsValid(freed), helics_false);
+    EXPECT_STREQ(helicsMessageGetString(messages[1]), "data2");
+
+    // the slot of the freed message is used for the next message
+    CE(helicsFederateGetMessageObjects(mFed1, messages, 2, &count, &err));
+    ASSERT_EQ(count, 1);
+    EXPECT_EQ(messages[0], freed);
+    EXPECT_STREQ(helicsMessageGetString(messages[0]), "data3");
+
+    CE(helicsFederateGetMessageObjects(mFed1, messages, 2, &count, &err));
+    EXPECT_EQ(count, 0);
+
+    helicsMessageFree(messages[0]);
+    auto M = helicsFederateCreateMessageObject(mFed1, &err);
+    EXPECT_EQ(M, freed);
+    EXPECT_EQ(helicsMessageIsValid(M), helics_false);
+
+    CE(helicsFederateFinalize(mFed1, &err));
+}
+
+TEST_F(mfed_tests, message_pool_struct_getters)
+{
+    SetupTest(helicsCreateMessageFederate, "test", 1);
+    auto mFed1 = GetFederateAt(0);
+
+    auto epid = helicsFederateRegisterGlobalEndpoint(mFed1, "ep1", NULL, &err);
+    auto epid2 = helicsFederateRegisterGlobalEndpoint(mFed1, "ep2", NULL, &err);
+    EXPECT_EQ(err.error_code, helics_ok);
+    CE(helicsFederateEnterExecutingMode(mFed1, &err));
+
+    CE(helicsEndpointSendMessageRaw(epid, "ep2", "a1", 2, &err));
+    CE(helicsEndpointSendMessageRaw(epid, "ep2", "b2", 2, &err));
+    CE(helicsEndpointSendMessageRaw(epid, "ep2", "c3", 2, &err));
+    CE(helicsFederateRequestTime(mFed1, 1.0, &err));
+
+    // free a message object so the struct getters reuse its slot
+    auto M = helicsEndpointGetMessageObject(epid2);
+    EXPECT_STREQ(helicsMessageGetString(M), "a1");
+    helicsMessageFree(M);
+
+    auto mess = helicsEndpointGetMessage(epid2);
+    EXPECT_STREQ(mess.source, "ep1");
+    EXPECT_STREQ(mess.original_source, "ep1");
+    EXPECT_STREQ(mess.dest, "ep2");
+    ASSERT_EQ(mess.length, 2);
+    EXPECT_EQ(std::string(mess.data, mess.data + mess.length), "b2");
+
+    M = helicsFederateCreateMessageObject(mFed1, &err);
+    helicsMessageFree(M);
+    mess = helicsFederateGetMessage(mFed1);
+    EXPECT_STREQ(mess.source, "ep1");
+    EXPECT_STREQ(mess.dest, "ep2");
+    ASSERT_EQ(mess.length, 2);
+    EXPECT_EQ(std::string(mess.data, mess.data + mess.length), "c3");
+
+    CE(helicsFederateFinalize(mFed1, &err));
+}
+
 TEST_P(mfed_type_tests, send_receive_2fed)
 {
     // extraBrokerArgs = "--loglevel=4";
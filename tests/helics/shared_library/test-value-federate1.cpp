@@ -304,6 +304,7 @@ TEST_F(vfed_single_tests, default_value_tests)
 
     auto optset = helicsInputGetOption(inp_double2, helics_handle_option_connection_required);
     EXPECT_EQ(optset, helics_true);
+    EXPECT_EQ(helicsInputGetOptionValue(inp_double2, helics_handle_option_connection_required), 1);
 
     optset = helicsPublicationGetOption(pub, helics_handle_option_connection_required);
     EXPECT_EQ(optset, helics_true);
@@ -351,6 +352,98 @@ TEST_F(vfed_single_tests, default_value_tests)
 
     helicsFederateFinalize(vFed1, &err);
 }
+
+TEST_F(vfed_single_tests, bulk_double_transfer)
+{
+    SetupTest(helicsCreateValueFederate, "test", 1);
+    auto vFed1 = GetFederateAt(0);
+
+    helicsFederateRegisterGlobalPublication(vFed1, "pub1", helics_data_type_double, "", &err);
+    helicsFederateRegisterGlobalPublication(vFed1, "pub2", helics_data_type_double, "", &err);
+    helicsFederateRegisterGlobalPublication(vFed1, "pub3", helics_data_type_double, "", &err);
+    helicsFederateRegisterSubscription(vFed1, "pub1", "", &err);
+    helicsFederateRegisterSubscription(vFed1, "pub2", "", &err);
+    helicsFederateRegisterSubscription(vFed1, "pub3", "", &err);
+    CE(helicsFederateEnterExecutingMode(vFed1, &err));
+
+    int pubIndices[] = {0, 2};
+    double pubValues[] = {1.5, 2.5};
+    CE(helicsFederatePublishDoubles(vFed1, pubIndices, 2, pubValues, 2, &err));
+    CE(helicsFederateRequestTime(vFed1, 1.0, &err));
+
+    int indices[3] = {-1, -1, -1};
+    double values[3] = {0.0, 0.0, 0.0};
+    int count = 0;
+    CE(helicsFederateGetUpdatedInputIndices(vFed1, indices, 3, &count, &err));
+    ASSERT_EQ(count, 2);
+    EXPECT_EQ(indices[0], 0);
+    EXPECT_EQ(indices[1], 2);
+
+    CE(helicsFederateGetUpdatedInputDoubles(vFed1, indices, values, 3, &count, &err));
+    ASSERT_EQ(count, 2);
+    EXPECT_EQ(indices[0], 0);
+    EXPECT_DOUBLE_EQ(values[0], 1.5);
+    EXPECT_EQ(indices[1], 2);
+    EXPECT_DOUBLE_EQ(values[1], 2.5);
+
+    // reading the values clears the updates
+    CE(helicsFederateGetUpdatedInputIndices(vFed1, indices, 3, &count, &err));
+    EXPECT_EQ(count, 0);
+
+    helicsFederatePublishDoubles(vFed1, pubIndices, 2, pubValues, 1, &err);
+    EXPECT_EQ(err.error_code, helics_error_invalid_argument);
+    helicsErrorClear(&err);
+
+    helicsFederatePublishDoubles(vFed1, nullptr, 2, pubValues, 2, &err);
+    EXPECT_EQ(err.error_code, helics_error_invalid_argument);
+    EXPECT_STRNE(err.message, "the number of values must match the number of publication indices");
+    helicsErrorClear(&err);
+
+    int badIndex[] = {5};
+    helicsFederatePublishDoubles(vFed1, badIndex, 1, pubValues, 1, &err);
+    EXPECT_EQ(err.error_code, helics_error_invalid_argument);
+    helicsErrorClear(&err);
+
+    // a bad index anywhere in the list publishes none of the values
+    int partialBad[] = {1, 5};
+    helicsFederatePublishDoubles(vFed1, partialBad, 2, pubValues, 2, &err);
+    EXPECT_EQ(err.error_code, helics_error_invalid_argument);
+    helicsErrorClear(&err);
+    CE(helicsFederateRequestTime(vFed1, 2.0, &err));
+    CE(helicsFederateGetUpdatedInputIndices(vFed1, indices, 3, &count, &err));
+    EXPECT_EQ(count, 0);
+
+    // inputs updated again after being read are reported once and in index order
+    int reverseIndices[] = {2, 0};
+    CE(helicsFederatePublishDoubles(vFed1, reverseIndices, 2, pubValues, 2, &err));
+    CE(helicsFederateRequestTime(vFed1, 3.0, &err));
+    CE(helicsFederateGetUpdatedInputDoubles(vFed1, indices, values, 1, &count, &err));
+    ASSERT_EQ(count, 1);
+    EXPECT_EQ(indices[0], 0);
+    EXPECT_DOUBLE_EQ(values[0], 2.5);
+    CE(helicsFederateGetUpdatedInputIndices(vFed1, indices, 3, &count, &err));
+    ASSERT_EQ(count, 1);
+    EXPECT_EQ(indices[0], 2);
+    CE(helicsFederateGetUpdatedInputDoubles(vFed1, indices, values, 3, &count, &err));
+    ASSERT_EQ(count, 1);
+    EXPECT_DOUBLE_EQ(values[0], 1.5);
+
+    helicsFederateGetUpdatedInputIndices(vFed1, nullptr, 3, &count, &err);
+    EXPECT_EQ(err.error_code, helics_error_invalid_argument);
+    helicsErrorClear(&err);
+    helicsFederateGetUpdatedInputIndices(vFed1, indices, 0, &count, &err);
+    EXPECT_EQ(err.error_code, helics_error_invalid_argument);
+    helicsErrorClear(&err);
+    helicsFederateGetUpdatedInputDoubles(vFed1, indices, nullptr, 3, &count, &err);
+    EXPECT_EQ(err.error_code, helics_error_invalid_argument);
+    helicsErrorClear(&err);
+    helicsFederateGetUpdatedInputDoubles(vFed1, indices, values, -1, &count, &err);
+    EXPECT_EQ(err.error_code, helics_error_invalid_argument);
+    EXPECT_EQ(count, 0);
+    helicsErrorClear(&err);
+
+    CE(helicsFederateFinalize(vFed1, &err));
+}
 TEST_P(vfed_type_tests, single_transfer)
 {
     // helics_time stime = 1.0;